@@ -468,7 +468,8 @@ static_snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< c
 static void
 jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
                             uint32_t size, /**< buffer size */
-                            lit_mem_to_snapshot_id_map_entry_t *lit_map_p) /**< literal map */
+                            const ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
+                            const lit_mem_to_snapshot_id_map_entry_t *lit_map_p) /**< literal map */
 {
   JERRY_ASSERT (size > 0);
 
@@ -501,18 +502,11 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
       {
         if (ecma_is_value_string (literal_start_p[i])
 #if JERRY_BUILTIN_BIGINT
-            || ecma_is_value_bigint (literal_start_p[i])
+            || (ecma_is_value_bigint (literal_start_p[i]) && literal_start_p[i] != ECMA_BIGINT_ZERO)
 #endif /* JERRY_BUILTIN_BIGINT */
             || ecma_is_value_float_number (literal_start_p[i]))
         {
-          lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
-          while (current_p->literal_id != literal_start_p[i])
-          {
-            current_p++;
-          }
-
-          literal_start_p[i] = current_p->literal_offset;
+          literal_start_p[i] = ecma_save_literals_get_offset (lit_pool_p, lit_map_p, literal_start_p[i]);
         }
       }
 
@@ -525,14 +519,7 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
         {
           JERRY_ASSERT (ecma_is_value_string (*literal_start_p));
 
-          lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
-          while (current_p->literal_id != *literal_start_p)
-          {
-            current_p++;
-          }
-
-          *literal_start_p = current_p->literal_offset;
+          *literal_start_p = ecma_save_literals_get_offset (lit_pool_p, lit_map_p, *literal_start_p);
         }
 
         literal_start_p++;
@@ -569,7 +556,7 @@ static ecma_compiled_code_t *
 snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of the
                                                           *   current primary function */
                              const uint8_t *literal_base_p, /**< literal start */
-                             bool copy_bytecode) /**< byte code should be copied to memory */
+                             uint32_t exec_snapshot_opts) /**< jerry_exec_snapshot_opts_t option bits */
 {
   ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) base_addr_p;
   uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
@@ -607,10 +594,6 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint16_arguments_t);
-
-#if JERRY_BUILTIN_REALMS
-    ECMA_SET_INTERNAL_VALUE_POINTER (args_p->realm_value, ecma_builtin_get_global ());
-#endif /* JERRY_BUILTIN_REALMS */
   }
   else
   {
@@ -621,13 +604,9 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint8_arguments_t);
-
-#if JERRY_BUILTIN_REALMS
-    ECMA_SET_INTERNAL_VALUE_POINTER (args_p->realm_value, ecma_builtin_get_global ());
-#endif /* JERRY_BUILTIN_REALMS */
   }
 
-  if (copy_bytecode
+  if ((exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_COPY_DATA)
       || (header_size + (literal_end * sizeof (uint16_t)) + BYTECODE_NO_COPY_THRESHOLD > code_size))
   {
     bytecode_p = (ecma_compiled_code_t *) jmem_heap_alloc_block (code_size);
@@ -700,6 +679,21 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
 
   JERRY_ASSERT (bytecode_p->refs == 1);
 
+  /* The snapshot buffer is never modified, so it can be mapped read-only
+   * when the byte code is not copied into the memory. */
+#if JERRY_BUILTIN_REALMS
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+    ECMA_SET_INTERNAL_VALUE_POINTER (args_p->realm_value, ecma_builtin_get_global ());
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+    ECMA_SET_INTERNAL_VALUE_POINTER (args_p->realm_value, ecma_builtin_get_global ());
+  }
+#endif /* JERRY_BUILTIN_REALMS */
+
 #if JERRY_DEBUGGER
   bytecode_p->status_flags = (uint16_t) (bytecode_p->status_flags | CBC_CODE_FLAGS_DEBUGGER_IGNORE);
 #endif /* JERRY_DEBUGGER */
@@ -724,12 +718,31 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
       ECMA_SET_INTERNAL_VALUE_POINTER (literal_start_p[i],
                                        bytecode_p);
     }
+    else if (exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_LAZY_LOAD)
+    {
+      /* The function is loaded by snapshot_load_lazy_function when it is first used. */
+      cbc_snapshot_function_t *function_p;
+      function_p = (cbc_snapshot_function_t *) jmem_heap_alloc_block (sizeof (cbc_snapshot_function_t));
+
+#if JERRY_MEM_STATS
+      jmem_stats_allocate_byte_code_bytes (sizeof (cbc_snapshot_function_t));
+#endif /* JERRY_MEM_STATS */
+
+      function_p->header.size = 0;
+      function_p->header.refs = 1;
+      function_p->header.status_flags = ((const ecma_compiled_code_t *) (base_addr_p + literal_offset))->status_flags;
+      function_p->base_addr_p = base_addr_p + literal_offset;
+      function_p->literal_base_p = literal_base_p;
+
+      ECMA_SET_INTERNAL_VALUE_POINTER (literal_start_p[i],
+                                       function_p);
+    }
     else
     {
       ecma_compiled_code_t *literal_bytecode_p;
       literal_bytecode_p = snapshot_load_compiled_code (base_addr_p + literal_offset,
                                                         literal_base_p,
-                                                        copy_bytecode);
+                                                        exec_snapshot_opts);
 
       ECMA_SET_INTERNAL_VALUE_POINTER (literal_start_p[i],
                                        literal_bytecode_p);
@@ -752,6 +765,70 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
   return bytecode_p;
 } /* snapshot_load_compiled_code */
 
+/**
+ * Load a snapshot function which was not loaded together with its enclosing function.
+ *
+ * The function literal slot of the enclosing compiled code is updated to refer
+ * to the loaded compiled code, so the function is loaded only once.
+ *
+ * @return compiled code of the function - if the loading is successful
+ *         NULL - otherwise (an exception is raised)
+ */
+ecma_compiled_code_t *
+snapshot_load_lazy_function (const ecma_compiled_code_t *parent_p, /**< enclosing compiled code */
+                             ecma_value_t function_value) /**< function literal */
+{
+  cbc_snapshot_function_t *function_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_snapshot_function_t,
+                                                                         function_value);
+  JERRY_ASSERT (CBC_IS_SNAPSHOT_FUNCTION (&function_p->header));
+
+  ecma_compiled_code_t *bytecode_p = snapshot_load_compiled_code (function_p->base_addr_p,
+                                                                  function_p->literal_base_p,
+                                                                  JERRY_SNAPSHOT_EXEC_LAZY_LOAD);
+
+  if (JERRY_UNLIKELY (bytecode_p == NULL))
+  {
+    return NULL;
+  }
+
+  ecma_value_t *literal_start_p;
+  uint32_t literal_index;
+  uint32_t literal_end;
+
+  if (parent_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) parent_p;
+
+    literal_start_p = (ecma_value_t *) (((uint8_t *) parent_p) + sizeof (cbc_uint16_arguments_t));
+    literal_index = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+    literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) parent_p;
+
+    literal_start_p = (ecma_value_t *) (((uint8_t *) parent_p) + sizeof (cbc_uint8_arguments_t));
+    literal_index = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+    literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
+  }
+
+  while (literal_start_p[literal_index] != function_value)
+  {
+    literal_index++;
+    JERRY_ASSERT (literal_index < literal_end);
+  }
+
+  JERRY_UNUSED (literal_end);
+  ECMA_SET_INTERNAL_VALUE_POINTER (literal_start_p[literal_index], bytecode_p);
+
+#if JERRY_MEM_STATS
+  jmem_stats_free_byte_code_bytes (sizeof (cbc_snapshot_function_t));
+#endif /* JERRY_MEM_STATS */
+
+  jmem_heap_free_block (function_p, sizeof (cbc_snapshot_function_t));
+  return bytecode_p;
+} /* snapshot_load_lazy_function */
+
 #endif /* JERRY_SNAPSHOT_EXEC */
 
 #if JERRY_SNAPSHOT_SAVE
@@ -838,11 +915,12 @@ jerry_generate_snapshot_with_args (const jerry_char_t *source_p, /**< script sou
 
   if (!(generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_STATIC))
   {
-    ecma_collection_t *lit_pool_p = ecma_new_collection ();
+    ecma_save_literals_pool_t lit_pool;
+    ecma_save_literals_init (&lit_pool);
 
-    ecma_save_literals_add_compiled_code (bytecode_data_p, lit_pool_p);
+    ecma_save_literals_add_compiled_code (bytecode_data_p, &lit_pool);
 
-    if (!ecma_save_literals_for_snapshot (lit_pool_p,
+    if (!ecma_save_literals_for_snapshot (&lit_pool,
                                           buffer_p,
                                           buffer_size,
                                           &globals.snapshot_buffer_write_offset,
@@ -850,13 +928,17 @@ jerry_generate_snapshot_with_args (const jerry_char_t *source_p, /**< script sou
                                           &literals_num))
     {
       JERRY_ASSERT (lit_map_p == NULL);
+      ecma_save_literals_free (&lit_pool);
       ecma_bytecode_deref (bytecode_data_p);
       return jerry_create_error (JERRY_ERROR_COMMON, (const jerry_char_t *) ecma_error_cannot_allocate_memory_literals);
     }
 
     jerry_snapshot_set_offsets (buffer_p + (aligned_header_size / sizeof (uint32_t)),
                                 (uint32_t) (header.lit_table_offset - aligned_header_size),
+                                &lit_pool,
                                 lit_map_p);
+
+    ecma_save_literals_free (&lit_pool);
   }
 
   size_t header_offset = 0;
@@ -936,7 +1018,9 @@ jerry_snapshot_result (const uint32_t *snapshot_p, /**< snapshot */
 {
   JERRY_ASSERT (snapshot_p != NULL);
 
-  uint32_t allowed_opts = (JERRY_SNAPSHOT_EXEC_COPY_DATA | JERRY_SNAPSHOT_EXEC_ALLOW_STATIC);
+  uint32_t allowed_opts = (JERRY_SNAPSHOT_EXEC_COPY_DATA
+                           | JERRY_SNAPSHOT_EXEC_ALLOW_STATIC
+                           | JERRY_SNAPSHOT_EXEC_LAZY_LOAD);
 
   if ((exec_snapshot_opts & ~(allowed_opts)) != 0)
   {
@@ -944,6 +1028,12 @@ jerry_snapshot_result (const uint32_t *snapshot_p, /**< snapshot */
     return ecma_create_error_reference_from_context ();
   }
 
+  if ((exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_COPY_DATA) && (exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_LAZY_LOAD))
+  {
+    ecma_raise_range_error (ECMA_ERR_MSG ("Lazily loaded snapshots cannot be copied into memory"));
+    return ecma_create_error_reference_from_context ();
+  }
+
   const char * const invalid_version_error_p = "Invalid snapshot version or unsupported features present";
   const char * const invalid_format_error_p = "Invalid snapshot format";
   const uint8_t *snapshot_data_p = (uint8_t *) snapshot_p;
@@ -1001,7 +1091,7 @@ jerry_snapshot_result (const uint32_t *snapshot_p, /**< snapshot */
 
     bytecode_p = snapshot_load_compiled_code ((const uint8_t *) bytecode_p,
                                               literal_base_p,
-                                              (exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_COPY_DATA) != 0);
+                                              exec_snapshot_opts);
 
     if (bytecode_p == NULL)
     {
@@ -1099,7 +1189,7 @@ jerry_exec_snapshot (const uint32_t *snapshot_p, /**< snapshot */
 static void
 scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
                          const uint8_t *buffer_end_p, /**< snapshot buffer end */
-                         ecma_collection_t *lit_pool_p, /**< list of known values */
+                         ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
                          const uint8_t *literal_base_p) /**< start of literal data */
 {
   JERRY_ASSERT (buffer_end_p > buffer_p);
@@ -1165,6 +1255,7 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
 static void
 update_literal_offsets (uint8_t *buffer_p, /**< [in,out] snapshot buffer start */
                         const uint8_t *buffer_end_p, /**< snapshot buffer end */
+                        const ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
                         const lit_mem_to_snapshot_id_map_entry_t *lit_map_p, /**< literal map */
                         const uint8_t *literal_base_p) /**< start of literal data */
 {
@@ -1201,14 +1292,7 @@ update_literal_offsets (uint8_t *buffer_p, /**< [in,out] snapshot buffer start *
         if ((literal_start_p[i] & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
         {
           ecma_value_t lit_value = ecma_snapshot_get_literal (literal_base_p, literal_start_p[i]);
-          const lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
-          while (current_p->literal_id != lit_value)
-          {
-            current_p++;
-          }
-
-          literal_start_p[i] = current_p->literal_offset;
+          literal_start_p[i] = ecma_save_literals_get_offset (lit_pool_p, lit_map_p, lit_value);
         }
       }
 
@@ -1220,14 +1304,7 @@ update_literal_offsets (uint8_t *buffer_p, /**< [in,out] snapshot buffer start *
         if ((*literal_start_p & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
         {
           ecma_value_t lit_value = ecma_snapshot_get_literal (literal_base_p, *literal_start_p);
-          const lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
-          while (current_p->literal_id != lit_value)
-          {
-            current_p++;
-          }
-
-          *literal_start_p = current_p->literal_offset;
+          *literal_start_p = ecma_save_literals_get_offset (lit_pool_p, lit_map_p, lit_value);
         }
 
         literal_start_p++;
@@ -1266,14 +1343,15 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
     return 0;
   }
 
-  ecma_collection_t *lit_pool_p = ecma_new_collection ();
+  ecma_save_literals_pool_t lit_pool;
+  ecma_save_literals_init (&lit_pool);
 
   for (uint32_t i = 0; i < number_of_snapshots; i++)
   {
     if (inp_buffer_sizes_p[i] < sizeof (jerry_snapshot_header_t))
     {
       *error_p = "invalid snapshot file";
-      ecma_collection_destroy (lit_pool_p);
+      ecma_save_literals_free (&lit_pool);
       return 0;
     }
 
@@ -1284,7 +1362,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
         || !snapshot_check_global_flags (header_p->global_flags))
     {
       *error_p = "invalid snapshot version or unsupported features present";
-      ecma_collection_destroy (lit_pool_p);
+      ecma_save_literals_free (&lit_pool);
       return 0;
     }
 
@@ -1301,7 +1379,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
 
     scan_snapshot_functions (data_p + start_offset,
                              literal_base_p,
-                             lit_pool_p,
+                             &lit_pool,
                              literal_base_p);
   }
 
@@ -1312,7 +1390,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
   if (functions_size >= out_buffer_size)
   {
     *error_p = "output buffer is too small";
-    ecma_collection_destroy (lit_pool_p);
+    ecma_save_literals_free (&lit_pool);
     return 0;
   }
 
@@ -1327,7 +1405,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
   lit_mem_to_snapshot_id_map_entry_t *lit_map_p;
   uint32_t literals_num;
 
-  if (!ecma_save_literals_for_snapshot (lit_pool_p,
+  if (!ecma_save_literals_for_snapshot (&lit_pool,
                                         out_buffer_p,
                                         out_buffer_size,
                                         &functions_size,
@@ -1335,6 +1413,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
                                         &literals_num))
   {
     *error_p = "buffer is too small";
+    ecma_save_literals_free (&lit_pool);
     return 0;
   }
 
@@ -1355,6 +1434,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
     const uint8_t *literal_base_p = ((const uint8_t *) inp_buffers_p[i]) + current_header_p->lit_table_offset;
     update_literal_offsets (dst_p,
                             dst_p + current_header_p->lit_table_offset - start_offset,
+                            &lit_pool,
                             lit_map_p,
                             literal_base_p);
 
@@ -1371,6 +1451,8 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
 
   JERRY_ASSERT ((uint32_t) (dst_p - (uint8_t *) out_buffer_p) == header_p->lit_table_offset);
 
+  ecma_save_literals_free (&lit_pool);
+
   if (lit_map_p != NULL)
   {
     jmem_heap_free_block (lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
@@ -1620,12 +1702,15 @@ jerry_get_literals_from_snapshot (const uint32_t *snapshot_p, /**< input snapsho
   JERRY_ASSERT ((header_p->lit_table_offset % sizeof (uint32_t)) == 0);
   const uint8_t *literal_base_p = snapshot_data_p + header_p->lit_table_offset;
 
-  ecma_collection_t *lit_pool_p = ecma_new_collection ();
+  ecma_save_literals_pool_t lit_pool;
+  ecma_save_literals_init (&lit_pool);
   scan_snapshot_functions (snapshot_data_p + header_p->func_offsets[0],
                            literal_base_p,
-                           lit_pool_p,
+                           &lit_pool,
                            literal_base_p);
 
+  ecma_collection_t *lit_pool_p = lit_pool.values_p;
+
   lit_utf8_size_t literal_count = 0;
   ecma_value_t *buffer_p = lit_pool_p->buffer_p;
 
@@ -1645,7 +1730,7 @@ jerry_get_literals_from_snapshot (const uint32_t *snapshot_p, /**< input snapsho
 
   if (literal_count == 0)
   {
-    ecma_collection_destroy (lit_pool_p);
+    ecma_save_literals_free (&lit_pool);
     return 0;
   }
 
@@ -1671,7 +1756,7 @@ jerry_get_literals_from_snapshot (const uint32_t *snapshot_p, /**< input snapsho
     }
   }
 
-  ecma_collection_destroy (lit_pool_p);
+  ecma_save_literals_free (&lit_pool);
 
   /* Sort the strings by size at first, then lexicographically. */
   jerry_save_literals_sort (literal_array, literal_count);
@@ -51,4 +51,8 @@ typedef enum
   JERRY_SNAPSHOT_FOUR_BYTE_CPOINTER = (1u << 8) /**< deprecated, an unused placeholder now */
 } jerry_snapshot_global_flags_t;
 
+#if JERRY_SNAPSHOT_EXEC
+ecma_compiled_code_t *snapshot_load_lazy_function (const ecma_compiled_code_t *parent_p, ecma_value_t function_value);
+#endif /* JERRY_SNAPSHOT_EXEC */
+
 #endif /* !JERRY_SNAPSHOT_H */
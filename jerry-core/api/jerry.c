@@ -327,12 +327,17 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 
   *out_stats_p = (jerry_heap_stats_t)
   {
-    .version = 1,
+    .version = 2,
     .size = jmem_heap_stats.size,
     .allocated_bytes = jmem_heap_stats.allocated_bytes,
     .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes
   };
 
+#if JERRY_BUILTIN_REGEXP
+  out_stats_p->regexp_cache_hits = JERRY_CONTEXT (re_cache_hits);
+  out_stats_p->regexp_cache_misses = JERRY_CONTEXT (re_cache_misses);
+#endif /* JERRY_BUILTIN_REGEXP */
+
   return true;
 #else /* !JERRY_MEM_STATS */
   JERRY_UNUSED (out_stats_p);
@@ -340,6 +345,22 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* JERRY_MEM_STATS */
 } /* jerry_get_memory_stats */
 
+/**
+ * Invalidate the cached local time zone adjustments of the Date built-in.
+ *
+ * Note:
+ *      should be called when the local time zone of the system changes
+ */
+void
+jerry_reset_time_zone_cache (void)
+{
+  jerry_assert_api_available ();
+
+#if JERRY_BUILTIN_DATE
+  ecma_date_reset_time_zone_cache ();
+#endif /* JERRY_BUILTIN_DATE */
+} /* jerry_reset_time_zone_cache */
+
 /**
  * Simple Jerry runner
  *
@@ -1094,12 +1115,56 @@ jerry_run_all_enqueued_jobs (void)
   jerry_assert_api_available ();
 
 #if JERRY_BUILTIN_PROMISE
-  return ecma_process_all_enqueued_jobs ();
+  return jerry_return (ecma_process_enqueued_jobs (0, 0));
 #else /* !JERRY_BUILTIN_PROMISE */
   return ECMA_VALUE_UNDEFINED;
 #endif /* JERRY_BUILTIN_PROMISE */
 } /* jerry_run_all_enqueued_jobs */
 
+/**
+ * Run enqueued Promise jobs until the first thrown error, until all get executed,
+ * or until the number of executed jobs or the elapsed time reaches its limit.
+ *
+ * Note:
+ *      at least one job is executed if the job queue is not empty,
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return error of the last executed job - if a job has thrown an error,
+ *         undefined - otherwise.
+ */
+jerry_value_t
+jerry_run_enqueued_jobs_with_budget (uint32_t max_jobs, /**< maximum number of executed jobs (0 - unlimited) */
+                                     uint32_t max_time) /**< time limit in milliseconds (0 - unlimited) */
+{
+  jerry_assert_api_available ();
+
+#if JERRY_BUILTIN_PROMISE
+  return jerry_return (ecma_process_enqueued_jobs (max_jobs, max_time));
+#else /* !JERRY_BUILTIN_PROMISE */
+  JERRY_UNUSED (max_jobs);
+  JERRY_UNUSED (max_time);
+  return ECMA_VALUE_UNDEFINED;
+#endif /* JERRY_BUILTIN_PROMISE */
+} /* jerry_run_enqueued_jobs_with_budget */
+
+/**
+ * Check whether there are enqueued Promise jobs.
+ *
+ * @return true - if the job queue is not empty,
+ *         false - otherwise
+ */
+bool
+jerry_has_enqueued_jobs (void)
+{
+  jerry_assert_api_available ();
+
+#if JERRY_BUILTIN_PROMISE
+  return JERRY_CONTEXT (job_queue_count) > 0;
+#else /* !JERRY_BUILTIN_PROMISE */
+  return false;
+#endif /* JERRY_BUILTIN_PROMISE */
+} /* jerry_has_enqueued_jobs */
+
 /**
  * Get global object
  *
@@ -6270,11 +6335,33 @@ jerry_get_typedarray_buffer (jerry_value_t value, /**< TypedArray to get the arr
 jerry_value_t
 jerry_json_parse (const jerry_char_t *string_p, /**< json string */
                   jerry_size_t string_size) /**< json string size */
+{
+  return jerry_json_parse_with_options (string_p, string_size, JERRY_JSON_PARSE_NO_OPTS);
+} /* jerry_json_parse */
+
+/**
+ * Parse the given JSON string to create a jerry_value_t.
+ *
+ * Same as jerry_json_parse, except that the parsing can be customized by options.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_release_value.
+ *      When JERRY_JSON_PARSE_EXTERNAL_STRINGS is set, the JSON string must not be
+ *      freed or modified while any string value created by the parser is alive.
+ *
+ * @return - jerry_value_t containing a JavaScript value.
+ *         - Error value if there was problems during the parse.
+ */
+jerry_value_t
+jerry_json_parse_with_options (const jerry_char_t *string_p, /**< json string */
+                               jerry_size_t string_size, /**< json string size */
+                               uint32_t options) /**< combination of jerry_json_parse_option_enable_feature_t
+                                                  *   values */
 {
   jerry_assert_api_available ();
 
 #if JERRY_BUILTIN_JSON
-  ecma_value_t ret_value = ecma_builtin_json_parse_buffer (string_p, string_size);
+  ecma_value_t ret_value = ecma_builtin_json_parse_buffer (string_p, string_size, options);
 
   if (ecma_is_value_undefined (ret_value))
   {
@@ -6285,10 +6372,44 @@ jerry_json_parse (const jerry_char_t *string_p, /**< json string */
 #else /* !JERRY_BUILTIN_JSON */
   JERRY_UNUSED (string_p);
   JERRY_UNUSED (string_size);
+  JERRY_UNUSED (options);
 
   return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG (ecma_error_json_not_supported_p)));
 #endif /* JERRY_BUILTIN_JSON */
-} /* jerry_json_parse */
+} /* jerry_json_parse_with_options */
+
+/**
+ * Parse a JSON text which is read in chunks by a callback to create a jerry_value_t.
+ *
+ * The result is the same as calling jerry_json_parse with the concatenation of the
+ * chunks, but only the current token is buffered, so the whole text is never stored.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_release_value.
+ *
+ * @return - jerry_value_t containing a JavaScript value.
+ *         - Error value if there was problems during the parse.
+ */
+jerry_value_t
+jerry_json_parse_stream (jerry_json_read_callback_t read_cb, /**< callback which reads the next chunk */
+                         void *user_p) /**< user pointer passed to read_cb */
+{
+  jerry_assert_api_available ();
+
+#if JERRY_BUILTIN_JSON
+  if (read_cb == NULL)
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (ecma_error_wrong_args_msg_p)));
+  }
+
+  return jerry_return (ecma_builtin_json_parse_stream (read_cb, user_p));
+#else /* !JERRY_BUILTIN_JSON */
+  JERRY_UNUSED (read_cb);
+  JERRY_UNUSED (user_p);
+
+  return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG (ecma_error_json_not_supported_p)));
+#endif /* JERRY_BUILTIN_JSON */
+} /* jerry_json_parse_stream */
 
 /**
  * Create a JSON string from a JavaScript value.
@@ -209,6 +209,36 @@
 # define JERRY_STACK_LIMIT (0)
 #endif /* !defined (JERRY_STACK_LIMIT) */
 
+/**
+ * Enable/Disable allocating the vm frames on the engine heap.
+ *
+ * When enabled, the frame contexts and the registers of the executed functions
+ * are bump-allocated from a chunked value stack stored on the engine heap
+ * instead of the native stack. JavaScript calls still recurse natively, but
+ * the native stack used by a call does not depend on the number of registers
+ * of the called function, so deeper recursion fits into small native stacks.
+ *
+ * Allowed values:
+ *  0: Allocate the vm frames on the native stack.
+ *  1: Allocate the vm frames on the engine heap.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_HEAP_FRAMES
+# define JERRY_VM_HEAP_FRAMES 0
+#endif /* !defined (JERRY_VM_HEAP_FRAMES) */
+
+/**
+ * Maximum size of the vm frames allocated on the engine heap in kilobytes
+ *
+ * Only used when JERRY_VM_HEAP_FRAMES is enabled.
+ *
+ * Default value: 0, unlimited
+ */
+#ifndef JERRY_VM_HEAP_FRAMES_LIMIT
+# define JERRY_VM_HEAP_FRAMES_LIMIT (0)
+#endif /* !defined (JERRY_VM_HEAP_FRAMES_LIMIT) */
+
 /**
  * Maximum depth of recursion during GC mark phase
  *
@@ -218,6 +248,19 @@
 # define JERRY_GC_MARK_LIMIT (8)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Maximum number of objects marked or freed by an automatic GC step
+ *
+ * When it is non-zero, automatic garbage collections are incremental: each time
+ * the heap usage limit is reached, the marking or the freeing of the unreachable
+ * objects continues with a step of this size, which bounds the length of the GC pauses.
+ *
+ * Default value: 0, unlimited
+ */
+#ifndef JERRY_GC_STEP_LIMIT
+# define JERRY_GC_STEP_LIMIT (0)
+#endif /* !defined (JERRY_GC_STEP_LIMIT) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -231,6 +274,57 @@
 # define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Enable/Disable the hash table index of the literal storage.
+ *
+ * When enabled, literal strings and numbers are searched in a hash table
+ * instead of the literal lists once the number of literals reaches a
+ * small threshold. Small programs still use the literal lists only.
+ *
+ * Allowed values:
+ *  0: Disable the hash table index.
+ *  1: Enable the hash table index.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_LIT_HASH_TABLE
+# define JERRY_LIT_HASH_TABLE 1
+#endif /* !defined (JERRY_LIT_HASH_TABLE) */
+
+/**
+ * Enable/Disable inline caches of property accesses in the virtual machine.
+ *
+ * When enabled, property gets and sets of the byte code remember the object
+ * and the property found by their last execution, so repeated accesses of
+ * the same object property skip the property lookup.
+ *
+ * Allowed values:
+ *  0: Disable inline caches.
+ *  1: Enable inline caches.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_INLINE_CACHE
+# define JERRY_VM_INLINE_CACHE 0
+#endif /* !defined (JERRY_VM_INLINE_CACHE) */
+
+/**
+ * Enable/Disable segregated size class free lists in the heap allocator.
+ *
+ * When enabled, freed blocks between 16 and 256 bytes are kept in per size
+ * free lists, which makes allocating and freeing such blocks constant time.
+ * The blocks are merged back into the heap when an allocation fails.
+ *
+ * Allowed values:
+ *  0: Use only the address ordered first fit free list.
+ *  1: Use size class free lists for small blocks.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_HEAP_SIZE_CLASSES
+# define JERRY_HEAP_SIZE_CLASSES 0
+#endif /* !defined (JERRY_HEAP_SIZE_CLASSES) */
+
 /**
  * Enable/Disable line-info management inside the engine.
  *
@@ -299,6 +393,25 @@
 # define JERRY_NUMBER_TYPE_FLOAT64 1
 #endif /* !defined (JERRY_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Enable/Disable NaN-boxed ecma values.
+ *
+ * When enabled, ecma values are 64 bit wide and non-integer numbers are
+ * stored directly in the value instead of being allocated on the heap.
+ * All other values (including compressed pointers) keep their encoding
+ * in the lower bits. This doubles the size of every stored value, so it
+ * is mainly useful on 64-bit hosts running floating point heavy code.
+ *
+ * Allowed values:
+ *  0: Disable NaN-boxing
+ *  1: Enable NaN-boxing (requires JERRY_NUMBER_TYPE_FLOAT64)
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_NAN_BOXING
+# define JERRY_NAN_BOXING 0
+#endif /* !defined (JERRY_NAN_BOXING) */
+
 /**
  * Enable/Disable the JavaScript parser.
  *
@@ -312,6 +425,25 @@
 # define JERRY_PARSER 1
 #endif /* !defined (JERRY_PARSER) */
 
+/**
+ * Enable/Disable lazy compilation of function bodies.
+ *
+ * When enabled, the body of a plain (non-arrow, non-generator, non-async) function
+ * with a simple argument list is only pre-scanned when its enclosing code is parsed.
+ * The source text of the function is retained and the byte code is generated when
+ * the function is called for the first time. Syntax errors which are not detected
+ * by the pre-scanner are reported by the first call of the function.
+ *
+ * Allowed values:
+ *  0: Compile all functions when the enclosing code is parsed.
+ *  1: Compile eligible function bodies on their first call.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_LAZY_FUNCTIONS
+# define JERRY_LAZY_FUNCTIONS 0
+#endif /* !defined (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Enable/Disable JerryScript byte code dump functions during parsing.
  * To dump the JerryScript byte code the engine must be initialized with opcodes
@@ -340,6 +472,71 @@
 # define JERRY_PROPERTY_HASHMAP 1
 #endif /* !defined (JERRY_PROPERTY_HASHMAP) */
 
+/**
+ * Minimum number of entries in a property hashmap.
+ *
+ * Objects with less than half of this many named properties never get a
+ * hashmap, and a hashmap is released when the number of its properties
+ * drops below a quarter of this value.
+ *
+ * Allowed values: power of 2 between 8 and 1024
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE
+# define JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE (32)
+#endif /* !defined (JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE) */
+
+/**
+ * Number of long linear property lookups on the same object before a
+ * property hashmap is built for it.
+ *
+ * A lookup is long if it walks through at least JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE / 2
+ * property pairs. Lookups walking through twice as many pairs build the hashmap
+ * immediately. Value 1 restores the eager behaviour of building the hashmap
+ * on the first long lookup.
+ *
+ * Allowed values: 1 - 255
+ *
+ * Default value: 2
+ */
+#ifndef JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT
+# define JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT (2)
+#endif /* !defined (JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT) */
+
+/**
+ * Enable/Disable property shapes.
+ *
+ * Ordinary objects whose properties are created in the same order share a
+ * shape, which stores the property names. The property pairs of these objects
+ * only store the property types and values, which reduces their size by a
+ * third. Objects become dictionary objects when a property is deleted, or
+ * they have too many or internal properties. Requires 32 bit compressed pointers.
+ *
+ * Allowed values:
+ *  0: Disable property shapes.
+ *  1: Enable property shapes.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_PROPERTY_SHAPES
+# define JERRY_PROPERTY_SHAPES 0
+#endif /* !defined (JERRY_PROPERTY_SHAPES) */
+
+/**
+ * Enables/disables rope strings.
+ *
+ * When enabled, concatenations of at least 256 bytes do not copy the left
+ * operand. The result refers to it instead, and the characters are copied
+ * into a single buffer when they are first accessed. This turns repeated
+ * 's += chunk' string building from quadratic into linear time.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_ROPE_STRINGS
+# define JERRY_ROPE_STRINGS 1
+#endif /* !defined (JERRY_ROPE_STRINGS) */
+
 /**
  * Enables/disables the Promise event callbacks
  *
@@ -374,6 +571,21 @@
 # define JERRY_REGEXP_STRICT_MODE 0
 #endif /* !defined (JERRY_REGEXP_STRICT_MODE) */
 
+/**
+ * Number of compiled RegExp byte codes kept in the RegExp cache
+ *
+ * The cache is hash indexed by the pattern and flags, and the least recently
+ * used byte code is evicted when the cache is full. The cached byte codes are
+ * only freed when the memory pressure is high.
+ *
+ * Allowed values: powers of 2 between 1 and 1024
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_REGEXP_CACHE_SIZE
+# define JERRY_REGEXP_CACHE_SIZE (32)
+#endif /* !defined (JERRY_REGEXP_CACHE_SIZE) */
+
 /**
  * Enable/Disable the snapshot execution functions.
  *
@@ -615,9 +827,24 @@
 #if !defined (JERRY_STACK_LIMIT) || (JERRY_STACK_LIMIT < 0)
 # error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif
+#if !defined (JERRY_VM_HEAP_FRAMES_LIMIT) || (JERRY_VM_HEAP_FRAMES_LIMIT < 0)
+# error "Invalid value for 'JERRY_VM_HEAP_FRAMES_LIMIT' macro."
+#endif
 #if !defined (JERRY_GC_MARK_LIMIT) || (JERRY_GC_MARK_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif
+#if !defined (JERRY_GC_STEP_LIMIT) || (JERRY_GC_STEP_LIMIT < 0)
+# error "Invalid value for 'JERRY_GC_STEP_LIMIT' macro."
+#endif
+#if !defined (JERRY_REGEXP_CACHE_SIZE) \
+|| (JERRY_REGEXP_CACHE_SIZE < 1) || (JERRY_REGEXP_CACHE_SIZE > 1024) \
+|| ((JERRY_REGEXP_CACHE_SIZE & (JERRY_REGEXP_CACHE_SIZE - 1)) != 0)
+# error "Invalid value for 'JERRY_REGEXP_CACHE_SIZE' macro."
+#endif
+#if !defined (JERRY_HEAP_SIZE_CLASSES) \
+|| ((JERRY_HEAP_SIZE_CLASSES != 0) && (JERRY_HEAP_SIZE_CLASSES != 1))
+# error "Invalid value for 'JERRY_HEAP_SIZE_CLASSES' macro."
+#endif
 #if !defined (JERRY_LCACHE) \
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
@@ -626,6 +853,10 @@
 || ((JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1))
 # error "Invalid value for 'JERRY_LINE_INFO' macro."
 #endif
+#if !defined (JERRY_LIT_HASH_TABLE) \
+|| ((JERRY_LIT_HASH_TABLE != 0) && (JERRY_LIT_HASH_TABLE != 1))
+# error "Invalid value for 'JERRY_LIT_HASH_TABLE' macro."
+#endif
 #if !defined (JERRY_LOGGING) \
 || ((JERRY_LOGGING != 0) && (JERRY_LOGGING != 1))
 # error "Invalid value for 'JERRY_LOGGING' macro."
@@ -642,10 +873,18 @@
 || ((JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1))
 # error "Invalid value for 'JERRY_NUMBER_TYPE_FLOAT64' macro."
 #endif
+#if !defined (JERRY_NAN_BOXING) \
+|| ((JERRY_NAN_BOXING != 0) && (JERRY_NAN_BOXING != 1))
+# error "Invalid value for 'JERRY_NAN_BOXING' macro."
+#endif
 #if !defined (JERRY_PARSER) \
 || ((JERRY_PARSER != 0) && (JERRY_PARSER != 1))
 # error "Invalid value for 'JERRY_PARSER' macro."
 #endif
+#if !defined (JERRY_LAZY_FUNCTIONS) \
+|| ((JERRY_LAZY_FUNCTIONS != 0) && (JERRY_LAZY_FUNCTIONS != 1))
+# error "Invalid value for 'JERRY_LAZY_FUNCTIONS' macro."
+#endif
 #if !defined (JERRY_PARSER_DUMP_BYTE_CODE) \
 || ((JERRY_PARSER_DUMP_BYTE_CODE != 0) && (JERRY_PARSER_DUMP_BYTE_CODE != 1))
 # error "Invalid value for 'JERRY_PARSER_DUMP_BYTE_CODE' macro."
@@ -654,6 +893,23 @@
 || ((JERRY_PROPERTY_HASHMAP != 0) && (JERRY_PROPERTY_HASHMAP != 1))
 # error "Invalid value for 'JERRY_PROPERTY_HASHMAP' macro."
 #endif
+#if !defined (JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE) \
+|| (JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE < 8) || (JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE > 1024) \
+|| ((JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE & (JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE - 1)) != 0)
+# error "Invalid value for 'JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE' macro."
+#endif
+#if !defined (JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT) \
+|| (JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT < 1) || (JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 255)
+# error "Invalid value for 'JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT' macro."
+#endif
+#if !defined (JERRY_PROPERTY_SHAPES) \
+|| ((JERRY_PROPERTY_SHAPES != 0) && (JERRY_PROPERTY_SHAPES != 1))
+# error "Invalid value for 'JERRY_PROPERTY_SHAPES' macro."
+#endif
+#if !defined (JERRY_ROPE_STRINGS) \
+|| ((JERRY_ROPE_STRINGS != 0) && (JERRY_ROPE_STRINGS != 1))
+# error "Invalid value for 'JERRY_ROPE_STRINGS' macro."
+#endif
 #if !defined (JERRY_PROMISE_CALLBACK) \
 || ((JERRY_PROMISE_CALLBACK != 0) && (JERRY_PROMISE_CALLBACK != 1))
 # error "Invalid value for 'JERRY_PROMISE_CALLBACK' macro."
@@ -690,6 +946,14 @@
 || ((JERRY_VM_EXEC_STOP != 0) && (JERRY_VM_EXEC_STOP != 1))
 # error "Invalid value for 'JERRY_VM_EXEC_STOP' macro."
 #endif
+#if !defined (JERRY_VM_HEAP_FRAMES) \
+|| ((JERRY_VM_HEAP_FRAMES != 0) && (JERRY_VM_HEAP_FRAMES != 1))
+# error "Invalid value for 'JERRY_VM_HEAP_FRAMES' macro."
+#endif
+#if !defined (JERRY_VM_INLINE_CACHE) \
+|| ((JERRY_VM_INLINE_CACHE != 0) && (JERRY_VM_INLINE_CACHE != 1))
+# error "Invalid value for 'JERRY_VM_INLINE_CACHE' macro."
+#endif
 
 /**
  * Cross component requirements check.
@@ -709,6 +973,44 @@
 #  error "Promise callback support depends on Promise support"
 #endif /* JERRY_PROMISE_CALLBACK && !JERRY_BUILTIN_PROMISE */
 
+/**
+ * The size class free lists are part of the internal allocator.
+ */
+#if JERRY_HEAP_SIZE_CLASSES && JERRY_SYSTEM_ALLOCATOR
+#  error "Heap size classes cannot be used with the system allocator"
+#endif /* JERRY_HEAP_SIZE_CLASSES && JERRY_SYSTEM_ALLOCATOR */
+
+/**
+ * NaN-boxing stores 64-bit floating point numbers directly in the values,
+ * and the snapshot format stores 32-bit values.
+ */
+#if JERRY_NAN_BOXING && !JERRY_NUMBER_TYPE_FLOAT64
+#  error "NaN-boxing requires float64 numbers"
+#endif /* JERRY_NAN_BOXING && !JERRY_NUMBER_TYPE_FLOAT64 */
+
+#if JERRY_NAN_BOXING && (JERRY_SNAPSHOT_SAVE || JERRY_SNAPSHOT_EXEC)
+#  error "NaN-boxing cannot be used with snapshots"
+#endif /* JERRY_NAN_BOXING && (JERRY_SNAPSHOT_SAVE || JERRY_SNAPSHOT_EXEC) */
+
+/**
+ * The shape of an object is stored in the unused half word of the property pair header,
+ * which is only present with 32 bit compressed pointers.
+ */
+#if JERRY_PROPERTY_SHAPES && !JERRY_CPOINTER_32_BIT
+#  error "Property shapes require 32 bit compressed pointers"
+#endif /* JERRY_PROPERTY_SHAPES && !JERRY_CPOINTER_32_BIT */
+
+/**
+ * Lazily compiled functions only store their source code, which cannot be saved into snapshots.
+ */
+#if JERRY_LAZY_FUNCTIONS && !JERRY_PARSER
+#  error "Lazy function compilation requires the JavaScript parser"
+#endif /* JERRY_LAZY_FUNCTIONS && !JERRY_PARSER */
+
+#if JERRY_LAZY_FUNCTIONS && JERRY_SNAPSHOT_SAVE
+#  error "Lazy function compilation cannot be used with snapshot saving"
+#endif /* JERRY_LAZY_FUNCTIONS && JERRY_SNAPSHOT_SAVE */
+
 /**
  * Resource name related types into a single guard
  */
@@ -21,6 +21,7 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-objects.h"
+#include "ecma-property-shape.h"
 #include "jcontext.h"
 #include "jerryscript-debugger.h"
 #include "lit-char-helpers.h"
@@ -462,6 +463,12 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
     {
       ecma_fast_array_convert_to_normal (binding_obj_p);
     }
+#if JERRY_PROPERTY_SHAPES
+    else if (ecma_property_shape_get_id (binding_obj_p) != 0)
+    {
+      ecma_property_shape_to_dictionary (binding_obj_p, NULL);
+    }
+#endif /* JERRY_PROPERTY_SHAPES */
 
     prop_iter_cp = binding_obj_p->u1.property_list_cp;
   }
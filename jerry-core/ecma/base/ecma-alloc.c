@@ -16,6 +16,7 @@
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
+#include "ecma-property-shape.h"
 #include "jrt.h"
 #include "jmem.h"
 
@@ -24,8 +25,14 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= sizeof (uint64_t),
-                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_8_bytes);
+#if JERRY_NAN_BOXING
+JERRY_STATIC_ASSERT ((offsetof (ecma_property_header_t, types) & 0x1) == 0
+                     && offsetof (ecma_property_header_t, types) + ECMA_PROPERTY_PAIR_ITEM_COUNT <= JMEM_ALIGNMENT,
+                     property_types_must_start_at_an_even_offset_in_the_first_aligned_block);
+#endif /* JERRY_NAN_BOXING */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= 2 * sizeof (ecma_value_t),
+                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_two_values);
 
 /** \addtogroup ecma ECMA
  * @{
@@ -248,7 +255,13 @@ ecma_alloc_property_pair (void)
   jmem_stats_allocate_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* JERRY_MEM_STATS */
 
+#if JERRY_PROPERTY_SHAPES
+  ecma_property_pair_t *property_pair_p = jmem_heap_alloc_block (sizeof (ecma_property_pair_t));
+  property_pair_p->header.shape_id = 0;
+  return property_pair_p;
+#else /* !JERRY_PROPERTY_SHAPES */
   return jmem_heap_alloc_block (sizeof (ecma_property_pair_t));
+#endif /* JERRY_PROPERTY_SHAPES */
 } /* ecma_alloc_property_pair */
 
 /**
@@ -264,6 +277,38 @@ ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property
   jmem_heap_free_block (property_pair_p, sizeof (ecma_property_pair_t));
 } /* ecma_dealloc_property_pair */
 
+#if JERRY_PROPERTY_SHAPES
+
+/**
+ * Allocate memory for a property pair of a shaped object, which has no name slots
+ *
+ * @return pointer to allocated memory
+ */
+extern inline ecma_property_pair_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_alloc_shaped_property_pair (void)
+{
+#if JERRY_MEM_STATS
+  jmem_stats_allocate_property_bytes (ECMA_PROPERTY_SHAPE_PAIR_SIZE);
+#endif /* JERRY_MEM_STATS */
+
+  return jmem_heap_alloc_block (ECMA_PROPERTY_SHAPE_PAIR_SIZE);
+} /* ecma_alloc_shaped_property_pair */
+
+/**
+ * Dealloc memory of a property pair of a shaped object
+ */
+extern inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_dealloc_shaped_property_pair (ecma_property_pair_t *property_pair_p) /**< property pair to be freed */
+{
+#if JERRY_MEM_STATS
+  jmem_stats_free_property_bytes (ECMA_PROPERTY_SHAPE_PAIR_SIZE);
+#endif /* JERRY_MEM_STATS */
+
+  jmem_heap_free_block (property_pair_p, ECMA_PROPERTY_SHAPE_PAIR_SIZE);
+} /* ecma_dealloc_shaped_property_pair */
+
+#endif /* JERRY_PROPERTY_SHAPES */
+
 /**
  * @}
  * @}
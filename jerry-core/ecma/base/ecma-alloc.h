@@ -121,6 +121,22 @@ ecma_property_pair_t *ecma_alloc_property_pair (void);
  */
 void ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p);
 
+#if JERRY_PROPERTY_SHAPES
+
+/**
+ * Allocate memory for a property pair of a shaped object
+ *
+ * @return pointer to allocated memory
+ */
+ecma_property_pair_t *ecma_alloc_shaped_property_pair (void);
+
+/**
+ * Dealloc memory from a property pair of a shaped object
+ */
+void ecma_dealloc_shaped_property_pair (ecma_property_pair_t *property_pair_p);
+
+#endif /* JERRY_PROPERTY_SHAPES */
+
 /**
  * @}
  * @}
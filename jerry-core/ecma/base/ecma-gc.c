@@ -28,6 +28,7 @@
 #include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-property-shape.h"
 #include "ecma-proxy-object.h"
 #include "jcontext.h"
 #include "jrt.h"
@@ -41,6 +42,7 @@
 #include "ecma-typedarray-object.h"
 #endif /* JERRY_BUILTIN_TYPEDARRAY */
 #if JERRY_BUILTIN_PROMISE
+#include "ecma-jobqueue.h"
 #include "ecma-promise-object.h"
 #endif /* JERRY_BUILTIN_PROMISE */
 
@@ -78,8 +80,41 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
  */
 static void ecma_gc_mark (ecma_object_t *object_p);
 
+#if (JERRY_GC_STEP_LIMIT != 0)
+
+/**
+ * Mark an object gray during an incremental garbage collection without visiting its references.
+ *
+ * The object is pushed onto the mark stack. When the mark stack is full, the object is
+ * marked later by rescanning the objects which are marked by the current collection.
+ */
+static void
+ecma_gc_shade_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED);
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING);
+
+  /* Set the reference count of gray object to 0 */
+  object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+
+  if (JERRY_CONTEXT (ecma_gc_mark_stack_top) < ECMA_GC_MARK_STACK_SIZE)
+  {
+    uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top)++;
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_stack)[top], object_p);
+    return;
+  }
+
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_MARK_OVERFLOW;
+} /* ecma_gc_shade_object */
+
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
 /**
  * Set visited flag of the object.
+ *
+ * The references of the object are marked recursively until the recursion limit is reached,
+ * then the object is pushed onto the mark stack. When the mark stack is full, the object is
+ * marked later by rescanning the list of objects.
  */
 static void
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
@@ -94,20 +129,49 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
       object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
       ecma_gc_mark (object_p);
       JERRY_CONTEXT (ecma_gc_mark_recursion_limit)++;
+      return;
     }
-    else
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+#if (JERRY_GC_STEP_LIMIT != 0)
+    /* The reference counts of the objects may change between the steps of an
+     * incremental collection, so gray objects cannot be marked by a reference. */
+    if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING)
     {
-      /* Set the reference count of the non-marked gray object to 1 */
-      object_p->type_flags_refs &= (ecma_object_descriptor_t) ((ECMA_OBJECT_REF_ONE << 1) - 1);
-      JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+      ecma_gc_shade_object (object_p);
+      return;
     }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-    /* Set the reference count of gray object to 0 */
-    object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
+    if (JERRY_CONTEXT (ecma_gc_mark_stack_top) < ECMA_GC_MARK_STACK_SIZE)
+    {
+      /* Set the reference count of gray object to 0 */
+      object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+
+      uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top)++;
+      ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_stack)[top], object_p);
+      return;
+    }
+
+    /* Set the reference count of the non-marked gray object to 1 */
+    object_p->type_flags_refs &= (ecma_object_descriptor_t) ((ECMA_OBJECT_REF_ONE << 1) - 1);
+    JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
   }
 } /* ecma_gc_set_object_visited */
 
+/**
+ * Mark the references of the gray objects stored in the mark stack.
+ */
+static void
+ecma_gc_mark_stack_drain (void)
+{
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+  {
+    uint32_t top = --JERRY_CONTEXT (ecma_gc_mark_stack_top);
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_mark_stack)[top]));
+  }
+} /* ecma_gc_mark_stack_drain */
+
 /**
  * Initialize GC information for the object
  */
@@ -136,6 +200,17 @@ ecma_ref_object_inline (ecma_object_t *object_p) /**< object */
   }
   else
   {
+#if (JERRY_GC_STEP_LIMIT != 0)
+    /* Write barrier of the incremental marking: an unmarked object referenced by
+     * the engine can be stored in an already marked object, so it is marked gray. */
+    if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+    {
+      ecma_gc_shade_object (object_p);
+      object_p->type_flags_refs = (ecma_object_descriptor_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+      return;
+    }
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
     jerry_fatal (ERR_REF_COUNT_LIMIT);
   }
 } /* ecma_ref_object_inline */
@@ -1217,6 +1292,38 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   ecma_gc_mark_properties (object_p, false);
 } /* ecma_gc_mark */
 
+#if JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER
+/**
+ * Remove the weak references to an object from the WeakRef and container objects
+ */
+static void
+ecma_gc_clear_weak_refs (ecma_object_t *object_p, /**< object */
+                         ecma_collection_t *refs_p) /**< weak references of the object */
+{
+  for (uint32_t i = 0; i < refs_p->item_count; i++)
+  {
+    const ecma_value_t reference_value = refs_p->buffer_p[i];
+
+    if (ecma_is_value_empty (reference_value))
+    {
+      continue;
+    }
+
+    ecma_object_t *obj_p = ecma_get_object_from_value (reference_value);
+    refs_p->buffer_p[i] = ECMA_VALUE_EMPTY;
+
+    if (ecma_object_class_is (obj_p, ECMA_OBJECT_CLASS_WEAKREF))
+    {
+      ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
+      ext_obj_p->u.cls.u3.target = ECMA_VALUE_UNDEFINED;
+      continue;
+    }
+
+    ecma_op_container_remove_weak_entry (obj_p, ecma_make_object_value (object_p));
+  }
+} /* ecma_gc_clear_weak_refs */
+#endif /* JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER */
+
 /**
  * Free the native handle/pointer by calling its free callback.
  */
@@ -1491,22 +1598,35 @@ ecma_gc_free_property (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (prop_pair_p->header.types[0] != ECMA_PROPERTY_TYPE_HASHMAP);
 
   uint32_t index = (options & ECMA_GC_FREE_SECOND_PROPERTY);
-  jmem_cpointer_t name_cp = prop_pair_p->names_cp[index];
   ecma_property_t *property_p = prop_pair_p->header.types + index;
   ecma_property_t property = *property_p;
 
 #if JERRY_LCACHE
   if ((property & ECMA_PROPERTY_FLAG_LCACHED) != 0)
   {
-    ecma_lcache_invalidate (object_p, name_cp, property_p);
+    ecma_lcache_invalidate (object_p, prop_pair_p->names_cp[index], property_p);
   }
 #endif /* JERRY_LCACHE */
 
+#if JERRY_VM_INLINE_CACHE
+  /* Inline cache entries are not tracked per property, so all entries are invalidated. */
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (vm_inline_cache_epoch) == 0))
+  {
+    memset (JERRY_CONTEXT (vm_inline_cache), 0, sizeof (JERRY_CONTEXT (vm_inline_cache)));
+  }
+#endif /* JERRY_VM_INLINE_CACHE */
+
   if (ECMA_PROPERTY_IS_RAW (property))
   {
+#if JERRY_PROPERTY_SHAPES
+    /* Shaped property pairs have no name slots, the names are owned by the shape. */
+    if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR
+        && !(options & ECMA_GC_FREE_SHAPED_PROPERTY))
+#else /* !JERRY_PROPERTY_SHAPES */
     if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+#endif /* JERRY_PROPERTY_SHAPES */
     {
-      ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp);
+      ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[index]);
       ecma_deref_ecma_string (prop_name_p);
     }
 
@@ -1535,6 +1655,7 @@ ecma_gc_free_property (ecma_object_t *object_p, /**< object */
     return;
   }
 
+  jmem_cpointer_t name_cp = prop_pair_p->names_cp[index];
   ecma_value_t value = prop_pair_p->values[index].value;
 
   switch (name_cp)
@@ -1559,24 +1680,7 @@ ecma_gc_free_property (ecma_object_t *object_p, /**< object */
     case LIT_INTERNAL_MAGIC_STRING_WEAK_REFS:
     {
       ecma_collection_t *refs_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_collection_t, value);
-      for (uint32_t j = 0; j < refs_p->item_count; j++)
-      {
-        const ecma_value_t reference_value = refs_p->buffer_p[j];
-
-        if (!ecma_is_value_empty (reference_value))
-        {
-          ecma_object_t *obj_p = ecma_get_object_from_value (reference_value);
-
-          if (ecma_object_class_is (obj_p, ECMA_OBJECT_CLASS_WEAKREF))
-          {
-            ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
-            ext_obj_p->u.cls.u3.target = ECMA_VALUE_UNDEFINED;
-            continue;
-          }
-          ecma_op_container_remove_weak_entry (obj_p, ecma_make_object_value (object_p));
-        }
-      }
-
+      ecma_gc_clear_weak_refs (object_p, refs_p);
       ecma_collection_destroy (refs_p);
       break;
     }
@@ -1613,6 +1717,18 @@ ecma_gc_free_properties (ecma_object_t *object_p, /**< object */
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_PROPERTY_SHAPES
+  uint16_t shape_id = ecma_property_shape_get_id (object_p);
+
+  if (shape_id != 0)
+  {
+#if JERRY_LCACHE
+    ecma_property_shape_invalidate_lcache (object_p);
+#endif /* JERRY_LCACHE */
+    options |= ECMA_GC_FREE_SHAPED_PROPERTY;
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
+
   while (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
@@ -1627,8 +1743,23 @@ ecma_gc_free_properties (ecma_object_t *object_p, /**< object */
 
     prop_iter_cp = prop_iter_p->next_property_cp;
 
+#if JERRY_PROPERTY_SHAPES
+    if (shape_id != 0)
+    {
+      ecma_dealloc_shaped_property_pair (prop_pair_p);
+      continue;
+    }
+#endif /* JERRY_PROPERTY_SHAPES */
+
     ecma_dealloc_property_pair (prop_pair_p);
   }
+
+#if JERRY_PROPERTY_SHAPES
+  if (shape_id != 0)
+  {
+    ecma_property_shape_deref (shape_id);
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
 } /* ecma_gc_free_properties */
 
 /**
@@ -2050,16 +2181,389 @@ free_properties:
   ecma_dealloc_extended_object (object_p, ext_object_size);
 } /* ecma_gc_free_object */
 
+#if (JERRY_GC_STEP_LIMIT != 0)
+
 /**
- * Run garbage collection, freeing objects that are no longer referenced.
+ * Maximum number of times the objects created during an incremental marking are visited
+ * before the marking is finished in a single step.
  */
-void
-ecma_gc_run (void)
+#define ECMA_GC_MAX_MARK_PASSES 8
+
+/**
+ * Free unreachable objects which were not freed by the previous GC runs.
+ */
+static void
+ecma_gc_sweep (uint32_t limit) /**< maximum number of freed objects */
+{
+  while (JERRY_CONTEXT (ecma_gc_sweep_cp) != JMEM_CP_NULL && limit > 0)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_sweep_cp));
+
+    /* The list is updated first, since native free callbacks might trigger another sweep. */
+    JERRY_CONTEXT (ecma_gc_sweep_cp) = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+
+    ecma_gc_free_object (obj_iter_p);
+    limit--;
+  }
+} /* ecma_gc_sweep */
+
+#if JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER
+
+/**
+ * Remove the weak references to unreachable objects, so they cannot be accessed
+ * through WeakRef and container objects before they are freed.
+ */
+static void
+ecma_gc_clear_unreachable_weak_refs (jmem_cpointer_t obj_iter_cp) /**< first unreachable object */
+{
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+
+    /* Weak references are never created to lexical environments or fast arrays. */
+    if (ecma_is_lexical_environment (obj_iter_p)
+        || ecma_op_object_is_fast_array (obj_iter_p))
+    {
+      continue;
+    }
+
+    jmem_cpointer_t prop_iter_cp = obj_iter_p->u1.property_list_cp;
+
+#if JERRY_PROPERTY_HASHMAP
+    if (prop_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+      if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+      {
+        prop_iter_cp = prop_iter_p->next_property_cp;
+      }
+    }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+    while (prop_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+      {
+        if (ECMA_PROPERTY_IS_INTERNAL (property_pair_p->header.types[index])
+            && property_pair_p->names_cp[index] == LIT_INTERNAL_MAGIC_STRING_WEAK_REFS)
+        {
+          ecma_collection_t *refs_p;
+          refs_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_collection_t, property_pair_p->values[index].value);
+          ecma_gc_clear_weak_refs (obj_iter_p, refs_p);
+        }
+      }
+
+      prop_iter_cp = prop_iter_p->next_property_cp;
+    }
+  }
+} /* ecma_gc_clear_unreachable_weak_refs */
+
+#endif /* JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER */
+
+/**
+ * Start an incremental garbage collection.
+ *
+ * The root objects (i.e. they have global or stack references) are moved to the front
+ * of the object list, and the other objects are set to white (non-visited). The objects
+ * created during the marking are prepended to the list, and they are not visited.
+ */
+static void
+ecma_gc_start_marking (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_sweep_cp) == JMEM_CP_NULL);
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING));
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  ecma_object_t root_list_head;
+  ecma_object_t *root_end_p = &root_list_head;
+
+  ecma_object_t white_list_head;
+  ecma_object_t *white_end_p = &white_list_head;
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      root_end_p->gc_next_cp = obj_iter_cp;
+      root_end_p = obj_iter_p;
+    }
+    else
+    {
+      obj_iter_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+      white_end_p->gc_next_cp = obj_iter_cp;
+      white_end_p = obj_iter_p;
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  white_end_p->gc_next_cp = JMEM_CP_NULL;
+  root_end_p->gc_next_cp = (white_end_p != &white_list_head) ? white_list_head.gc_next_cp : JMEM_CP_NULL;
+
+  jmem_cpointer_t start_cp = (root_end_p != &root_list_head) ? root_list_head.gc_next_cp : root_end_p->gc_next_cp;
+
+  JERRY_CONTEXT (ecma_gc_objects_cp) = start_cp;
+  JERRY_CONTEXT (ecma_gc_mark_start_cp) = start_cp;
+  JERRY_CONTEXT (ecma_gc_mark_cursor_cp) = start_cp;
+  JERRY_CONTEXT (ecma_gc_mark_end_cp) = root_end_p->gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_mark_passes) = 0;
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_MARKING;
+} /* ecma_gc_start_marking */
+
+/**
+ * Continue the marking of an incremental garbage collection.
+ *
+ * The root objects are visited first, then the gray objects of the mark stack. When some
+ * gray objects could not be pushed onto the mark stack, all objects marked by the current
+ * collection are visited again.
+ *
+ * Objects created during the marking are black, but the engine may store references to
+ * white objects into them without taking a reference (e.g. the fast paths of the array
+ * builtins), so these objects are visited after the others. This is repeated until no
+ * new objects are created between two visits, and the last allowed repetition is not
+ * bounded by the limit, so the marking always finishes.
+ *
+ * @return true - if all reachable objects are marked
+ *         false - otherwise
+ */
+static bool
+ecma_gc_mark_step (uint32_t limit) /**< maximum number of visited objects */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING);
+
+#if (JERRY_GC_MARK_LIMIT != 0)
+  /* The references are not marked recursively, so the length of a step is bounded. */
+  JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = 0;
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+  bool is_finished = false;
+
+  while (limit > 0)
+  {
+    if (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+    {
+      uint32_t top = --JERRY_CONTEXT (ecma_gc_mark_stack_top);
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_mark_stack)[top]));
+      limit--;
+      continue;
+    }
+
+    if (JERRY_CONTEXT (ecma_gc_mark_cursor_cp) != JERRY_CONTEXT (ecma_gc_mark_end_cp))
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t,
+                                                                JERRY_CONTEXT (ecma_gc_mark_cursor_cp));
+      JERRY_CONTEXT (ecma_gc_mark_cursor_cp) = obj_iter_p->gc_next_cp;
+
+      if (ecma_gc_is_object_visited (obj_iter_p))
+      {
+        ecma_gc_mark (obj_iter_p);
+      }
+
+      limit--;
+      continue;
+    }
+
+    jmem_cpointer_t new_objects_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+    if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW)
+    {
+      /* Visit all marked objects again, including the newly created ones. */
+      JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
+      JERRY_CONTEXT (ecma_gc_mark_end_cp) = JMEM_CP_NULL;
+    }
+    else if (new_objects_cp != JERRY_CONTEXT (ecma_gc_mark_start_cp))
+    {
+      /* Visit the objects created since the previous visit. */
+      JERRY_CONTEXT (ecma_gc_mark_end_cp) = JERRY_CONTEXT (ecma_gc_mark_start_cp);
+    }
+    else
+    {
+      is_finished = true;
+      break;
+    }
+
+    JERRY_CONTEXT (ecma_gc_mark_start_cp) = new_objects_cp;
+    JERRY_CONTEXT (ecma_gc_mark_cursor_cp) = new_objects_cp;
+
+    if (++JERRY_CONTEXT (ecma_gc_mark_passes) >= ECMA_GC_MAX_MARK_PASSES)
+    {
+      /* No objects are created during this step, so the marking is finished by it. */
+      limit = UINT32_MAX;
+    }
+  }
+
+#if (JERRY_GC_MARK_LIMIT != 0)
+  JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = JERRY_GC_MARK_LIMIT;
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+  return is_finished;
+} /* ecma_gc_mark_step */
+
+/**
+ * Finish the marking of an incremental garbage collection, and move
+ * the unreachable (white) objects to the list of unfreed objects.
+ */
+static void
+ecma_gc_finish_marking (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARKING;
+
+  ecma_object_t black_list_head;
+  ecma_object_t *black_end_p = &black_list_head;
+
+  ecma_object_t white_list_head;
+  ecma_object_t *white_end_p = &white_list_head;
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      black_end_p->gc_next_cp = obj_iter_cp;
+      black_end_p = obj_iter_p;
+    }
+    else
+    {
+      white_end_p->gc_next_cp = obj_iter_cp;
+      white_end_p = obj_iter_p;
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  black_end_p->gc_next_cp = JMEM_CP_NULL;
+  white_end_p->gc_next_cp = JMEM_CP_NULL;
+
+  JERRY_CONTEXT (ecma_gc_objects_cp) = (black_end_p != &black_list_head) ? black_list_head.gc_next_cp : JMEM_CP_NULL;
+
+  jmem_cpointer_t white_cp = (white_end_p != &white_list_head) ? white_list_head.gc_next_cp : JMEM_CP_NULL;
+
+#if JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_HAS_WEAK_REFS)
+  {
+    ecma_gc_clear_unreachable_weak_refs (white_cp);
+  }
+#endif /* JERRY_BUILTIN_WEAKREF || JERRY_BUILTIN_CONTAINER */
+
+  JERRY_CONTEXT (ecma_gc_sweep_cp) = white_cp;
+} /* ecma_gc_finish_marking */
+
+/**
+ * Stop an unfinished incremental garbage collection, and
+ * restore the reference counts of the white objects.
+ */
+static void
+ecma_gc_abort_marking (void)
+{
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~(ECMA_STATUS_GC_MARKING | ECMA_STATUS_GC_MARK_OVERFLOW);
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (!ecma_gc_is_object_visited (obj_iter_p))
+    {
+      obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+} /* ecma_gc_abort_marking */
+
+/**
+ * Perform the next step of an incremental garbage collection, and
+ * start a new collection if no collection is in progress.
+ */
+static void
+ecma_gc_step (void)
+{
+#if JERRY_MEM_STATS
+  double start_time = jerry_port_get_current_time ();
+#endif /* JERRY_MEM_STATS */
+
+  if (JERRY_CONTEXT (ecma_gc_sweep_cp) != JMEM_CP_NULL)
+  {
+    /* Continue freeing the unreachable objects found by the previous marking. */
+    ecma_gc_sweep (JERRY_GC_STEP_LIMIT);
+  }
+  else
+  {
+    if (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING))
+    {
+      ecma_gc_start_marking ();
+    }
+
+    if (ecma_gc_mark_step (JERRY_GC_STEP_LIMIT))
+    {
+      ecma_gc_finish_marking ();
+    }
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_sweep_cp) != JMEM_CP_NULL || (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING))
+  {
+    /* Pace the steps by the allocations: a cycle visits about three times the number of
+     * objects (marking, visiting the new objects and sweeping), and it should finish
+     * before another GC limit worth of memory is allocated, otherwise the garbage kept
+     * alive by the unfinished cycle keeps growing the heap. */
+    size_t interval = (CONFIG_GC_LIMIT * JERRY_GC_STEP_LIMIT) / (3 * JERRY_CONTEXT (ecma_gc_objects_number) + 1);
+    jmem_heap_set_gc_step_interval (JERRY_MIN (JERRY_MAX (interval, JMEM_ALIGNMENT), CONFIG_GC_LIMIT));
+  }
+
+#if JERRY_MEM_STATS
+  jmem_stats_gc_pause (jerry_port_get_current_time () - start_time);
+#endif /* JERRY_MEM_STATS */
+} /* ecma_gc_step */
+
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
+/**
+ * Run garbage collection.
+ */
+static void
+ecma_gc_collect (void)
 {
 #if (JERRY_GC_MARK_LIMIT != 0)
   JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
 
+#if JERRY_MEM_STATS
+  double start_time = jerry_port_get_current_time ();
+#endif /* JERRY_MEM_STATS */
+
+#if (JERRY_GC_STEP_LIMIT != 0)
+  /* The marking algorithm expects that all objects are either alive or freed. */
+  ecma_gc_sweep (UINT32_MAX);
+
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING)
+  {
+    /* The objects created during the incremental marking are not visited, so a
+     * new collection is started, which can also free the unreachable new objects. */
+    ecma_gc_abort_marking ();
+  }
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
   JERRY_CONTEXT (ecma_gc_new_objects) = 0;
 
   ecma_object_t black_list_head;
@@ -2107,10 +2611,12 @@ ecma_gc_run (void)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     ecma_gc_mark (obj_iter_p);
+    ecma_gc_mark_stack_drain ();
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
+  /* Move the marked non-root objects to the black list. The list is scanned
+   * again only if the mark stack was full, and some objects were not marked. */
   bool marked_anything_during_current_iteration;
 
   do
@@ -2140,17 +2646,14 @@ ecma_gc_run (void)
         black_end_p->gc_next_cp = obj_iter_cp;
         black_end_p = obj_iter_p;
 
-#if (JERRY_GC_MARK_LIMIT != 0)
         if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
         {
           /* Set the reference count of non-marked gray object to 0 */
           obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
           ecma_gc_mark (obj_iter_p);
+          ecma_gc_mark_stack_drain ();
           marked_anything_during_current_iteration = true;
         }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-        marked_anything_during_current_iteration = true;
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
       }
       else
       {
@@ -2179,10 +2682,18 @@ ecma_gc_run (void)
     obj_iter_cp = obj_next_cp;
   }
 
-#if JERRY_BUILTIN_REGEXP
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc ();
-#endif /* JERRY_BUILTIN_REGEXP */
+#if JERRY_MEM_STATS
+  jmem_stats_gc_pause (jerry_port_get_current_time () - start_time);
+#endif /* JERRY_MEM_STATS */
+} /* ecma_gc_collect */
+
+/**
+ * Run garbage collection, freeing objects that are no longer referenced.
+ */
+void
+ecma_gc_run (void)
+{
+  ecma_gc_collect ();
 } /* ecma_gc_run */
 
 /**
@@ -2211,6 +2722,17 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
     JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HIGH_PRESSURE_GC;
 #endif /* JERRY_PROPERTY_HASHMAP */
+
+#if (JERRY_GC_STEP_LIMIT != 0)
+    if (JERRY_CONTEXT (ecma_gc_sweep_cp) != JMEM_CP_NULL
+        || (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARKING))
+    {
+      /* Continue the incremental garbage collection. */
+      ecma_gc_step ();
+      return;
+    }
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
     /*
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
@@ -2219,7 +2741,11 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
-      ecma_gc_run ();
+#if (JERRY_GC_STEP_LIMIT != 0)
+      ecma_gc_step ();
+#else /* (JERRY_GC_STEP_LIMIT == 0) */
+      ecma_gc_collect ();
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
     }
 
     return;
@@ -2239,6 +2765,16 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_BUILTIN_REGEXP
+    /* Free RegExp bytecodes stored in cache */
+    re_cache_gc ();
+#endif /* JERRY_BUILTIN_REGEXP */
+
+#if JERRY_BUILTIN_PROMISE
+    /* Free the ring buffer of an empty job queue. */
+    ecma_job_queue_free_unused_memory ();
+#endif /* JERRY_BUILTIN_PROMISE */
+
     ecma_gc_run ();
 
 #if JERRY_PROPERTY_HASHMAP
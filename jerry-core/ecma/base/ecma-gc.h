@@ -34,6 +34,9 @@ typedef enum
   ECMA_GC_FREE_NO_OPTIONS = 0, /**< no options */
   ECMA_GC_FREE_SECOND_PROPERTY = (1 << 0), /**< free second property of a property pair */
   ECMA_GC_FREE_REFERENCES = (1 << 1), /**< free references */
+#if JERRY_PROPERTY_SHAPES
+  ECMA_GC_FREE_SHAPED_PROPERTY = (1 << 2), /**< property of a shaped object, which name is owned by the shape */
+#endif /* JERRY_PROPERTY_SHAPES */
 } ecma_gc_free_options_t;
 
 void ecma_init_gc_info (ecma_object_t *object_p);
@@ -63,6 +63,11 @@ typedef enum
   ECMA_STATUS_EXCEPTION         = (1u << 3), /**< last exception is a normal exception */
   ECMA_STATUS_ABORT             = (1u << 4), /**< last exception is an abort */
   ECMA_STATUS_ERROR_UPDATE      = (1u << 5), /**< the error_object_created_callback_p is called */
+#if (JERRY_GC_STEP_LIMIT != 0)
+  ECMA_STATUS_HAS_WEAK_REFS     = (1u << 6), /**< weak references to objects have been created */
+  ECMA_STATUS_GC_MARKING        = (1u << 7), /**< an incremental garbage collection is marking the objects */
+  ECMA_STATUS_GC_MARK_OVERFLOW  = (1u << 8), /**< gray objects could not be pushed onto the mark stack */
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
 } ecma_status_flag_t;
 
 /**
@@ -128,6 +133,33 @@ typedef enum
 #endif /* !JERRY_NDEBUG */
 } ecma_parse_opts_t;
 
+#if JERRY_NAN_BOXING
+
+/**
+ * Description of an ecma value
+ *
+ * Values below ECMA_VALUE_NAN_BOX_OFFSET have the same bit-field structure
+ * as 32 bit values: type (3) | value (29). Other values are NaN-boxed
+ * floating point numbers.
+ */
+typedef uint64_t ecma_value_t;
+
+/**
+ * Offset added to the bit pattern of NaN-boxed floating point numbers
+ *
+ * Note:
+ *      NaN values are canonicalized before boxing, so no
+ *      boxed number can overflow the 64 bit range.
+ */
+#define ECMA_VALUE_NAN_BOX_OFFSET (((ecma_value_t) 1) << 49)
+
+/**
+ * Mask for the bits which are never set in values that are not NaN-boxed
+ */
+#define ECMA_VALUE_NAN_BOX_MASK (~((ecma_value_t) UINT32_MAX))
+
+#else /* !JERRY_NAN_BOXING */
+
 /**
  * Description of an ecma value
  *
@@ -135,6 +167,13 @@ typedef enum
  */
 typedef uint32_t ecma_value_t;
 
+/**
+ * Mask for the bits which are never set in values that are not NaN-boxed
+ */
+#define ECMA_VALUE_NAN_BOX_MASK 0u
+
+#endif /* JERRY_NAN_BOXING */
+
 /**
  * Type for directly encoded integer numbers in JerryScript.
  */
@@ -498,7 +537,8 @@ typedef struct
   ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot. The first represent
                                                          *   the type of this property (e.g. property pair) */
 #if JERRY_CPOINTER_32_BIT
-  uint16_t padding; /**< an unused value */
+  uint16_t shape_id; /**< property shape of the object if this is its first property pair,
+                      *   0 for dictionary objects (see JERRY_PROPERTY_SHAPES) */
 #else /* !JERRY_CPOINTER_32_BIT */
   jmem_cpointer_t next_property_cp; /**< next cpointer */
 #endif /* JERRY_CPOINTER_32_BIT */
@@ -536,6 +576,28 @@ typedef struct
   jmem_cpointer_t names_cp[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property name slots */
 } ecma_property_pair_t;
 
+#if JERRY_PROPERTY_SHAPES
+
+/**
+ * Property shape.
+ *
+ * A shape describes the property names of the objects whose properties were created in the
+ * same order. The property pairs of these objects have no name slots, and the shape id is
+ * stored in the header of their first property pair.
+ */
+typedef struct
+{
+  uint32_t refs; /**< number of objects and child shapes which use this shape */
+  jmem_cpointer_t names_cp; /**< property_count property names in creation order,
+                             *   followed by their property_count name types */
+  uint16_t parent_id; /**< shape which has all properties of this shape except the last one */
+  uint16_t first_child_id; /**< first shape which extends this shape with one property */
+  uint16_t next_sibling_id; /**< next child shape of the parent shape, or the next unused shape */
+  uint16_t property_count; /**< number of properties */
+} ecma_property_shape_t;
+
+#endif /* JERRY_PROPERTY_SHAPES */
+
 /**
  * Get property name type.
  */
@@ -598,6 +660,19 @@ typedef struct
 #define ECMA_PROPERTY_IS_NAMED_PROPERTY(property) \
   ((property) < ECMA_PROPERTY_TYPE_HASHMAP || (property) >= ECMA_PROPERTY_INTERNAL)
 
+#if JERRY_NAN_BOXING
+
+/**
+ * Compute the property data pointer of a property from the start of its
+ * property pair, which is aligned to JMEM_ALIGNMENT.
+ */
+#define ECMA_PROPERTY_VALUE_DATA_PTR(property_p) \
+  ((((uintptr_t) (property_p)) & ~((uintptr_t) JMEM_ALIGNMENT - 1)) \
+   + offsetof (ecma_property_pair_t, values) \
+   + (((uintptr_t) (property_p)) & 0x1) * sizeof (ecma_property_value_t))
+
+#else /* !JERRY_NAN_BOXING */
+
 /**
  * Add the offset part to a property for computing its property data pointer.
  */
@@ -610,6 +685,8 @@ typedef struct
 #define ECMA_PROPERTY_VALUE_DATA_PTR(property_p) \
   (ECMA_PROPERTY_VALUE_ADD_OFFSET (property_p) & ~(sizeof (ecma_property_value_t) - 1))
 
+#endif /* JERRY_NAN_BOXING */
+
 /**
  * Compute the property data pointer of a property.
  * The property must be part of a property pair.
@@ -875,6 +952,18 @@ typedef uint16_t ecma_object_descriptor_t;
  */
 #define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
 
+/**
+ * Maximum number of gray objects stored in the mark stack of the garbage collector.
+ *
+ * Incremental collections use a larger stack, since the references are never marked
+ * recursively, and the objects referenced between the steps are pushed onto it as well.
+ */
+#if (JERRY_GC_STEP_LIMIT != 0)
+#define ECMA_GC_MARK_STACK_SIZE 256
+#else /* (JERRY_GC_STEP_LIMIT == 0) */
+#define ECMA_GC_MARK_STACK_SIZE 64
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -1251,11 +1340,16 @@ typedef struct
  */
 #define ECMA_CONTAINER_PAIR_SIZE 2
 
+/**
+ * Number of header items (size and hash index) of the internal buffer (in ecma_value_t unit).
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Size of the internal buffer.
  */
 #define ECMA_CONTAINER_GET_SIZE(container_p) \
-  (container_p->buffer_p[0])
+  ((uint32_t) container_p->buffer_p[0])
 
 /**
  * Remove the size field of the internal buffer.
@@ -1263,17 +1357,41 @@ typedef struct
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) \
   (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Hash index of the internal buffer. Result can be NULL.
+ */
+#define ECMA_CONTAINER_GET_HASH_INDEX(container_p) \
+  ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, container_p->buffer_p[1])
+
+/**
+ * Set the hash index of the internal buffer. Pointer can be NULL.
+ */
+#define ECMA_CONTAINER_SET_HASH_INDEX(container_p, index_p) \
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (container_p->buffer_p[1], index_p)
+
 /**
  * Number of entries of the internal buffer.
  */
 #define ECMA_CONTAINER_ENTRY_COUNT(collection_p) \
-  (collection_p->item_count - 1)
+  (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
 #define ECMA_CONTAINER_START(collection_p) \
-  (collection_p->buffer_p + 1)
+  (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
+
+/**
+ * Hash index of the entries of an internal buffer.
+ *
+ * The header is followed by 'size' number of uint32_t slots. Each slot
+ * is either empty (0), deleted, or holds the offset of an entry plus one.
+ */
+typedef struct
+{
+  uint32_t size; /**< number of slots, always a power of 2 */
+  uint32_t used_count; /**< number of non-empty (including deleted) slots */
+} ecma_container_hash_index_t;
 
 #endif /* JERRY_BUILTIN_CONTAINER */
 
@@ -1695,8 +1813,10 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE_STRING, /**< the ecma-string is a concatenation which is flattened
+                                      *   into a long string when its characters are accessed */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE_STRING /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1798,6 +1918,36 @@ typedef struct
   jerry_value_free_callback_t free_cb; /**< free callback */
 } ecma_external_string_t;
 
+/**
+ * Rope string-value descriptor
+ *
+ * The string is the concatenation of the left string and the characters
+ * stored after the descriptor. The size, length and hash of the header are
+ * always valid, while header.string_p is NULL until the rope is flattened.
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header */
+  jmem_cpointer_t left_cp; /**< left string, released when the rope is flattened */
+  lit_utf8_size_t right_size; /**< size of the characters stored after the descriptor */
+} ecma_rope_string_t;
+
+/**
+ * Minimum size of a concatenation which is represented as a rope string,
+ * and the maximum size of the right side characters merged into one rope node
+ */
+#define ECMA_ROPE_STRING_MINIMUM_SIZE 256
+
+/**
+ * Last accessed code unit position of a non-ASCII string
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< string whose position is cached (NULL if the cache is empty) */
+  lit_utf8_size_t index; /**< code unit index */
+  lit_utf8_size_t offset; /**< byte offset of the code unit in the CESU-8 characters of the string */
+} ecma_string_index_cache_t;
+
 /**
  * Header size of an ecma ASCII string
  */
@@ -1834,6 +1984,12 @@ typedef struct
 #define ECMA_LONG_STRING_BUFFER_START(string_p) \
   ((lit_utf8_byte_t *) (string_p) + sizeof (ecma_long_string_t))
 
+/**
+ * Get the start position of the right side characters of an ecma rope string
+ */
+#define ECMA_ROPE_STRING_BUFFER_START(string_p) \
+  ((lit_utf8_byte_t *) (string_p) + sizeof (ecma_rope_string_t))
+
 /**
  * ECMA extended string-value descriptor
  */
@@ -1874,6 +2030,7 @@ typedef struct
 typedef struct
 {
   ecma_stringbuilder_header_t *header_p; /**< pointer to header */
+  lit_utf8_size_t capacity; /**< allocated size of the buffer (including the header) */
 } ecma_stringbuilder_t;
 
 /**
@@ -1930,6 +2087,24 @@ typedef struct
  */
 #define ECMA_PROP_HASHMAP_ALLOC_MAX 4
 
+#if JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1
+
+/**
+ * Number of objects whose long linear property lookups are counted.
+ */
+#define ECMA_PROP_HASHMAP_LOOKUP_CACHE_SIZE 8
+
+/**
+ * Long linear property lookup counter of an object without a property hashmap.
+ */
+typedef struct
+{
+  jmem_cpointer_t object_cp; /**< object */
+  uint8_t count; /**< number of long lookups */
+} ecma_prop_hashmap_lookup_t;
+
+#endif /* JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1 */
+
 #endif /* JERRY_PROPERTY_HASHMAP */
 
 /**
@@ -1946,6 +2121,26 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_lit_storage_item_t;
 
+#if JERRY_LIT_HASH_TABLE
+
+/**
+ * Minimum number of literals in a literal list before a hash table index is created for it
+ * (must be a power of 2).
+ */
+#define ECMA_LIT_HASH_TABLE_MIN_COUNT 64
+
+/**
+ * Hash table index of a literal list
+ */
+typedef struct
+{
+  jmem_cpointer_t *buckets_p; /**< buckets of the hash table, NULL if the table is not allocated */
+  uint32_t mask; /**< number of buckets - 1 */
+  uint32_t count; /**< number of literals in the literal list */
+} ecma_lit_hash_table_t;
+
+#endif /* JERRY_LIT_HASH_TABLE */
+
 #if JERRY_LCACHE
 /**
  * Container of an LCache entry identifier
@@ -2442,6 +2637,25 @@ typedef struct
 
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_BUILTIN_DATE
+
+/**
+ * Number of intervals stored in the local time zone adjustment cache
+ */
+#define ECMA_DATE_TZA_CACHE_SIZE 4
+
+/**
+ * Interval of UTC time values which have the same local time zone adjustment
+ */
+typedef struct
+{
+  ecma_number_t start; /**< first time value of the interval */
+  ecma_number_t end; /**< first time value after the interval (equals to start if the entry is unused) */
+  ecma_number_t tza; /**< local time zone adjustment */
+} ecma_date_tza_interval_t;
+
+#endif /* JERRY_BUILTIN_DATE */
+
 /**
  * @}
  * @}
@@ -19,6 +19,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -118,6 +119,80 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+#if JERRY_ROPE_STRINGS
+
+/**
+ * Copy the characters of a rope string into a single buffer and release its left string.
+ *
+ * Note:
+ *   the characters are copied backwards while walking down the left side of the rope,
+ *   so the rope is flattened without recursion and without intermediate strings
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_rope_string_flatten (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  if (rope_p->header.string_p != NULL)
+  {
+    return;
+  }
+
+  lit_utf8_size_t position = rope_p->header.size;
+  lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (position);
+  ecma_rope_string_t *current_p = rope_p;
+  ecma_string_t *left_p;
+
+  while (true)
+  {
+    JERRY_ASSERT (position >= current_p->right_size);
+
+    position -= current_p->right_size;
+    memcpy (buffer_p + position, ECMA_ROPE_STRING_BUFFER_START (current_p), current_p->right_size);
+
+    left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, current_p->left_cp);
+
+    if (ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE_STRING
+        || ((ecma_rope_string_t *) left_p)->header.string_p != NULL)
+    {
+      break;
+    }
+
+    current_p = (ecma_rope_string_t *) left_p;
+  }
+
+  const lit_utf8_byte_t *left_chars_p;
+
+  switch (ECMA_STRING_GET_CONTAINER (left_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      left_chars_p = ECMA_SHORT_STRING_GET_BUFFER (left_p);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    {
+      left_chars_p = ECMA_ASCII_STRING_GET_BUFFER (left_p);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (left_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+                    || ECMA_STRING_GET_CONTAINER (left_p) == ECMA_STRING_CONTAINER_ROPE_STRING);
+      left_chars_p = ((ecma_long_string_t *) left_p)->string_p;
+      break;
+    }
+  }
+
+  memcpy (buffer_p, left_chars_p, position);
+
+  left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+  rope_p->header.string_p = buffer_p;
+  rope_p->left_cp = JMEM_CP_NULL;
+
+  ecma_deref_ecma_string_non_direct (left_p);
+} /* ecma_rope_string_flatten */
+
+#endif /* JERRY_ROPE_STRINGS */
+
 /**
  * Returns the characters and size of a string.
  *
@@ -159,6 +234,13 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ((ecma_short_string_t *) string_p)->size;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if JERRY_ROPE_STRINGS
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_flatten ((ecma_rope_string_t *) string_p);
+      /* FALLTHRU */
+    }
+#endif /* JERRY_ROPE_STRINGS */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -683,6 +765,116 @@ ecma_get_internal_string (lit_magic_string_id_t id) /**< identifier of magic str
   return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_SPECIAL, (uintptr_t) id);
 } /* ecma_get_internal_string */
 
+#if JERRY_ROPE_STRINGS
+
+/**
+ * Append a cesu8 string after an ecma-string by creating a rope string
+ *
+ * Note:
+ *   The string1_p argument is referenced or freed by the rope string when it is created.
+ *
+ * @return rope string - if the concatenation is represented as a rope string
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_append_chars_to_rope_string (ecma_string_t *string1_p, /**< base ecma-string */
+                                  const lit_utf8_byte_t *cesu8_string2_p, /**< characters to be appended */
+                                  lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                                  lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  /* External magic strings can be arbitrarily long, so the result must be checked against them. */
+  if (ECMA_IS_DIRECT_STRING (string1_p) || lit_get_magic_string_ex_count () > 0)
+  {
+    return NULL;
+  }
+
+  lit_utf8_size_t cesu8_string1_size;
+  lit_utf8_size_t cesu8_string1_length;
+
+  switch (ECMA_STRING_GET_CONTAINER (string1_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      ecma_short_string_t *short_string_p = (ecma_short_string_t *) string1_p;
+      cesu8_string1_size = short_string_p->size;
+      cesu8_string1_length = short_string_p->length;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_long_string_t *long_string_p = (ecma_long_string_t *) string1_p;
+      cesu8_string1_size = long_string_p->size;
+      cesu8_string1_length = long_string_p->length;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    {
+      cesu8_string1_size = ECMA_ASCII_STRING_GET_SIZE (string1_p);
+      cesu8_string1_length = cesu8_string1_size;
+      break;
+    }
+    default:
+    {
+      return NULL;
+    }
+  }
+
+  lit_utf8_size_t new_size = cesu8_string1_size + cesu8_string2_size;
+
+  /* Overflows are reported by the caller. */
+  if (new_size < ECMA_ROPE_STRING_MINIMUM_SIZE || new_size < cesu8_string1_size)
+  {
+    return NULL;
+  }
+
+  /* The result cannot be a magic string or an array index. */
+  JERRY_ASSERT (new_size > lit_get_magic_string_size (LIT_NON_INTERNAL_MAGIC_STRING__COUNT - 1));
+
+  ecma_string_t *left_p = string1_p;
+  const lit_utf8_byte_t *left_right_p = NULL;
+  lit_utf8_size_t left_right_size = 0;
+
+  /* Short right sides are merged with the right side of an unflattened left rope, so
+   * appending small pieces creates one node per ECMA_ROPE_STRING_MINIMUM_SIZE bytes. */
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE_STRING
+      && ((ecma_rope_string_t *) string1_p)->header.string_p == NULL
+      && ((ecma_rope_string_t *) string1_p)->right_size + cesu8_string2_size <= ECMA_ROPE_STRING_MINIMUM_SIZE)
+  {
+    left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, ((ecma_rope_string_t *) string1_p)->left_cp);
+    left_right_p = ECMA_ROPE_STRING_BUFFER_START (string1_p);
+    left_right_size = ((ecma_rope_string_t *) string1_p)->right_size;
+    ecma_ref_ecma_string_non_direct (left_p);
+  }
+
+  lit_utf8_size_t right_size = left_right_size + cesu8_string2_size;
+  ecma_rope_string_t *rope_p;
+  rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t) + right_size);
+
+  rope_p->header.header.refs_and_container = ECMA_STRING_CONTAINER_ROPE_STRING | ECMA_STRING_REF_ONE;
+  rope_p->header.header.u.hash = lit_utf8_string_hash_combine (string1_p->u.hash,
+                                                               cesu8_string2_p,
+                                                               cesu8_string2_size);
+  rope_p->header.string_p = NULL;
+  rope_p->header.size = new_size;
+  rope_p->header.length = cesu8_string1_length + cesu8_string2_length;
+  ECMA_SET_NON_NULL_POINTER (rope_p->left_cp, left_p);
+  rope_p->right_size = right_size;
+
+  lit_utf8_byte_t *right_p = ECMA_ROPE_STRING_BUFFER_START (rope_p);
+
+  if (left_right_size > 0)
+  {
+    memcpy (right_p, left_right_p, left_right_size);
+    ecma_deref_ecma_string_non_direct (string1_p);
+  }
+
+  memcpy (right_p + left_right_size, cesu8_string2_p, cesu8_string2_size);
+  return (ecma_string_t *) rope_p;
+} /* ecma_append_chars_to_rope_string */
+
+#endif /* JERRY_ROPE_STRINGS */
+
 /**
  * Append a cesu8 string after an ecma-string
  *
@@ -705,6 +897,18 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
     return ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
   }
 
+#if JERRY_ROPE_STRINGS
+  ecma_string_t *rope_p = ecma_append_chars_to_rope_string (string1_p,
+                                                            cesu8_string2_p,
+                                                            cesu8_string2_size,
+                                                            cesu8_string2_length);
+
+  if (rope_p != NULL)
+  {
+    return rope_p;
+  }
+#endif /* JERRY_ROPE_STRINGS */
+
   lit_utf8_size_t cesu8_string1_size;
   lit_utf8_size_t cesu8_string1_length;
   uint8_t flags = ECMA_STRING_FLAG_IS_ASCII;
@@ -943,6 +1147,11 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
   JERRY_ASSERT ((string_p->refs_and_container < ECMA_STRING_REF_ONE) || ECMA_STRING_IS_STATIC (string_p));
 
+  if (JERRY_CONTEXT (string_index_cache).string_p == string_p)
+  {
+    JERRY_CONTEXT (string_index_cache).string_p = NULL;
+  }
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -984,6 +1193,47 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       return;
     }
 #endif /* JERRY_ESNEXT */
+#if JERRY_ROPE_STRINGS
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+      /* Unflattened left strings are released in a loop to avoid deep recursion. */
+      while (true)
+      {
+        if (rope_p->header.string_p != NULL)
+        {
+          jmem_heap_free_block ((void *) rope_p->header.string_p, rope_p->header.size);
+          ecma_dealloc_string_buffer ((ecma_string_t *) rope_p, sizeof (ecma_rope_string_t) + rope_p->right_size);
+          return;
+        }
+
+        string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+        ecma_dealloc_string_buffer ((ecma_string_t *) rope_p, sizeof (ecma_rope_string_t) + rope_p->right_size);
+
+        if (ECMA_STRING_GET_CONTAINER (string_p) != ECMA_STRING_CONTAINER_ROPE_STRING)
+        {
+          ecma_deref_ecma_string_non_direct (string_p);
+          return;
+        }
+
+        JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
+        string_p->refs_and_container -= ECMA_STRING_REF_ONE;
+
+        if (string_p->refs_and_container >= ECMA_STRING_REF_ONE)
+        {
+          return;
+        }
+
+        if (JERRY_CONTEXT (string_index_cache).string_p == string_p)
+        {
+          JERRY_CONTEXT (string_index_cache).string_p = NULL;
+        }
+
+        rope_p = (ecma_rope_string_t *) string_p;
+      }
+    }
+#endif /* JERRY_ROPE_STRINGS */
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1536,6 +1786,13 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = ECMA_SHORT_STRING_GET_BUFFER (short_string_p);
         break;
       }
+#if JERRY_ROPE_STRINGS
+      case ECMA_STRING_CONTAINER_ROPE_STRING:
+      {
+        ecma_rope_string_flatten ((ecma_rope_string_t *) string_p);
+        /* FALLTHRU */
+      }
+#endif /* JERRY_ROPE_STRINGS */
       case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
       {
         ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_p;
@@ -1791,6 +2048,21 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       size_and_length_p[1] = short_string_p->length;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if JERRY_ROPE_STRINGS
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_t *rope_string_p = (ecma_rope_string_t *) string_p;
+      size_and_length_p[0] = rope_string_p->header.size;
+      size_and_length_p[1] = rope_string_p->header.length;
+
+      if (rope_string_p->header.string_p == NULL)
+      {
+        /* Not flattened: the characters are compared by ecma_compare_rope_strings. */
+        return ECMA_ROPE_STRING_BUFFER_START (rope_string_p);
+      }
+      return rope_string_p->header.string_p;
+    }
+#endif /* JERRY_ROPE_STRINGS */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -1811,6 +2083,110 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
   }
 } /* ecma_compare_get_string_chars */
 
+#if JERRY_ROPE_STRINGS
+
+/**
+ * Checks whether a string is a rope string which is not flattened yet
+ *
+ * @return true - if the string is an unflattened rope string,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_compare_is_unflattened_rope (const ecma_string_t *string_p) /**< ecma-string */
+{
+  return (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING
+          && ((ecma_rope_string_t *) string_p)->header.string_p == NULL);
+} /* ecma_compare_is_unflattened_rope */
+
+/**
+ * Helper for ecma_compare_rope_strings to get the last character segment of a string
+ *
+ * Note:
+ *   the string is replaced by the left string of an unflattened rope,
+ *   and by NULL when the returned segment is the first segment of the string
+ *
+ * @return segment characters
+ */
+static const lit_utf8_byte_t *
+ecma_compare_get_rope_segment (const ecma_string_t **string_p_p, /**< [in, out] ecma-string */
+                               lit_utf8_size_t *segment_size_p) /**< [out] size of the segment */
+{
+  const ecma_string_t *string_p = *string_p_p;
+
+  JERRY_ASSERT (string_p != NULL);
+
+  if (ecma_compare_is_unflattened_rope (string_p))
+  {
+    ecma_rope_string_t *rope_string_p = (ecma_rope_string_t *) string_p;
+
+    *string_p_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_string_p->left_cp);
+    *segment_size_p = rope_string_p->right_size;
+    return ECMA_ROPE_STRING_BUFFER_START (rope_string_p);
+  }
+
+  lit_utf8_size_t size_and_length[2];
+  const lit_utf8_byte_t *chars_p = ecma_compare_get_string_chars (string_p, size_and_length);
+
+  JERRY_ASSERT (chars_p != NULL);
+
+  *string_p_p = NULL;
+  *segment_size_p = size_and_length[0];
+  return chars_p;
+} /* ecma_compare_get_rope_segment */
+
+/**
+ * Compare two strings with the same size when at least one of them is an unflattened rope
+ *
+ * Note:
+ *   the strings are compared segment by segment from their end, so the ropes
+ *   are not flattened: this comparison is used by property lookups, which
+ *   must not allocate memory because a garbage collection could free the
+ *   property hashmaps which are being searched
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_compare_rope_strings (const ecma_string_t *string1_p, /**< ecma-string */
+                           const ecma_string_t *string2_p, /**< ecma-string */
+                           lit_utf8_size_t size) /**< size of both strings */
+{
+  const lit_utf8_byte_t *segment1_p = NULL;
+  const lit_utf8_byte_t *segment2_p = NULL;
+  lit_utf8_size_t segment1_size = 0;
+  lit_utf8_size_t segment2_size = 0;
+
+  while (size > 0)
+  {
+    while (segment1_size == 0)
+    {
+      segment1_p = ecma_compare_get_rope_segment (&string1_p, &segment1_size);
+    }
+
+    while (segment2_size == 0)
+    {
+      segment2_p = ecma_compare_get_rope_segment (&string2_p, &segment2_size);
+    }
+
+    lit_utf8_size_t compare_size = JERRY_MIN (segment1_size, segment2_size);
+
+    JERRY_ASSERT (compare_size <= size);
+
+    segment1_size -= compare_size;
+    segment2_size -= compare_size;
+    size -= compare_size;
+
+    if (memcmp (segment1_p + segment1_size, segment2_p + segment2_size, compare_size) != 0)
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_compare_rope_strings */
+
+#endif /* JERRY_ROPE_STRINGS */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1841,6 +2217,13 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-st
     return false;
   }
 
+#if JERRY_ROPE_STRINGS
+  if (JERRY_UNLIKELY (ecma_compare_is_unflattened_rope (string1_p) || ecma_compare_is_unflattened_rope (string2_p)))
+  {
+    return ecma_compare_rope_strings (string1_p, string2_p, string1_size_and_length[0]);
+  }
+#endif /* JERRY_ROPE_STRINGS */
+
   return !memcmp ((char *) utf8_string1_p, (char *) utf8_string2_p, string1_size_and_length[0]);
 } /* ecma_compare_ecma_strings_longpath */
 
@@ -2093,7 +2476,8 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->length;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     return ((ecma_long_string_t *) string_p)->length;
   }
@@ -2143,7 +2527,8 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_length_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
     lit_utf8_size_t size = long_string_p->size;
@@ -2153,6 +2538,13 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
       return size;
     }
 
+#if JERRY_ROPE_STRINGS
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
+    {
+      ecma_rope_string_flatten ((ecma_rope_string_t *) string_p);
+    }
+#endif /* JERRY_ROPE_STRINGS */
+
     return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
   }
 
@@ -2192,7 +2584,8 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->size;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     return ((ecma_long_string_t *) string_p)->size;
   }
@@ -2240,7 +2633,8 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_size_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
@@ -2249,6 +2643,13 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
       return long_string_p->size;
     }
 
+#if JERRY_ROPE_STRINGS
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
+    {
+      ecma_rope_string_flatten ((ecma_rope_string_t *) string_p);
+    }
+#endif /* JERRY_ROPE_STRINGS */
+
     return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
   }
 
@@ -2259,6 +2660,72 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
                                             lit_get_magic_string_ex_size (id));
 } /* ecma_string_get_utf8_size */
 
+/**
+ * Get the byte offset of a code unit in the CESU-8 characters of a string.
+ *
+ * The last computed position is cached, so sequential and nearby accesses
+ * of the same string walk only the characters between the two positions.
+ *
+ * @return byte offset of the code unit
+ */
+static lit_utf8_size_t
+ecma_string_get_code_unit_offset (const ecma_string_t *string_p, /**< ecma-string */
+                                  const lit_utf8_byte_t *data_p, /**< characters of the string */
+                                  lit_utf8_size_t size, /**< size of the characters */
+                                  lit_utf8_size_t length, /**< length of the string */
+                                  lit_utf8_size_t index) /**< code unit index (can be equal to length) */
+{
+  JERRY_ASSERT (index <= length);
+
+  ecma_string_index_cache_t *cache_p = &JERRY_CONTEXT (string_index_cache);
+  lit_utf8_size_t current_index = 0;
+  lit_utf8_size_t offset = 0;
+
+  if (cache_p->string_p == string_p)
+  {
+    current_index = cache_p->index;
+    offset = cache_p->offset;
+
+    if (index < current_index && index < current_index - index)
+    {
+      /* Walking from the start is shorter. */
+      current_index = 0;
+      offset = 0;
+    }
+  }
+
+  if (index > current_index && length - index < index - current_index)
+  {
+    /* Walking from the end is shorter. */
+    current_index = length;
+    offset = size;
+  }
+
+  while (current_index < index)
+  {
+    offset += lit_get_unicode_char_size_by_utf8_first_byte (data_p[offset]);
+    current_index++;
+  }
+
+  while (current_index > index)
+  {
+    do
+    {
+      offset--;
+    }
+    while ((data_p[offset] & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER);
+
+    current_index--;
+  }
+
+  JERRY_ASSERT (offset <= size);
+
+  cache_p->string_p = string_p;
+  cache_p->index = index;
+  cache_p->offset = offset;
+  return offset;
+} /* ecma_string_get_code_unit_offset */
+
 /**
  * Get character from specified position in an external ecma-string.
  *
@@ -2339,8 +2806,22 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      ecma_char_t code_unit;
+      lit_read_code_unit_from_cesu8 (data_p + ecma_string_get_code_unit_offset (string_p,
+                                                                                data_p,
+                                                                                size,
+                                                                                short_string_p->length,
+                                                                                index),
+                                     &code_unit);
+      return code_unit;
     }
+#if JERRY_ROPE_STRINGS
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_flatten ((ecma_rope_string_t *) string_p);
+      /* FALLTHRU */
+    }
+#endif /* JERRY_ROPE_STRINGS */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -2352,7 +2833,14 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      ecma_char_t code_unit;
+      lit_read_code_unit_from_cesu8 (data_p + ecma_string_get_code_unit_offset (string_p,
+                                                                                data_p,
+                                                                                size,
+                                                                                long_string_p->length,
+                                                                                index),
+                                     &code_unit);
+      return code_unit;
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     {
@@ -2445,18 +2933,18 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
   }
   else
   {
-    while (start_pos--)
-    {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-    }
-
-    const lit_utf8_byte_t *end_p = start_p;
-    while (end_pos--)
-    {
-      end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-    }
+    lit_utf8_size_t start_offset = ecma_string_get_code_unit_offset (string_p,
+                                                                     start_p,
+                                                                     buffer_size,
+                                                                     string_length,
+                                                                     start_pos);
+    lit_utf8_size_t end_offset = ecma_string_get_code_unit_offset (string_p,
+                                                                   start_p,
+                                                                   buffer_size,
+                                                                   string_length,
+                                                                   start_pos + end_pos);
 
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_offset, end_offset - start_offset);
   }
 
   ECMA_FINALIZE_UTF8_STRING (start_p, buffer_size);
@@ -2688,7 +3176,7 @@ ecma_stringbuilder_create (void)
   jmem_stats_allocate_string_bytes (initial_size);
 #endif /* JERRY_MEM_STATS */
 
-  ecma_stringbuilder_t ret = {.header_p = header_p};
+  ecma_stringbuilder_t ret = {.header_p = header_p, .capacity = initial_size};
   return ret;
 } /* ecma_stringbuilder_create */
 
@@ -2714,7 +3202,7 @@ ecma_stringbuilder_create_from (ecma_string_t *string_p) /**< ecma string */
                                                          string_size);
   JERRY_ASSERT (copied_size == string_size);
 
-  ecma_stringbuilder_t ret = {.header_p = header_p};
+  ecma_stringbuilder_t ret = {.header_p = header_p, .capacity = initial_size};
   return ret;
 } /* ecma_stringbuilder_create_from */
 
@@ -2737,32 +3225,61 @@ ecma_stringbuilder_create_raw (const lit_utf8_byte_t *data_p, /**< pointer to da
 
   memcpy (ECMA_STRINGBUILDER_STRING_PTR (header_p), data_p, data_size);
 
-  ecma_stringbuilder_t ret = {.header_p = header_p};
+  ecma_stringbuilder_t ret = {.header_p = header_p, .capacity = initial_size};
   return ret;
 } /* ecma_stringbuilder_create_raw */
 
+/**
+ * Resize the underlying buffer of a string builder
+ */
+static void
+ecma_stringbuilder_resize (ecma_stringbuilder_t *builder_p, /**< string builder */
+                           lit_utf8_size_t new_capacity) /**< new allocated size of the buffer */
+{
+  JERRY_ASSERT (new_capacity >= builder_p->header_p->current_size);
+
+  builder_p->header_p = jmem_heap_realloc_block (builder_p->header_p, builder_p->capacity, new_capacity);
+
+#if JERRY_MEM_STATS
+  if (new_capacity > builder_p->capacity)
+  {
+    jmem_stats_allocate_string_bytes (new_capacity - builder_p->capacity);
+  }
+  else
+  {
+    jmem_stats_free_string_bytes (builder_p->capacity - new_capacity);
+  }
+#endif /* JERRY_MEM_STATS */
+
+  builder_p->capacity = new_capacity;
+} /* ecma_stringbuilder_resize */
+
 /**
  * Grow the underlying buffer of a string builder
  *
+ * Note:
+ *      the buffer grows geometrically, so appending many small pieces
+ *      does not reallocate the buffer for each of them
+ *
  * @return pointer to the end of the data in the underlying buffer
  */
 static lit_utf8_byte_t *
 ecma_stringbuilder_grow (ecma_stringbuilder_t *builder_p, /**< string builder */
                          lit_utf8_size_t required_size) /**< required size */
 {
-  ecma_stringbuilder_header_t *header_p = builder_p->header_p;
-  JERRY_ASSERT (header_p != NULL);
+  JERRY_ASSERT (builder_p->header_p != NULL);
 
-  const lit_utf8_size_t new_size = header_p->current_size + required_size;
-  header_p = jmem_heap_realloc_block (header_p, header_p->current_size, new_size);
-  header_p->current_size = new_size;
-  builder_p->header_p = header_p;
+  const lit_utf8_size_t new_size = builder_p->header_p->current_size + required_size;
 
-#if JERRY_MEM_STATS
-  jmem_stats_allocate_string_bytes (required_size);
-#endif /* JERRY_MEM_STATS */
+  if (JERRY_UNLIKELY (new_size > builder_p->capacity))
+  {
+    ecma_stringbuilder_resize (builder_p, new_size + (new_size >> 1));
+  }
+
+  ecma_stringbuilder_header_t *header_p = builder_p->header_p;
+  header_p->current_size = new_size;
 
-  return ((lit_utf8_byte_t *)  header_p) + header_p->current_size - required_size;
+  return ((lit_utf8_byte_t *) header_p) + new_size - required_size;
 } /* ecma_stringbuilder_grow */
 
 /**
@@ -2806,13 +3323,8 @@ ecma_stringbuilder_revert (ecma_stringbuilder_t *builder_p, /**< string builder
   const lit_utf8_size_t new_size = size + ECMA_ASCII_STRING_HEADER_SIZE;
   JERRY_ASSERT (new_size <= header_p->current_size);
 
-#if JERRY_MEM_STATS
-  jmem_stats_free_string_bytes (header_p->current_size - new_size);
-#endif /* JERRY_MEM_STATS */
-
-  header_p = jmem_heap_realloc_block (header_p, header_p->current_size, new_size);
+  /* The buffer is kept, since the builder is likely to grow again. */
   header_p->current_size = new_size;
-  builder_p->header_p = header_p;
 } /* ecma_stringbuilder_revert */
 
 /**
@@ -2916,6 +3428,13 @@ ecma_stringbuilder_finalize (ecma_stringbuilder_t *builder_p) /**< string builde
     return string_p;
   }
 
+  if (builder_p->capacity != header_p->current_size)
+  {
+    ecma_stringbuilder_resize (builder_p, header_p->current_size);
+    header_p = builder_p->header_p;
+    string_begin_p = ECMA_STRINGBUILDER_STRING_PTR (header_p);
+  }
+
 #ifndef JERRY_NDEBUG
   builder_p->header_p = NULL;
 #endif
@@ -2981,7 +3500,7 @@ void
 ecma_stringbuilder_destroy (ecma_stringbuilder_t *builder_p) /**< string builder */
 {
   JERRY_ASSERT (builder_p->header_p != NULL);
-  const lit_utf8_size_t size = builder_p->header_p->current_size;
+  const lit_utf8_size_t size = builder_p->capacity;
   jmem_heap_free_block (builder_p->header_p, size);
 
 #ifndef JERRY_NDEBUG
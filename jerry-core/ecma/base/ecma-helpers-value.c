@@ -45,8 +45,9 @@ JERRY_STATIC_ASSERT (sizeof (jmem_cpointer_t) <= sizeof (jmem_cpointer_tag_t),
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) <= sizeof (ecma_value_t),
                      uintptr_t_must_fit_in_ecma_value_t);
 
-#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+#elif !JERRY_NAN_BOXING /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
+/* NaN-boxed values are wider, but they store compressed pointers in their lower 32 bits. */
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (ecma_value_t),
                      uintptr_t_must_not_fit_in_ecma_value_t);
 
@@ -78,7 +79,14 @@ JERRY_STATIC_ASSERT (ECMA_NULL_POINTER == (ECMA_BIGINT_ZERO & ~(ecma_value_t) EC
 extern inline ecma_type_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_get_value_type_field (ecma_value_t value) /**< ecma value */
 {
-  return value & ECMA_VALUE_TYPE_MASK;
+#if JERRY_NAN_BOXING
+  if (value >= ECMA_VALUE_NAN_BOX_OFFSET)
+  {
+    return ECMA_TYPE_FLOAT;
+  }
+#endif /* JERRY_NAN_BOXING */
+
+  return (ecma_type_t) (value & ECMA_VALUE_TYPE_MASK);
 } /* ecma_get_value_type_field */
 
 /**
@@ -143,7 +151,7 @@ ecma_is_value_direct (ecma_value_t value) /**< ecma value */
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_simple (ecma_value_t value) /**< ecma value */
 {
-  return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+  return (value & (ECMA_DIRECT_TYPE_MASK | ECMA_VALUE_NAN_BOX_MASK)) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
 } /* ecma_is_value_simple */
 
 /**
@@ -264,7 +272,7 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
 {
-  return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return (value & (ECMA_DIRECT_TYPE_MASK | ECMA_VALUE_NAN_BOX_MASK)) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
 } /* ecma_is_value_integer_number */
 
 /**
@@ -280,7 +288,8 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
   JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
                        ecma_direct_type_integer_value_must_be_zero);
 
-  return ((first_value | second_value) & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return (((first_value | second_value) & (ECMA_DIRECT_TYPE_MASK | ECMA_VALUE_NAN_BOX_MASK))
+          == ECMA_DIRECT_TYPE_INTEGER_VALUE);
 } /* ecma_are_values_integer_numbers */
 
 /**
@@ -320,7 +329,7 @@ JERRY_STATIC_ASSERT ((ECMA_TYPE_STRING | 0x4) == ECMA_TYPE_DIRECT_STRING,
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_string (ecma_value_t value) /**< ecma value */
 {
-  return ((value & (ECMA_VALUE_TYPE_MASK - 0x4)) == ECMA_TYPE_STRING);
+  return ((value & ((ECMA_VALUE_TYPE_MASK - 0x4) | ECMA_VALUE_NAN_BOX_MASK)) == ECMA_TYPE_STRING);
 } /* ecma_is_value_string */
 
 /**
@@ -513,7 +522,7 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 {
   JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
 
-  return (((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return (ecma_value_t) ((((uint32_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE);
 } /* ecma_make_integer_value */
 
 /**
@@ -524,13 +533,28 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 static ecma_value_t
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#if JERRY_NAN_BOXING
+  ecma_number_accessor_t u;
+  u.as_ecma_number_t = ecma_number;
+
+  if (JERRY_UNLIKELY (ecma_number_is_nan (ecma_number)))
+  {
+    /* Negative NaNs would overflow the boxed range. */
+    u.as_ecma_number_t = ecma_number_make_nan ();
+  }
+
+  return u.as_uint64_t + ECMA_VALUE_NAN_BOX_OFFSET;
+#else /* !JERRY_NAN_BOXING */
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
 
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_create_float_number */
 
+#if !JERRY_NAN_BOXING
+
 /**
  * Encode float number without checks.
  *
@@ -542,6 +566,8 @@ ecma_make_float_value (ecma_number_t *ecma_num_p) /**< pointer to the float numb
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
 } /* ecma_make_float_value */
 
+#endif /* !JERRY_NAN_BOXING */
+
 /**
  * Create a new NaN value.
  *
@@ -747,7 +773,7 @@ ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_is_value_integer_number (value));
 
-  return ((ecma_integer_value_t) value) >> ECMA_DIRECT_SHIFT;
+  return ((ecma_integer_value_t) (uint32_t) value) >> ECMA_DIRECT_SHIFT;
 } /* ecma_get_integer_from_value */
 
 /**
@@ -760,9 +786,17 @@ ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
 
+#if JERRY_NAN_BOXING
+  ecma_number_accessor_t u;
+  u.as_uint64_t = value - ECMA_VALUE_NAN_BOX_OFFSET;
+  return u.as_ecma_number_t;
+#else /* !JERRY_NAN_BOXING */
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_get_float_from_value */
 
+#if !JERRY_NAN_BOXING
+
 /**
  * Get floating point value pointer from an ecma value
  *
@@ -776,6 +810,8 @@ ecma_get_pointer_from_float_value (ecma_value_t value) /**< ecma value */
   return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_pointer_from_float_value */
 
+#endif /* !JERRY_NAN_BOXING */
+
 /**
  * Get floating point value from an ecma value
  *
@@ -898,12 +934,16 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if JERRY_NAN_BOXING
+      return value;
+#else /* !JERRY_NAN_BOXING */
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_number_t *new_num_p = ecma_alloc_number ();
 
       *new_num_p = *num_p;
 
       return ecma_make_float_value (new_num_p);
+#endif /* JERRY_NAN_BOXING */
     }
 #if JERRY_ESNEXT
     case ECMA_TYPE_SYMBOL:
@@ -953,6 +993,13 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
 extern inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
 ecma_fast_copy_value (ecma_value_t value)  /**< value description */
 {
+#if JERRY_NAN_BOXING
+  if (value >= ECMA_VALUE_NAN_BOX_OFFSET)
+  {
+    return value;
+  }
+#endif /* JERRY_NAN_BOXING */
+
   return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT) ? value : ecma_copy_value (value);
 } /* ecma_fast_copy_value */
 
@@ -964,7 +1011,11 @@ ecma_fast_copy_value (ecma_value_t value)  /**< value description */
 extern inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
 ecma_copy_value_if_not_object (ecma_value_t value) /**< value description */
 {
-  if (!ecma_is_value_object (value))
+  if (!ecma_is_value_object (value)
+#if JERRY_NAN_BOXING
+      && value < ECMA_VALUE_NAN_BOX_OFFSET
+#endif /* JERRY_NAN_BOXING */
+      )
   {
     return ecma_copy_value (value);
   }
@@ -1018,6 +1069,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   {
     *value_p = ecma_value;
   }
+#if !JERRY_NAN_BOXING
   else if (ecma_is_value_float_number (ecma_value)
            && ecma_is_value_float_number (*value_p))
   {
@@ -1026,6 +1078,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
 
     *num_dst_p = *num_src_p;
   }
+#endif /* !JERRY_NAN_BOXING */
   else
   {
     ecma_free_value_if_not_object (*value_p);
@@ -1047,6 +1100,10 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 {
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
+#if JERRY_NAN_BOXING
+  JERRY_UNUSED (float_value);
+  return ecma_make_number_value (new_number);
+#else /* !JERRY_NAN_BOXING */
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
   ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
@@ -1060,6 +1117,7 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 
   *number_p = new_number;
   return float_value;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_update_float_number */
 
 /**
@@ -1072,6 +1130,7 @@ static void
 ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value */
                                 ecma_number_t ecma_number) /**< number to assign */
 {
+#if !JERRY_NAN_BOXING
   if (ecma_is_value_float_number (*value_p))
   {
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
@@ -1079,6 +1138,7 @@ ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value
     *num_dst_p = ecma_number;
     return;
   }
+#endif /* !JERRY_NAN_BOXING */
 
   if (ecma_get_value_type_field (*value_p) != ECMA_TYPE_DIRECT
       && ecma_get_value_type_field (*value_p) != ECMA_TYPE_OBJECT)
@@ -1127,8 +1187,10 @@ ecma_free_value (ecma_value_t value) /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if !JERRY_NAN_BOXING
       ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
+#endif /* !JERRY_NAN_BOXING */
       break;
     }
 #if JERRY_ESNEXT
@@ -1179,7 +1241,11 @@ ecma_free_value (ecma_value_t value) /**< value description */
 extern inline void JERRY_ATTR_ALWAYS_INLINE
 ecma_fast_free_value (ecma_value_t value) /**< value description */
 {
-  if (ecma_get_value_type_field (value) != ECMA_TYPE_DIRECT)
+  if (ecma_get_value_type_field (value) != ECMA_TYPE_DIRECT
+#if JERRY_NAN_BOXING
+      && value < ECMA_VALUE_NAN_BOX_OFFSET
+#endif /* JERRY_NAN_BOXING */
+      )
   {
     ecma_free_value (value);
   }
@@ -1191,7 +1257,11 @@ ecma_fast_free_value (ecma_value_t value) /**< value description */
 void
 ecma_free_value_if_not_object (ecma_value_t value) /**< value description */
 {
-  if (ecma_get_value_type_field (value) != ECMA_TYPE_OBJECT)
+  if (ecma_get_value_type_field (value) != ECMA_TYPE_OBJECT
+#if JERRY_NAN_BOXING
+      && value < ECMA_VALUE_NAN_BOX_OFFSET
+#endif /* JERRY_NAN_BOXING */
+      )
   {
     ecma_free_value (value);
   }
@@ -1214,11 +1284,15 @@ ecma_free_number (ecma_value_t value) /**< value description */
 {
   JERRY_ASSERT (ecma_is_value_number (value));
 
+#if JERRY_NAN_BOXING
+  JERRY_UNUSED (value);
+#else /* !JERRY_NAN_BOXING */
   if (ecma_is_value_float_number (value))
   {
     ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
     ecma_dealloc_number (number_p);
   }
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_free_number */
 
 /**
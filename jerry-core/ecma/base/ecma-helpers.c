@@ -21,6 +21,7 @@
 #include "ecma-lcache.h"
 #include "ecma-line-info.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-property-shape.h"
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
@@ -442,6 +443,19 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+#if JERRY_PROPERTY_SHAPES
+  ecma_property_value_t *shaped_value_p = ecma_property_shape_create_property (object_p,
+                                                                               name_p,
+                                                                               type_and_flags,
+                                                                               value,
+                                                                               out_prop_p);
+
+  if (shaped_value_p != NULL)
+  {
+    return shaped_value_p;
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -704,6 +718,23 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_PROPERTY_SHAPES
+  if (prop_iter_cp != JMEM_CP_NULL
+      && ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp)->shape_id != 0)
+  {
+    jmem_cpointer_t property_real_name_cp;
+    property_p = ecma_property_shape_find (obj_p, name_p, &property_real_name_cp);
+#if JERRY_LCACHE
+    if (property_p != NULL
+        && !ecma_is_property_lcached (property_p))
+    {
+      ecma_lcache_insert (obj_p, property_real_name_cp, property_p);
+    }
+#endif /* JERRY_LCACHE */
+    return property_p;
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
+
 #if JERRY_PROPERTY_HASHMAP
   uint32_t steps = 0;
 #endif /* JERRY_PROPERTY_HASHMAP */
@@ -794,7 +825,7 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 #if JERRY_PROPERTY_HASHMAP
   if (steps >= (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2))
   {
-    ecma_property_hashmap_create (obj_p);
+    ecma_property_hashmap_long_lookup (obj_p, steps);
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
@@ -834,6 +865,107 @@ ecma_get_named_data_property (ecma_object_t *obj_p, /**< object to find property
   return ECMA_PROPERTY_VALUE_PTR (property_p);
 } /* ecma_get_named_data_property */
 
+#if JERRY_PROPERTY_HASHMAP
+
+#if !JERRY_NAN_BOXING
+
+/**
+ * Property pairs are aligned to JMEM_ALIGNMENT and their two value slots are in
+ * different halves of an aligned block, so the index of a value slot can be
+ * computed from its address.
+ */
+JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) * 2 == JMEM_ALIGNMENT,
+                     size_of_two_property_values_must_be_equal_to_jmem_alignment);
+
+#endif /* !JERRY_NAN_BOXING */
+
+/**
+ * Delete the property referenced by its value pointer from an object which has a property hashmap.
+ *
+ * Note: the property pair is computed from the value pointer, so the property list is not searched,
+ *       and a pair whose both properties are deleted is freed later by the hashmap.
+ *       NaN-boxed values are as large as JMEM_ALIGNMENT, so the pair is searched in that case.
+ */
+static void
+ecma_delete_hashmap_property (ecma_object_t *object_p, /**< object */
+                              ecma_property_value_t *prop_value_p) /**< property value reference */
+{
+#if JERRY_NAN_BOXING
+  ecma_property_header_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                 object_p->u1.property_list_cp);
+  jmem_cpointer_t prop_iter_cp = hashmap_p->next_property_cp;
+  ecma_property_pair_t *prop_pair_p = NULL;
+  uint32_t index = 0;
+
+  while (prop_pair_p == NULL)
+  {
+    /* The property must be owned by the object. */
+    JERRY_ASSERT (prop_iter_cp != JMEM_CP_NULL);
+
+    ecma_property_pair_t *iter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t, prop_iter_cp);
+
+    for (index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+    {
+      if (iter_pair_p->values + index == prop_value_p)
+      {
+        prop_pair_p = iter_pair_p;
+        break;
+      }
+    }
+
+    prop_iter_cp = iter_pair_p->header.next_property_cp;
+  }
+
+  JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_pair_p->header.types[index]));
+#else /* !JERRY_NAN_BOXING */
+  uintptr_t values_offset = (uintptr_t) offsetof (ecma_property_pair_t, values);
+  uint32_t index = ((((uintptr_t) prop_value_p) - values_offset) & (JMEM_ALIGNMENT - 1)) != 0 ? 1 : 0;
+  ecma_property_pair_t *prop_pair_p;
+  prop_pair_p = (ecma_property_pair_t *) (((uint8_t *) (prop_value_p - index)) - values_offset);
+
+  JERRY_ASSERT (prop_pair_p->values + index == prop_value_p);
+  JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_pair_p->header.types[index]));
+
+#ifndef JERRY_NDEBUG
+  ecma_property_header_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                 object_p->u1.property_list_cp);
+  jmem_cpointer_t prop_iter_cp = hashmap_p->next_property_cp;
+
+  while (prop_iter_cp != JMEM_CP_NULL
+         && ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t, prop_iter_cp) != prop_pair_p)
+  {
+    prop_iter_cp = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp)->next_property_cp;
+  }
+
+  /* The property must be owned by the object. */
+  JERRY_ASSERT (prop_iter_cp != JMEM_CP_NULL);
+#endif /* !JERRY_NDEBUG */
+#endif /* JERRY_NAN_BOXING */
+
+  ecma_property_hashmap_delete_status hashmap_status;
+  hashmap_status = ecma_property_hashmap_delete (object_p,
+                                                 prop_pair_p->names_cp[index],
+                                                 prop_pair_p->header.types + index);
+
+  ecma_gc_free_property (object_p, prop_pair_p, index);
+  prop_pair_p->header.types[index] = ECMA_PROPERTY_TYPE_DELETED;
+  prop_pair_p->names_cp[index] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+  if (prop_pair_p->header.types[1 - index] == ECMA_PROPERTY_TYPE_DELETED)
+  {
+    ecma_property_hashmap_add_empty_pair (object_p);
+  }
+
+  if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP)
+  {
+    ecma_property_hashmap_shrink (object_p);
+  }
+} /* ecma_delete_hashmap_property */
+
+#endif /* JERRY_PROPERTY_HASHMAP */
+
 /**
  * Delete the object's property referenced by its value pointer.
  *
@@ -843,13 +975,19 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if JERRY_PROPERTY_SHAPES
+  if (ecma_property_shape_get_id (object_p) != 0)
+  {
+    /* The property pairs of shaped objects have no deleted entries. */
+    prop_value_p = ecma_property_shape_to_dictionary (object_p, prop_value_p);
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
 
 #if JERRY_PROPERTY_HASHMAP
-  ecma_property_hashmap_delete_status hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP;
-
   if (cur_prop_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *cur_prop_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
@@ -857,9 +995,8 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
 
     if (cur_prop_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
     {
-      prev_prop_p = cur_prop_p;
-      cur_prop_cp = cur_prop_p->next_property_cp;
-      hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
+      ecma_delete_hashmap_property (object_p, prop_value_p);
+      return;
     }
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
@@ -879,15 +1016,6 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
       {
         JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (cur_prop_p->types[i]));
 
-#if JERRY_PROPERTY_HASHMAP
-        if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP)
-        {
-          hashmap_status = ecma_property_hashmap_delete (object_p,
-                                                         prop_pair_p->names_cp[i],
-                                                         cur_prop_p->types + i);
-        }
-#endif /* JERRY_PROPERTY_HASHMAP */
-
         ecma_gc_free_property (object_p, prop_pair_p, i);
         cur_prop_p->types[i] = ECMA_PROPERTY_TYPE_DELETED;
         prop_pair_p->names_cp[i] = LIT_INTERNAL_MAGIC_STRING_DELETED;
@@ -896,14 +1024,7 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
 
         if (cur_prop_p->types[1 - i] != ECMA_PROPERTY_TYPE_DELETED)
         {
-#if JERRY_PROPERTY_HASHMAP
           /* The other property is still valid. */
-          if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
-          {
-            ecma_property_hashmap_free (object_p);
-            ecma_property_hashmap_create (object_p);
-          }
-#endif /* JERRY_PROPERTY_HASHMAP */
           return;
         }
 
@@ -919,14 +1040,6 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
         }
 
         ecma_dealloc_property_pair ((ecma_property_pair_t *) cur_prop_p);
-
-#if JERRY_PROPERTY_HASHMAP
-        if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
-        {
-          ecma_property_hashmap_free (object_p);
-          ecma_property_hashmap_create (object_p);
-        }
-#endif /* JERRY_PROPERTY_HASHMAP */
         return;
       }
     }
@@ -1315,6 +1428,36 @@ ecma_ref_extended_primitive (ecma_extended_primitive_t *primitve_p) /**< extende
   }
 } /* ecma_ref_extended_primitive */
 
+#if JERRY_NAN_BOXING
+
+/**
+ * Allocate an error reference. NaN-boxed values do not fit into pool chunks.
+ */
+#define ECMA_ALLOC_ERROR_REFERENCE() \
+  ((ecma_extended_primitive_t *) jmem_heap_alloc_block (sizeof (ecma_extended_primitive_t)))
+
+/**
+ * Free an error reference.
+ */
+#define ECMA_FREE_ERROR_REFERENCE(error_ref_p) \
+  jmem_heap_free_block ((error_ref_p), sizeof (ecma_extended_primitive_t))
+
+#else /* !JERRY_NAN_BOXING */
+
+/**
+ * Allocate an error reference.
+ */
+#define ECMA_ALLOC_ERROR_REFERENCE() \
+  ((ecma_extended_primitive_t *) jmem_pools_alloc (sizeof (ecma_extended_primitive_t)))
+
+/**
+ * Free an error reference.
+ */
+#define ECMA_FREE_ERROR_REFERENCE(error_ref_p) \
+  jmem_pools_free ((error_ref_p), sizeof (ecma_extended_primitive_t))
+
+#endif /* JERRY_NAN_BOXING */
+
 /**
  * Decrease ref count of an error reference.
  */
@@ -1328,7 +1471,7 @@ ecma_deref_error_reference (ecma_extended_primitive_t *error_ref_p) /**< error r
   if (error_ref_p->refs_and_type < ECMA_EXTENDED_PRIMITIVE_REF_ONE)
   {
     ecma_free_value (error_ref_p->u.value);
-    jmem_pools_free (error_ref_p, sizeof (ecma_extended_primitive_t));
+    ECMA_FREE_ERROR_REFERENCE (error_ref_p);
   }
 } /* ecma_deref_error_reference */
 
@@ -1372,7 +1515,7 @@ ecma_create_error_reference (ecma_value_t value, /**< referenced value */
                              bool is_exception) /**< error reference is an exception */
 {
   ecma_extended_primitive_t *error_ref_p;
-  error_ref_p = (ecma_extended_primitive_t *) jmem_pools_alloc (sizeof (ecma_extended_primitive_t));
+  error_ref_p = ECMA_ALLOC_ERROR_REFERENCE ();
 
   error_ref_p->refs_and_type = (ECMA_EXTENDED_PRIMITIVE_REF_ONE
                                 | (is_exception ? ECMA_EXTENDED_PRIMITIVE_ERROR : ECMA_EXTENDED_PRIMITIVE_ABORT));
@@ -1436,7 +1579,7 @@ ecma_raise_error_from_error_reference (ecma_value_t value) /**< error reference
   }
   else
   {
-    jmem_pools_free (error_ref_p, sizeof (ecma_extended_primitive_t));
+    ECMA_FREE_ERROR_REFERENCE (error_ref_p);
   }
 
   JERRY_CONTEXT (error_value) = referenced_value;
@@ -1502,11 +1645,32 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       literal_start_p -= args_p->register_end;
     }
 
+#if JERRY_LAZY_FUNCTIONS
+    if ((bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION) && literal_end == const_literal_end)
+    {
+      /* The function body has never been compiled. */
+      cbc_lazy_function_info_t *lazy_info_p = (cbc_lazy_function_info_t *) (literal_start_p + literal_end + 1);
+      jmem_heap_free_block (ECMA_GET_INTERNAL_VALUE_POINTER (uint8_t, lazy_info_p->source), lazy_info_p->source_size);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     for (uint32_t i = const_literal_end; i < literal_end; i++)
     {
       ecma_compiled_code_t *bytecode_literal_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
                                                                                   literal_start_p[i]);
 
+#if JERRY_SNAPSHOT_EXEC
+      if (JERRY_UNLIKELY (CBC_IS_SNAPSHOT_FUNCTION (bytecode_literal_p)))
+      {
+        /* The snapshot function has never been loaded. */
+#if JERRY_MEM_STATS
+        jmem_stats_free_byte_code_bytes (sizeof (cbc_snapshot_function_t));
+#endif /* JERRY_MEM_STATS */
+        jmem_heap_free_block (bytecode_literal_p, sizeof (cbc_snapshot_function_t));
+        continue;
+      }
+#endif /* JERRY_SNAPSHOT_EXEC */
+
       /* Self references are ignored. */
       if (bytecode_literal_p != bytecode_p)
       {
@@ -1643,7 +1807,7 @@ ecma_compiled_code_resolve_extended_info (const ecma_compiled_code_t *bytecode_h
   JERRY_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_EXTENDED_INFO);
 
   ecma_value_t *base_p = ecma_compiled_code_resolve_function_name (bytecode_header_p);
-  return base_p[-1];
+  return (uint32_t) base_p[-1];
 } /* ecma_compiled_code_resolve_extended_info */
 
 /**
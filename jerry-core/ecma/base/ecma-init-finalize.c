@@ -19,8 +19,11 @@
 #include "ecma-init-finalize.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
+#include "ecma-property-shape.h"
 #include "jmem.h"
 #include "jcontext.h"
+#include "re-compiler.h"
+#include "vm.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -76,6 +79,11 @@ ecma_finalize (void)
 #endif /* JERRY_ESNEXT */
 
   ecma_finalize_global_environment ();
+
+#if JERRY_BUILTIN_REGEXP
+  re_cache_gc ();
+#endif /* JERRY_BUILTIN_REGEXP */
+
   uint8_t runs = 0;
 
   do
@@ -88,6 +96,10 @@ ecma_finalize (void)
   }
   while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
 
+#if JERRY_PROPERTY_SHAPES
+  ecma_property_shape_finalize ();
+#endif /* JERRY_PROPERTY_SHAPES */
+
 #if JERRY_ESNEXT
   jmem_cpointer_t *global_symbols_cp = JERRY_CONTEXT (global_symbols_cp);
 
@@ -100,6 +112,10 @@ ecma_finalize (void)
   }
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_VM_HEAP_FRAMES
+  vm_heap_frames_finalize ();
+#endif /* JERRY_VM_HEAP_FRAMES */
+
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
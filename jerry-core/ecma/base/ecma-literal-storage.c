@@ -57,12 +57,43 @@ ecma_free_symbol_list (jmem_cpointer_t symbol_list_cp) /**< symbol list */
 } /* ecma_free_symbol_list */
 #endif /* JERRY_ESNEXT */
 
+/**
+ * Reverse the items of a literal list.
+ *
+ * Note:
+ *   new items are prepended to the list, so the reversed list follows the
+ *   order of creation, which is mostly the ascending address order of the values
+ *
+ * @return first item of the reversed list
+ */
+static jmem_cpointer_t
+ecma_lit_storage_reverse (jmem_cpointer_t list_cp) /**< first item of the literal list */
+{
+  jmem_cpointer_t reversed_cp = JMEM_CP_NULL;
+
+  while (list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *item_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, list_cp);
+    jmem_cpointer_t next_item_cp = item_p->next_cp;
+
+    item_p->next_cp = reversed_cp;
+    reversed_cp = list_cp;
+    list_cp = next_item_cp;
+  }
+
+  return reversed_cp;
+} /* ecma_lit_storage_reverse */
+
 /**
  * Free string list
  */
 static void
 ecma_free_string_list (jmem_cpointer_t string_list_cp) /**< string list */
 {
+  /* Freeing the oldest values first appends the released blocks near the last
+   * inserted free block, instead of searching the free list from its start. */
+  string_list_cp = ecma_lit_storage_reverse (string_list_cp);
+
   while (string_list_cp != JMEM_CP_NULL)
   {
     ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
@@ -91,6 +122,8 @@ ecma_free_string_list (jmem_cpointer_t string_list_cp) /**< string list */
 static void
 ecma_free_number_list (jmem_cpointer_t number_list_cp) /**< number list */
 {
+  number_list_cp = ecma_lit_storage_reverse (number_list_cp);
+
   while (number_list_cp != JMEM_CP_NULL)
   {
     ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t,
@@ -142,6 +175,200 @@ ecma_free_bigint_list (jmem_cpointer_t bigint_list_cp) /**< bigint list */
 
 #endif /* JERRY_BUILTIN_BIGINT */
 
+/**
+ * Append a value to a literal list.
+ */
+static void
+ecma_lit_storage_append (jmem_cpointer_t *list_first_cp_p, /**< [in,out] first item of the literal list */
+                         jmem_cpointer_t value_cp) /**< compressed pointer of the value */
+{
+  /* Values are never removed from the list, so only the first item may have empty slots. */
+  if (*list_first_cp_p != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *item_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, *list_first_cp_p);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (item_p->values[i] == JMEM_CP_NULL)
+      {
+        item_p->values[i] = value_cp;
+        return;
+      }
+    }
+  }
+
+  ecma_lit_storage_item_t *new_item_p;
+  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+
+  new_item_p->values[0] = value_cp;
+  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  {
+    new_item_p->values[i] = JMEM_CP_NULL;
+  }
+
+  new_item_p->next_cp = *list_first_cp_p;
+  JMEM_CP_SET_NON_NULL_POINTER (*list_first_cp_p, new_item_p);
+} /* ecma_lit_storage_append */
+
+#if JERRY_LIT_HASH_TABLE
+
+/**
+ * Compute the first bucket index of a hash.
+ */
+#define ECMA_LIT_HASH_TABLE_INDEX(hash, mask) (((hash) ^ ((hash) >> 16)) & (mask))
+
+/**
+ * Compute the hash of a literal number.
+ *
+ * @return hash of the number
+ */
+static uint32_t
+ecma_lit_number_hash (ecma_number_t number) /**< number */
+{
+#if JERRY_NUMBER_TYPE_FLOAT64
+  uint64_t bits;
+  memcpy (&bits, &number, sizeof (bits));
+  uint32_t hash = (uint32_t) (bits ^ (bits >> 32));
+#else /* !JERRY_NUMBER_TYPE_FLOAT64 */
+  uint32_t hash;
+  memcpy (&hash, &number, sizeof (hash));
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
+  /* The low bits of the mantissa are often zero. */
+  return hash * 0x9e3779b1u;
+} /* ecma_lit_number_hash */
+
+/**
+ * Free the buckets of a literal hash table.
+ */
+static void
+ecma_lit_hash_table_free (ecma_lit_hash_table_t *table_p) /**< hash table */
+{
+  if (table_p->buckets_p != NULL)
+  {
+    jmem_heap_free_block (table_p->buckets_p, (table_p->mask + 1) * sizeof (jmem_cpointer_t));
+    table_p->buckets_p = NULL;
+  }
+} /* ecma_lit_hash_table_free */
+
+/**
+ * Insert a literal into a literal hash table which has at least one free bucket.
+ */
+static void
+ecma_lit_hash_table_insert_bucket (ecma_lit_hash_table_t *table_p, /**< hash table */
+                                   uint32_t hash, /**< hash of the literal */
+                                   jmem_cpointer_t value_cp) /**< compressed pointer of the literal */
+{
+  uint32_t index = ECMA_LIT_HASH_TABLE_INDEX (hash, table_p->mask);
+
+  while (table_p->buckets_p[index] != JMEM_CP_NULL)
+  {
+    index = (index + 1) & table_p->mask;
+  }
+
+  table_p->buckets_p[index] = value_cp;
+} /* ecma_lit_hash_table_insert_bucket */
+
+/**
+ * Rebuild a literal hash table from its literal list.
+ *
+ * Note:
+ *   if the buckets cannot be allocated, the table remains unallocated
+ *   and the literal list is searched instead until the next rebuild
+ */
+static void
+ecma_lit_hash_table_rebuild (ecma_lit_hash_table_t *table_p, /**< hash table */
+                             jmem_cpointer_t list_cp, /**< first item of the literal list */
+                             bool is_string) /**< true - if the list contains strings,
+                                              *   false - if the list contains numbers */
+{
+  ecma_lit_hash_table_free (table_p);
+
+  /* Keep the load factor below one half after the rebuild. */
+  uint32_t size = ECMA_LIT_HASH_TABLE_MIN_COUNT;
+
+  while (size < 2 * table_p->count)
+  {
+    size <<= 1;
+  }
+
+  jmem_cpointer_t *buckets_p;
+  buckets_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (size * sizeof (jmem_cpointer_t));
+
+  if (buckets_p == NULL)
+  {
+    return;
+  }
+
+  memset (buckets_p, 0, size * sizeof (jmem_cpointer_t));
+  table_p->buckets_p = buckets_p;
+  table_p->mask = size - 1;
+
+  while (list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *item_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, list_cp);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      jmem_cpointer_t value_cp = item_p->values[i];
+
+      if (value_cp == JMEM_CP_NULL)
+      {
+        continue;
+      }
+
+      uint32_t hash;
+
+      if (is_string)
+      {
+        hash = ecma_string_hash (JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, value_cp));
+      }
+      else
+      {
+        hash = ecma_lit_number_hash (*JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, value_cp));
+      }
+
+      ecma_lit_hash_table_insert_bucket (table_p, hash, value_cp);
+    }
+
+    list_cp = item_p->next_cp;
+  }
+} /* ecma_lit_hash_table_rebuild */
+
+/**
+ * Register a literal appended to the literal list in the literal hash table.
+ */
+static void
+ecma_lit_hash_table_insert (ecma_lit_hash_table_t *table_p, /**< hash table */
+                            jmem_cpointer_t list_cp, /**< first item of the literal list */
+                            uint32_t hash, /**< hash of the literal */
+                            jmem_cpointer_t value_cp, /**< compressed pointer of the literal */
+                            bool is_string) /**< true - if the list contains strings,
+                                             *   false - if the list contains numbers */
+{
+  uint32_t count = ++table_p->count;
+
+  if (table_p->buckets_p == NULL)
+  {
+    /* Retrying at powers of 2 keeps the rebuild cost linear after an allocation failure. */
+    if (count >= ECMA_LIT_HASH_TABLE_MIN_COUNT && (count & (count - 1)) == 0)
+    {
+      ecma_lit_hash_table_rebuild (table_p, list_cp, is_string);
+    }
+    return;
+  }
+
+  if (count * 4 > (table_p->mask + 1) * 3)
+  {
+    ecma_lit_hash_table_rebuild (table_p, list_cp, is_string);
+    return;
+  }
+
+  ecma_lit_hash_table_insert_bucket (table_p, hash, value_cp);
+} /* ecma_lit_hash_table_insert */
+
+#endif /* JERRY_LIT_HASH_TABLE */
+
 /**
  * Finalize literal storage
  */
@@ -153,29 +380,47 @@ ecma_finalize_lit_storage (void)
 #endif /* JERRY_ESNEXT */
   ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
   ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (string_hash_table));
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (number_hash_table));
+#endif /* JERRY_LIT_HASH_TABLE */
 #if JERRY_BUILTIN_BIGINT
   ecma_free_bigint_list (JERRY_CONTEXT (bigint_list_first_cp));
 #endif /* JERRY_BUILTIN_BIGINT */
 } /* ecma_finalize_lit_storage */
 
 /**
- * Find or create a literal string.
+ * Find a literal string in the literal storage.
  *
- * @return ecma_string_t compressed pointer
+ * @return pointer to the literal string if found, NULL otherwise
  */
-ecma_value_t
-ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
-                                    lit_utf8_size_t size) /**< size of the string */
+static ecma_string_t *
+ecma_find_literal_string (ecma_string_t *string_p) /**< string to be searched */
 {
-  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (string_hash_table);
 
-  if (ECMA_IS_DIRECT_STRING (string_p))
+  if (table_p->buckets_p != NULL)
   {
-    return ecma_make_string_value (string_p);
+    uint32_t index = ECMA_LIT_HASH_TABLE_INDEX (ecma_string_hash (string_p), table_p->mask);
+
+    while (table_p->buckets_p[index] != JMEM_CP_NULL)
+    {
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, table_p->buckets_p[index]);
+
+      if (ecma_compare_ecma_strings (string_p, value_p))
+      {
+        return value_p;
+      }
+
+      index = (index + 1) & table_p->mask;
+    }
+
+    return NULL;
   }
+#endif /* JERRY_LIT_HASH_TABLE */
 
   jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
 
   while (string_list_cp != JMEM_CP_NULL)
   {
@@ -183,23 +428,14 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
+      if (string_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
                                                                string_list_p->values[i]);
 
         if (ecma_compare_ecma_strings (string_p, value_p))
         {
-          /* Return with string if found in the list. */
-          ecma_deref_ecma_string (string_p);
-          return ecma_make_string_value (value_p);
+          return value_p;
         }
       }
     }
@@ -207,50 +443,85 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     string_list_cp = string_list_p->next_cp;
   }
 
-  ECMA_SET_STRING_AS_STATIC (string_p);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+  return NULL;
+} /* ecma_find_literal_string */
 
-  if (empty_cpointer_p != NULL)
+/**
+ * Find or create a literal string.
+ *
+ * @return ecma_string_t compressed pointer
+ */
+ecma_value_t
+ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
+                                    lit_utf8_size_t size) /**< size of the string */
+{
+  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+
+  if (ECMA_IS_DIRECT_STRING (string_p))
   {
-    *empty_cpointer_p = result;
     return ecma_make_string_value (string_p);
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+  ecma_string_t *value_p = ecma_find_literal_string (string_p);
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  if (value_p != NULL)
   {
-    new_item_p->values[i] = JMEM_CP_NULL;
+    /* Return with string if found in the literal storage. */
+    ecma_deref_ecma_string (string_p);
+    return ecma_make_string_value (value_p);
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  ECMA_SET_STRING_AS_STATIC (string_p);
+  jmem_cpointer_t result;
+  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+
+  ecma_lit_storage_append (&JERRY_CONTEXT (string_list_first_cp), result);
+
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_insert (&JERRY_CONTEXT (string_hash_table),
+                              JERRY_CONTEXT (string_list_first_cp),
+                              ecma_string_hash (string_p),
+                              result,
+                              true);
+#endif /* JERRY_LIT_HASH_TABLE */
 
   return ecma_make_string_value (string_p);
 } /* ecma_find_or_create_literal_string */
 
+#if !JERRY_NAN_BOXING
+
 /**
- * Find or create a literal number.
+ * Find a literal number in the literal storage.
  *
- * @return ecma value
+ * @return pointer to the literal number if found, NULL otherwise
  */
-ecma_value_t
-ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be searched */
+static ecma_number_t *
+ecma_find_literal_number (ecma_number_t number_arg) /**< number to be searched */
 {
-  ecma_value_t num = ecma_make_number_value (number_arg);
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (number_hash_table);
 
-  if (ecma_is_value_integer_number (num))
+  if (table_p->buckets_p != NULL)
   {
-    return num;
-  }
+    uint32_t index = ECMA_LIT_HASH_TABLE_INDEX (ecma_lit_number_hash (number_arg), table_p->mask);
 
-  JERRY_ASSERT (ecma_is_value_float_number (num));
+    while (table_p->buckets_p[index] != JMEM_CP_NULL)
+    {
+      ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, table_p->buckets_p[index]);
+
+      if (*number_p == number_arg)
+      {
+        return number_p;
+      }
+
+      index = (index + 1) & table_p->mask;
+    }
+
+    return NULL;
+  }
+#endif /* JERRY_LIT_HASH_TABLE */
 
   jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
 
   while (number_list_cp != JMEM_CP_NULL)
   {
@@ -259,22 +530,14 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
-      }
-      else
+      if (number_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
                                                                 number_list_p->values[i]);
 
         if (*number_p == number_arg)
         {
-          ecma_free_value (num);
-          return ecma_make_float_value (number_p);
+          return number_p;
         }
       }
     }
@@ -282,28 +545,55 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
     number_list_cp = number_list_p->next_cp;
   }
 
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (num));
+  return NULL;
+} /* ecma_find_literal_number */
+
+#endif /* !JERRY_NAN_BOXING */
+
+/**
+ * Find or create a literal number.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be searched */
+{
+  ecma_value_t num = ecma_make_number_value (number_arg);
 
-  if (empty_cpointer_p != NULL)
+#if JERRY_NAN_BOXING
+  /* Float numbers are stored in the value, so they are never shared. */
+  return num;
+#else /* !JERRY_NAN_BOXING */
+  if (ecma_is_value_integer_number (num))
   {
-    *empty_cpointer_p = result;
     return num;
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+  JERRY_ASSERT (ecma_is_value_float_number (num));
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  ecma_number_t *number_p = ecma_find_literal_number (number_arg);
+
+  if (number_p != NULL)
   {
-    new_item_p->values[i] = JMEM_CP_NULL;
+    ecma_free_value (num);
+    return ecma_make_float_value (number_p);
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
+  jmem_cpointer_t result;
+  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (num));
+
+  ecma_lit_storage_append (&JERRY_CONTEXT (number_list_first_cp), result);
+
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_insert (&JERRY_CONTEXT (number_hash_table),
+                              JERRY_CONTEXT (number_list_first_cp),
+                              ecma_lit_number_hash (number_arg),
+                              result,
+                              false);
+#endif /* JERRY_LIT_HASH_TABLE */
 
   return num;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_find_or_create_literal_number */
 
 #if JERRY_BUILTIN_BIGINT
@@ -324,7 +614,6 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
   }
 
   jmem_cpointer_t bigint_list_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
 
   while (bigint_list_cp != JMEM_CP_NULL)
   {
@@ -333,14 +622,7 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (bigint_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = bigint_list_p->values + i;
-        }
-      }
-      else
+      if (bigint_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_extended_primitive_t *other_bigint_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t,
                                                                                   bigint_list_p->values[i]);
@@ -360,23 +642,7 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_extended_primitive_from_value (bigint));
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return bigint;
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (bigint_list_first_cp), new_item_p);
+  ecma_lit_storage_append (&JERRY_CONTEXT (bigint_list_first_cp), result);
 
   return bigint;
 } /* ecma_find_or_create_literal_bigint */
@@ -413,10 +679,146 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
 #if JERRY_SNAPSHOT_SAVE
 
 /**
- * Append the value at the end of the appropriate list if it is not present there.
+ * Compute the first bucket index of a literal value in a snapshot literal pool index.
+ *
+ * Note:
+ *   strings and numbers are direct strings or stored in the literal storage,
+ *   so the value itself identifies the literal
+ */
+#define ECMA_SAVE_LITERALS_INDEX_BUCKET(value, mask) \
+  ((((uint32_t) (value) * 0x9e3779b1u) ^ (((uint32_t) (value) * 0x9e3779b1u) >> 16)) & (mask))
+
+/**
+ * Initialize an empty snapshot literal pool.
+ */
+void
+ecma_save_literals_init (ecma_save_literals_pool_t *lit_pool_p) /**< [out] literal pool */
+{
+  lit_pool_p->values_p = ecma_new_collection ();
+  lit_pool_p->index_p = NULL;
+  lit_pool_p->index_mask = 0;
+} /* ecma_save_literals_init */
+
+/**
+ * Free the index of a snapshot literal pool.
  */
-void ecma_save_literals_append_value (ecma_value_t value, /**< value to be appended */
-                                      ecma_collection_t *lit_pool_p) /**< list of known values */
+static void
+ecma_save_literals_free_index (ecma_save_literals_pool_t *lit_pool_p) /**< literal pool */
+{
+  if (lit_pool_p->index_p != NULL)
+  {
+    jmem_heap_free_block (lit_pool_p->index_p, (lit_pool_p->index_mask + 1) * sizeof (uint32_t));
+    lit_pool_p->index_p = NULL;
+  }
+} /* ecma_save_literals_free_index */
+
+/**
+ * Free a snapshot literal pool.
+ */
+void
+ecma_save_literals_free (ecma_save_literals_pool_t *lit_pool_p) /**< literal pool */
+{
+  ecma_save_literals_free_index (lit_pool_p);
+  ecma_collection_destroy (lit_pool_p->values_p);
+} /* ecma_save_literals_free */
+
+/**
+ * Rebuild the index of a snapshot literal pool, so its load factor is below one half.
+ *
+ * Note:
+ *   if the buckets cannot be allocated, the index remains unallocated
+ *   and the value list is searched instead until the next rebuild
+ */
+static void
+ecma_save_literals_rebuild_index (ecma_save_literals_pool_t *lit_pool_p) /**< literal pool */
+{
+  ecma_save_literals_free_index (lit_pool_p);
+
+  uint32_t count = lit_pool_p->values_p->item_count;
+  uint32_t size = ECMA_SAVE_LITERALS_INDEX_MIN_SIZE;
+
+  while (size < 2 * count)
+  {
+    size <<= 1;
+  }
+
+  uint32_t *index_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (size * sizeof (uint32_t));
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  memset (index_p, 0, size * sizeof (uint32_t));
+  lit_pool_p->index_p = index_p;
+  lit_pool_p->index_mask = size - 1;
+
+  ecma_value_t *buffer_p = lit_pool_p->values_p->buffer_p;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint32_t bucket = ECMA_SAVE_LITERALS_INDEX_BUCKET (buffer_p[i], size - 1);
+
+    while (index_p[bucket] != 0)
+    {
+      bucket = (bucket + 1) & (size - 1);
+    }
+
+    index_p[bucket] = i + 1;
+  }
+} /* ecma_save_literals_rebuild_index */
+
+/**
+ * Find the position of a value in a snapshot literal pool.
+ *
+ * @return position of the value - if the value is present in the pool,
+ *         the free bucket where the value belongs in the index, with its highest bit set,
+ *           if the value is not present in the pool and the index is allocated,
+ *         UINT32_MAX - otherwise
+ */
+static uint32_t
+ecma_save_literals_find (const ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
+                         ecma_value_t value) /**< literal value */
+{
+  const ecma_value_t *buffer_p = lit_pool_p->values_p->buffer_p;
+
+  if (JERRY_LIKELY (lit_pool_p->index_p != NULL))
+  {
+    uint32_t mask = lit_pool_p->index_mask;
+    uint32_t bucket = ECMA_SAVE_LITERALS_INDEX_BUCKET (value, mask);
+
+    while (lit_pool_p->index_p[bucket] != 0)
+    {
+      uint32_t position = lit_pool_p->index_p[bucket] - 1;
+
+      if (buffer_p[position] == value)
+      {
+        return position;
+      }
+
+      bucket = (bucket + 1) & mask;
+    }
+
+    return bucket | 0x80000000u;
+  }
+
+  for (uint32_t i = 0; i < lit_pool_p->values_p->item_count; i++)
+  {
+    if (buffer_p[i] == value)
+    {
+      return i;
+    }
+  }
+
+  return UINT32_MAX;
+} /* ecma_save_literals_find */
+
+/**
+ * Append the value at the end of the literal pool if it is not present there.
+ */
+void
+ecma_save_literals_append_value (ecma_value_t value, /**< value to be appended */
+                                 ecma_save_literals_pool_t *lit_pool_p) /**< literal pool */
 {
   /* Unlike direct numbers, direct strings are converted to character literals. */
   if (!ecma_is_value_string (value)
@@ -428,27 +830,60 @@ void ecma_save_literals_append_value (ecma_value_t value, /**< value to be appen
     return;
   }
 
-  ecma_value_t *buffer_p = lit_pool_p->buffer_p;
+  uint32_t position = ecma_save_literals_find (lit_pool_p, value);
 
-  for (uint32_t i = 0; i < lit_pool_p->item_count; i++)
+  if (!(position & 0x80000000u))
   {
-    /* Strings / numbers are direct strings or stored in the literal storage.
-     * Therefore direct comparison is enough to find the same strings / numbers. */
-    if (buffer_p[i] == value)
+    return;
+  }
+
+  ecma_collection_push_back (lit_pool_p->values_p, value);
+
+  uint32_t count = lit_pool_p->values_p->item_count;
+
+  if (lit_pool_p->index_p == NULL)
+  {
+    /* Retrying at powers of 2 keeps the rebuild cost linear after an allocation failure. */
+    if (count >= ECMA_SAVE_LITERALS_INDEX_MIN_SIZE / 4 && (count & (count - 1)) == 0)
     {
-      return;
+      ecma_save_literals_rebuild_index (lit_pool_p);
     }
+    return;
   }
 
-  ecma_collection_push_back (lit_pool_p, value);
+  if (count * 4 > (lit_pool_p->index_mask + 1) * 3)
+  {
+    ecma_save_literals_rebuild_index (lit_pool_p);
+    return;
+  }
+
+  lit_pool_p->index_p[position & ~0x80000000u] = count;
 } /* ecma_save_literals_append_value */
 
+/**
+ * Get the snapshot offset of a literal value stored in the literal pool.
+ *
+ * @return literal offset from the map created by ecma_save_literals_for_snapshot
+ */
+ecma_value_t
+ecma_save_literals_get_offset (const ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
+                               const lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map */
+                               ecma_value_t value) /**< literal value */
+{
+  uint32_t position = ecma_save_literals_find (lit_pool_p, value);
+
+  JERRY_ASSERT (!(position & 0x80000000u));
+  JERRY_ASSERT (map_p[position].literal_id == value);
+
+  return map_p[position].literal_offset;
+} /* ecma_save_literals_get_offset */
+
 /**
  * Add names from a byte-code data to a list.
  */
 void
 ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< byte-code data */
-                                      ecma_collection_t *lit_pool_p) /**< list of known values */
+                                      ecma_save_literals_pool_t *lit_pool_p) /**< literal pool */
 {
   ecma_value_t *literal_p;
   uint32_t argument_end;
@@ -520,13 +955,14 @@ ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_
  * Save literals to specified snapshot buffer.
  *
  * Note:
- *      Frees 'lit_pool_p' regardless of success.
+ *      the entries of the map follow the order of the literal pool,
+ *      use ecma_save_literals_get_offset to look up a literal
  *
  * @return true - if save was performed successfully (i.e. buffer size is sufficient),
  *         false - otherwise
  */
 bool
-ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of known values */
+ecma_save_literals_for_snapshot (const ecma_save_literals_pool_t *lit_pool_p, /**< literal pool */
                                  uint32_t *buffer_p, /**< [out] output snapshot buffer */
                                  size_t buffer_size, /**< size of the buffer */
                                  size_t *in_out_buffer_offset_p, /**< [in,out] write position in the buffer */
@@ -535,7 +971,7 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
                                                                                   *   in snapshot */
                                  uint32_t *out_map_len_p) /**< [out] number of literals */
 {
-  if (lit_pool_p->item_count == 0)
+  if (lit_pool_p->values_p->item_count == 0)
   {
     *out_map_p = NULL;
     *out_map_len_p = 0;
@@ -549,10 +985,10 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
     max_lit_table_size = (UINT32_MAX >> JERRY_SNAPSHOT_LITERAL_SHIFT);
   }
 
-  ecma_value_t *lit_buffer_p = lit_pool_p->buffer_p;
+  ecma_value_t *lit_buffer_p = lit_pool_p->values_p->buffer_p;
 
   /* Compute the size of the literal pool. */
-  for (uint32_t i = 0; i < lit_pool_p->item_count; i++)
+  for (uint32_t i = 0; i < lit_pool_p->values_p->item_count; i++)
   {
     if (ecma_is_value_float_number (lit_buffer_p[i]))
     {
@@ -578,13 +1014,12 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
     /* Check whether enough space is available and the maximum size is not reached. */
     if (lit_table_size > max_lit_table_size)
     {
-      ecma_collection_destroy (lit_pool_p);
       return false;
     }
   }
 
   lit_mem_to_snapshot_id_map_entry_t *map_p;
-  uint32_t total_count = lit_pool_p->item_count;
+  uint32_t total_count = lit_pool_p->values_p->item_count;
 
   map_p = jmem_heap_alloc_block (total_count * sizeof (lit_mem_to_snapshot_id_map_entry_t));
 
@@ -598,10 +1033,10 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
   *out_map_p = map_p;
   *out_map_len_p = total_count;
 
-  lit_buffer_p = lit_pool_p->buffer_p;
+  lit_buffer_p = lit_pool_p->values_p->buffer_p;
 
   /* Generate literal pool data. */
-  for (uint32_t i = 0; i < lit_pool_p->item_count; i++)
+  for (uint32_t i = 0; i < lit_pool_p->values_p->item_count; i++)
   {
     map_p->literal_id = lit_buffer_p[i];
     map_p->literal_offset = (literal_offset << JERRY_SNAPSHOT_LITERAL_SHIFT) | ECMA_TYPE_SNAPSHOT_OFFSET;
@@ -650,7 +1085,6 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
     map_p++;
   }
 
-  ecma_collection_destroy (lit_pool_p);
   return true;
 } /* ecma_save_literals_for_snapshot */
 
@@ -36,6 +36,22 @@ typedef struct
   ecma_value_t literal_id; /**< literal id */
   ecma_value_t literal_offset; /**< literal offset */
 } lit_mem_to_snapshot_id_map_entry_t;
+
+/**
+ * Minimum number of buckets of a snapshot literal pool index.
+ */
+#define ECMA_SAVE_LITERALS_INDEX_MIN_SIZE 64
+
+/**
+ * Deduplicated list of literals saved into a snapshot
+ */
+typedef struct
+{
+  ecma_collection_t *values_p; /**< literal values in the order of their first occurrence */
+  uint32_t *index_p; /**< open addressing hash table of value positions plus one (0 is a free bucket),
+                      *   NULL if the table is not allocated */
+  uint32_t index_mask; /**< number of buckets of the hash table - 1 */
+} ecma_save_literals_pool_t;
 #endif /* JERRY_SNAPSHOT_SAVE */
 
 void ecma_finalize_lit_storage (void);
@@ -47,12 +63,16 @@ ecma_value_t ecma_find_or_create_literal_bigint (ecma_value_t bigint);
 #endif /* JERRY_BUILTIN_BIGINT */
 
 #if JERRY_SNAPSHOT_SAVE
-void ecma_save_literals_append_value (ecma_value_t value, ecma_collection_t *lit_pool_p);
+void ecma_save_literals_init (ecma_save_literals_pool_t *lit_pool_p);
+void ecma_save_literals_free (ecma_save_literals_pool_t *lit_pool_p);
+void ecma_save_literals_append_value (ecma_value_t value, ecma_save_literals_pool_t *lit_pool_p);
 void ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_p,
-                                           ecma_collection_t *lit_pool_p);
-bool ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, uint32_t *buffer_p, size_t buffer_size,
-                                      size_t *in_out_buffer_offset_p, lit_mem_to_snapshot_id_map_entry_t **out_map_p,
-                                      uint32_t *out_map_len_p);
+                                           ecma_save_literals_pool_t *lit_pool_p);
+bool ecma_save_literals_for_snapshot (const ecma_save_literals_pool_t *lit_pool_p, uint32_t *buffer_p,
+                                      size_t buffer_size, size_t *in_out_buffer_offset_p,
+                                      lit_mem_to_snapshot_id_map_entry_t **out_map_p, uint32_t *out_map_len_p);
+ecma_value_t ecma_save_literals_get_offset (const ecma_save_literals_pool_t *lit_pool_p,
+                                            const lit_mem_to_snapshot_id_map_entry_t *map_p, ecma_value_t value);
 #endif /* JERRY_SNAPSHOT_SAVE */
 
 #if JERRY_SNAPSHOT_EXEC || JERRY_SNAPSHOT_SAVE
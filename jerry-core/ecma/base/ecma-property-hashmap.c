@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-property-hashmap.h"
@@ -65,6 +66,68 @@ static const uint8_t ecma_property_hashmap_steps[ECMA_PROPERTY_HASHMAP_NUMBER_OF
 #define ECMA_PROPERTY_HASHMAP_SET_BIT(byte_p, index) \
   ((byte_p)[(index) >> 3] = (uint8_t) ((byte_p)[(index) >> 3] | (1 << ((index) & 0x7))))
 
+/**
+ * Compute the number of entries of a hashmap which stores the given number of properties.
+ *
+ * @return number of entries (power of 2)
+ */
+static uint32_t
+ecma_property_hashmap_get_size (uint32_t named_property_count) /**< number of named properties */
+{
+  /* The max_property_count must be power of 2. */
+  uint32_t max_property_count = ECMA_PROPERTY_HASMAP_MINIMUM_SIZE;
+
+  /* At least 1/3 items must be NULL. */
+  while (max_property_count < (named_property_count + (named_property_count >> 1)))
+  {
+    max_property_count <<= 1;
+  }
+
+  return max_property_count;
+} /* ecma_property_hashmap_get_size */
+
+/**
+ * Store a property pair reference in the first free entry of a hashmap which has no deleted entries.
+ */
+static void
+ecma_property_hashmap_place (jmem_cpointer_t *pair_list_p, /**< entries of the hashmap */
+                             uint32_t mask, /**< max_property_count - 1 */
+                             ecma_property_pair_t *property_pair_p, /**< property pair */
+                             int property_index) /**< property index in the pair (0 or 1) */
+{
+  uint8_t *bits_p = (uint8_t *) (pair_list_p + mask + 1);
+  uint32_t entry_index = ecma_string_get_property_name_hash (property_pair_p->header.types[property_index],
+                                                             property_pair_p->names_cp[property_index]);
+  uint32_t step = ecma_property_hashmap_steps[entry_index & (ECMA_PROPERTY_HASHMAP_NUMBER_OF_STEPS - 1)];
+
+  entry_index &= mask;
+#ifndef JERRY_NDEBUG
+  /* Because max_property_count (power of 2) and step (a prime
+   * number) are relative primes, all entries of the hasmap are
+   * visited exactly once before the start entry index is reached
+   * again. Furthermore because at least one NULL is present in
+   * the hashmap, the while loop must be terminated before the
+   * the starting index is reached again. */
+  uint32_t start_entry_index = entry_index;
+#endif /* !JERRY_NDEBUG */
+
+  while (pair_list_p[entry_index] != ECMA_NULL_POINTER)
+  {
+    entry_index = (entry_index + step) & mask;
+
+#ifndef JERRY_NDEBUG
+    JERRY_ASSERT (entry_index != start_entry_index);
+#endif /* !JERRY_NDEBUG */
+  }
+
+  ECMA_SET_NON_NULL_POINTER (pair_list_p[entry_index], property_pair_p);
+
+  if (property_index != 0)
+  {
+    ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
+  }
+} /* ecma_property_hashmap_place */
+
 /**
  * Create a new property hashmap for the object.
  * The object must not have a property hashmap.
@@ -107,15 +170,7 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
     return;
   }
 
-  /* The max_property_count must be power of 2. */
-  uint32_t max_property_count = ECMA_PROPERTY_HASMAP_MINIMUM_SIZE;
-
-  /* At least 1/3 items must be NULL. */
-  while (max_property_count < (named_property_count + (named_property_count >> 1)))
-  {
-    max_property_count <<= 1;
-  }
-
+  uint32_t max_property_count = ecma_property_hashmap_get_size (named_property_count);
   size_t total_size = ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (max_property_count);
 
   ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) jmem_heap_alloc_block_null_on_error (total_size);
@@ -134,7 +189,6 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
   hashmap_p->unused_count = max_property_count - named_property_count;
 
   jmem_cpointer_t *pair_list_p = (jmem_cpointer_t *) (hashmap_p + 1);
-  uint8_t *bits_p = (uint8_t *) (pair_list_p + max_property_count);
   uint32_t mask = max_property_count - 1;
 
   prop_iter_cp = object_p->u1.property_list_cp;
@@ -154,43 +208,209 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
 
       JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_iter_p->types[i]));
 
-      ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+      ecma_property_hashmap_place (pair_list_p, mask, (ecma_property_pair_t *) prop_iter_p, i);
+    }
 
-      uint32_t entry_index = ecma_string_get_property_name_hash (prop_iter_p->types[i],
-                                                                 property_pair_p->names_cp[i]);
-      uint32_t step = ecma_property_hashmap_steps[entry_index & (ECMA_PROPERTY_HASHMAP_NUMBER_OF_STEPS - 1)];
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+} /* ecma_property_hashmap_create */
 
-      entry_index &= mask;
-#ifndef JERRY_NDEBUG
-      /* Because max_property_count (power of 2) and step (a prime
-       * number) are relative primes, all entries of the hasmap are
-       * visited exactly once before the start entry index is reached
-       * again. Furthermore because at least one NULL is present in
-       * the hashmap, the while loop must be terminated before the
-       * the starting index is reached again. */
-      uint32_t start_entry_index = entry_index;
-#endif /* !JERRY_NDEBUG */
+/**
+ * Notify the hashmap allocator that a linear property lookup of an object without
+ * a property hashmap has walked through the specified number of property pairs.
+ *
+ * The hashmap is built when the same object is walked through several times,
+ * so objects which are searched only once (e.g. when they are initialized)
+ * do not pay for building a hashmap.
+ */
+void
+ecma_property_hashmap_long_lookup (ecma_object_t *object_p, /**< object */
+                                   uint32_t steps) /**< number of visited property pairs */
+{
+  JERRY_ASSERT (steps >= (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2));
 
-      while (pair_list_p[entry_index] != ECMA_NULL_POINTER)
-      {
-        entry_index = (entry_index + step) & mask;
+#if JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1
+  if (steps < ECMA_PROPERTY_HASMAP_MINIMUM_SIZE)
+  {
+    jmem_cpointer_t object_cp;
+    ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
-#ifndef JERRY_NDEBUG
-        JERRY_ASSERT (entry_index != start_entry_index);
-#endif /* !JERRY_NDEBUG */
-      }
+    /* The counters are indexed by the compressed pointer of the object. A counter
+     * may belong to an object which has already been freed, which is harmless: at
+     * worst a hashmap is built one lookup earlier for an object at the same address. */
+    ecma_prop_hashmap_lookup_t *lookup_p;
+    lookup_p = JERRY_CONTEXT (ecma_prop_hashmap_lookups) + (object_cp % ECMA_PROP_HASHMAP_LOOKUP_CACHE_SIZE);
 
-      ECMA_SET_NON_NULL_POINTER (pair_list_p[entry_index], property_pair_p);
+    if (lookup_p->object_cp != object_cp)
+    {
+      lookup_p->object_cp = object_cp;
+      lookup_p->count = 1;
+      return;
+    }
 
-      if (i != 0)
-      {
-        ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
-      }
+    if (++lookup_p->count < JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT)
+    {
+      return;
     }
 
-    prop_iter_cp = prop_iter_p->next_property_cp;
+    lookup_p->object_cp = JMEM_CP_NULL;
   }
-} /* ecma_property_hashmap_create */
+#endif /* JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1 */
+
+  ecma_property_hashmap_create (object_p);
+} /* ecma_property_hashmap_long_lookup */
+
+/**
+ * Unlink and free the property pairs whose both entries are deleted.
+ *
+ * Note:
+ *      such pairs are only kept in the property list while the object has a hashmap
+ */
+static void
+ecma_property_hashmap_free_empty_pairs (ecma_property_hashmap_t *hashmap_p) /**< hashmap */
+{
+  ecma_property_header_t *prev_prop_p = &hashmap_p->header;
+  jmem_cpointer_t prop_iter_cp = prev_prop_p->next_property_cp;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
+        && prop_iter_p->types[1] == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      prev_prop_p->next_property_cp = prop_iter_p->next_property_cp;
+      ecma_dealloc_property_pair ((ecma_property_pair_t *) prop_iter_p);
+    }
+    else
+    {
+      prev_prop_p = prop_iter_p;
+    }
+
+    prop_iter_cp = prev_prop_p->next_property_cp;
+  }
+
+  hashmap_p->empty_pair_count = 0;
+} /* ecma_property_hashmap_free_empty_pairs */
+
+/**
+ * Register a property pair of the object whose both entries has been deleted.
+ * The pair is kept in the property list, and such pairs are freed together
+ * when their number is large enough, so deleting a property does not need
+ * to search its predecessor in the property list.
+ * The object must have a property hashmap.
+ */
+void
+ecma_property_hashmap_add_empty_pair (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_hashmap_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t,
+                                                                  object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (hashmap_p->header.types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+
+  if (++hashmap_p->empty_pair_count >= (hashmap_p->max_property_count >> 3))
+  {
+    ecma_property_hashmap_free_empty_pairs (hashmap_p);
+  }
+} /* ecma_property_hashmap_add_empty_pair */
+
+/**
+ * Move the entries of the hashmap of the object into a new hashmap with the specified size.
+ * Deleted entries are dropped during the move.
+ *
+ * @return pointer to the new hashmap - if the allocation is successful
+ *         NULL - otherwise (the original hashmap is kept)
+ */
+static ecma_property_hashmap_t *
+ecma_property_hashmap_resize (ecma_object_t *object_p, /**< object */
+                              ecma_property_hashmap_t *hashmap_p, /**< current hashmap of the object */
+                              uint32_t max_property_count) /**< number of entries in the new hashmap */
+{
+  uint32_t named_property_count = hashmap_p->max_property_count - hashmap_p->unused_count;
+
+  JERRY_ASSERT (named_property_count < max_property_count);
+
+  if (hashmap_p->empty_pair_count > 0)
+  {
+    ecma_property_hashmap_free_empty_pairs (hashmap_p);
+  }
+
+  /* The allocation below may free the hashmaps of all objects,
+   * so the current hashmap is detached from the object first. */
+  object_p->u1.property_list_cp = hashmap_p->header.next_property_cp;
+
+  size_t total_size = ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (max_property_count);
+
+  ecma_property_hashmap_t *new_hashmap_p;
+  new_hashmap_p = (ecma_property_hashmap_t *) jmem_heap_alloc_block_null_on_error (total_size);
+
+  if (new_hashmap_p == NULL)
+  {
+    hashmap_p->header.next_property_cp = object_p->u1.property_list_cp;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, hashmap_p);
+    return NULL;
+  }
+
+  memset (new_hashmap_p, 0, total_size);
+
+  new_hashmap_p->header.types[0] = ECMA_PROPERTY_TYPE_HASHMAP;
+  new_hashmap_p->header.next_property_cp = object_p->u1.property_list_cp;
+  new_hashmap_p->max_property_count = max_property_count;
+  new_hashmap_p->null_count = max_property_count - named_property_count;
+  new_hashmap_p->unused_count = max_property_count - named_property_count;
+
+  jmem_cpointer_t *pair_list_p = (jmem_cpointer_t *) (hashmap_p + 1);
+  uint8_t *bits_p = (uint8_t *) (pair_list_p + hashmap_p->max_property_count);
+  jmem_cpointer_t *new_pair_list_p = (jmem_cpointer_t *) (new_hashmap_p + 1);
+  uint32_t mask = max_property_count - 1;
+
+  for (uint32_t i = 0; i < hashmap_p->max_property_count; i++)
+  {
+    if (pair_list_p[i] != ECMA_NULL_POINTER)
+    {
+      ecma_property_pair_t *property_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t, pair_list_p[i]);
+      int property_index = ECMA_PROPERTY_HASHMAP_GET_BIT (bits_p, i) ? 1 : 0;
+
+      ecma_property_hashmap_place (new_pair_list_p, mask, property_pair_p, property_index);
+    }
+  }
+
+  ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, new_hashmap_p);
+
+  jmem_heap_free_block (hashmap_p, ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count));
+  return new_hashmap_p;
+} /* ecma_property_hashmap_resize */
+
+/**
+ * Shrink the hashmap of the object after deleting properties, or free it
+ * when only a few properties are left.
+ * The object must have a property hashmap.
+ */
+void
+ecma_property_hashmap_shrink (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_hashmap_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t,
+                                                                  object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (hashmap_p->header.types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+
+  uint32_t named_property_count = hashmap_p->max_property_count - hashmap_p->unused_count;
+
+  if (named_property_count < (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 4))
+  {
+    ecma_property_hashmap_free (object_p);
+    return;
+  }
+
+  uint32_t max_property_count = ecma_property_hashmap_get_size (named_property_count);
+
+  if (max_property_count < hashmap_p->max_property_count)
+  {
+    /* The original hashmap is still valid when the allocation fails. */
+    ecma_property_hashmap_resize (object_p, hashmap_p, max_property_count);
+  }
+} /* ecma_property_hashmap_shrink */
 
 /**
  * Free the hashmap of the object.
@@ -209,6 +429,11 @@ ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
 
   ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) property_p;
 
+  if (hashmap_p->empty_pair_count > 0)
+  {
+    ecma_property_hashmap_free_empty_pairs (hashmap_p);
+  }
+
   object_p->u1.property_list_cp = property_p->next_property_cp;
 
   jmem_heap_free_block (hashmap_p,
@@ -234,9 +459,27 @@ ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
   /* The NULLs are reduced below 1/8 of the hashmap. */
   if (hashmap_p->null_count < (hashmap_p->max_property_count >> 3))
   {
-    ecma_property_hashmap_free (object_p);
-    ecma_property_hashmap_create (object_p);
-    return;
+    /* The hashmap is doubled when it is mostly filled with properties, otherwise
+     * its deleted entries are compacted without changing its size. The new
+     * property is already in the property list, so dropping the hashmap is
+     * a valid fallback when it cannot be reallocated. */
+    uint32_t named_property_count = hashmap_p->max_property_count - hashmap_p->unused_count;
+
+    if (JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) != ECMA_PROP_HASHMAP_ALLOC_ON)
+    {
+      ecma_property_hashmap_free (object_p);
+      return;
+    }
+
+    hashmap_p = ecma_property_hashmap_resize (object_p,
+                                              hashmap_p,
+                                              ecma_property_hashmap_get_size (named_property_count + 1));
+
+    if (hashmap_p == NULL)
+    {
+      ecma_property_hashmap_free (object_p);
+      return;
+    }
   }
 
   JERRY_ASSERT (property_index < ECMA_PROPERTY_PAIR_ITEM_COUNT);
@@ -292,7 +535,11 @@ ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
 /**
  * Delete named property from the hashmap.
  *
- * @return ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP if hashmap should be recreated
+ * Note:
+ *      the hashmap is kept consistent, so the caller can delete further properties
+ *      before it calls ecma_property_hashmap_shrink
+ *
+ * @return ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP if hashmap should be shrunk
  *         ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP otherwise
  */
 ecma_property_hashmap_delete_status
@@ -307,12 +554,6 @@ ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
 
   hashmap_p->unused_count++;
 
-  /* The NULLs are above 3/4 of the hashmap. */
-  if (hashmap_p->unused_count > ((hashmap_p->max_property_count * 3) >> 2))
-  {
-    return ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP;
-  }
-
   uint32_t entry_index = ecma_string_get_property_name_hash (*property_p, name_cp);
   uint32_t step = ecma_property_hashmap_steps[entry_index & (ECMA_PROPERTY_HASHMAP_NUMBER_OF_STEPS - 1)];
   uint32_t mask = hashmap_p->max_property_count - 1;
@@ -346,6 +587,12 @@ ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
 
         pair_list_p[entry_index] = ECMA_NULL_POINTER;
         ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
+
+        /* The unused entries are above 3/4 of the hashmap. */
+        if (hashmap_p->unused_count > ((hashmap_p->max_property_count * 3) >> 2))
+        {
+          return ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP;
+        }
         return ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
       }
     }
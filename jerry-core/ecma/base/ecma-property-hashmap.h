@@ -26,7 +26,7 @@
 /**
  * Recommended minimum number of items in a property cache.
  */
-#define ECMA_PROPERTY_HASMAP_MINIMUM_SIZE 32
+#define ECMA_PROPERTY_HASMAP_MINIMUM_SIZE ((uint32_t) JERRY_PROPERTY_HASHMAP_MINIMUM_SIZE)
 
 /**
  * Property hash.
@@ -37,6 +37,8 @@ typedef struct
   uint32_t max_property_count; /**< maximum property count (power of 2) */
   uint32_t null_count; /**< number of NULLs in the map */
   uint32_t unused_count; /**< number of unused entires in the map */
+  uint32_t empty_pair_count; /**< number of property pairs in the property list whose
+                              *   both entries are deleted */
 
   /*
    * The hash is followed by max_property_count ecma_cpointer_t
@@ -62,11 +64,14 @@ typedef enum
 {
   ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP, /**< object has no hashmap */
   ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP, /**< object has hashmap */
-  ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP, /**< hashmap should be recreated */
+  ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP, /**< hashmap should be shrunk */
 } ecma_property_hashmap_delete_status;
 
 void ecma_property_hashmap_create (ecma_object_t *object_p);
+void ecma_property_hashmap_long_lookup (ecma_object_t *object_p, uint32_t steps);
 void ecma_property_hashmap_free (ecma_object_t *object_p);
+void ecma_property_hashmap_shrink (ecma_object_t *object_p);
+void ecma_property_hashmap_add_empty_pair (ecma_object_t *object_p);
 void ecma_property_hashmap_insert (ecma_object_t *object_p, ecma_string_t *name_p,
                                    ecma_property_pair_t *property_pair_p, int property_index);
 ecma_property_hashmap_delete_status ecma_property_hashmap_delete (ecma_object_t *object_p, jmem_cpointer_t name_cp,
@@ -0,0 +1,668 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-lcache.h"
+#include "ecma-property-shape.h"
+#include "jrt-libc-includes.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyshape Property shapes
+ * @{
+ */
+
+#if JERRY_PROPERTY_SHAPES
+
+/**
+ * Initial number of entries of the shape table.
+ */
+#define ECMA_PROPERTY_SHAPE_TABLE_INITIAL_SIZE 16
+
+/**
+ * Maximum number of entries of the shape table.
+ */
+#define ECMA_PROPERTY_SHAPE_TABLE_MAXIMUM_SIZE ((uint32_t) UINT16_MAX + 1)
+
+/**
+ * Size of the name block of a shape.
+ */
+#define ECMA_PROPERTY_SHAPE_NAMES_SIZE(property_count) \
+  ((property_count) * (sizeof (jmem_cpointer_t) + sizeof (ecma_property_t)))
+
+/**
+ * Index of the first property name of the first property pair of a shaped object.
+ *
+ * The n-th property pair (counted from the first pair of the list) stores
+ * the (first index - 2n)-th property in its second slot and the next one
+ * in its first slot. The first slot of the first pair is deleted if the
+ * number of properties is odd.
+ */
+#define ECMA_PROPERTY_SHAPE_FIRST_INDEX(property_count) (((property_count) - 1u) & ~1u)
+
+JERRY_STATIC_ASSERT (ECMA_PROPERTY_SHAPE_MAX_PROPERTIES % 2 == 0,
+                     ecma_property_shape_max_properties_must_be_even);
+
+/**
+ * Get a shape by its id.
+ *
+ * @return pointer to the shape
+ */
+static inline ecma_property_shape_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_property_shape_get (uint16_t shape_id) /**< shape id */
+{
+  JERRY_ASSERT (shape_id != 0 && shape_id < JERRY_CONTEXT (property_shape_count));
+
+  return JERRY_CONTEXT (property_shapes_p) + shape_id;
+} /* ecma_property_shape_get */
+
+/**
+ * Get the property names of a shape.
+ *
+ * @return pointer to the names, followed by the name types
+ */
+static inline jmem_cpointer_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_property_shape_get_names (const ecma_property_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p->property_count > 0);
+
+  return ECMA_GET_NON_NULL_POINTER (jmem_cpointer_t, shape_p->names_cp);
+} /* ecma_property_shape_get_names */
+
+/**
+ * Check whether the properties of an object can be stored in shaped property pairs.
+ *
+ * Note: only ordinary objects are shaped, other objects have internal or lazy instantiated properties.
+ *
+ * @return true - if the object can be shaped
+ *         false - otherwise
+ */
+static bool
+ecma_property_shape_object_is_shapeable (const ecma_object_t *object_p) /**< object */
+{
+  return (!ecma_is_lexical_environment (object_p)
+          && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+          && !ecma_get_object_is_builtin (object_p));
+} /* ecma_property_shape_object_is_shapeable */
+
+/**
+ * Grow the shape table.
+ *
+ * @return true - if the table is grown
+ *         false - if the table has the maximum size
+ */
+static bool
+ecma_property_shape_grow_table (void)
+{
+  uint32_t old_count = JERRY_CONTEXT (property_shape_count);
+
+  if (old_count >= ECMA_PROPERTY_SHAPE_TABLE_MAXIMUM_SIZE)
+  {
+    return false;
+  }
+
+  uint32_t new_count = (old_count == 0) ? ECMA_PROPERTY_SHAPE_TABLE_INITIAL_SIZE : (old_count * 2);
+  ecma_property_shape_t *shapes_p;
+  shapes_p = (ecma_property_shape_t *) jmem_heap_alloc_block (new_count * sizeof (ecma_property_shape_t));
+
+  /* The allocation above may run the garbage collector, which frees shapes, so the
+   * old table is copied afterwards. */
+  uint32_t first_id = old_count;
+
+  if (old_count == 0)
+  {
+    /* Shape id 0 means no shape, and it is followed by the empty shape. */
+    memset (shapes_p, 0, 2 * sizeof (ecma_property_shape_t));
+    shapes_p[ECMA_PROPERTY_SHAPE_ROOT].refs = 1;
+    first_id = ECMA_PROPERTY_SHAPE_ROOT + 1;
+  }
+  else
+  {
+    memcpy (shapes_p, JERRY_CONTEXT (property_shapes_p), old_count * sizeof (ecma_property_shape_t));
+    jmem_heap_free_block (JERRY_CONTEXT (property_shapes_p), old_count * sizeof (ecma_property_shape_t));
+  }
+
+  for (uint32_t id = first_id; id < new_count - 1; id++)
+  {
+    shapes_p[id].next_sibling_id = (uint16_t) (id + 1);
+  }
+
+  shapes_p[new_count - 1].next_sibling_id = JERRY_CONTEXT (property_shape_free_id);
+
+  JERRY_CONTEXT (property_shapes_p) = shapes_p;
+  JERRY_CONTEXT (property_shape_count) = new_count;
+  JERRY_CONTEXT (property_shape_free_id) = (uint16_t) first_id;
+  return true;
+} /* ecma_property_shape_grow_table */
+
+/**
+ * Find or create the shape which extends a shape with a property.
+ *
+ * @return id of the shape, which reference count is increased
+ *         0 - if no more shapes can be created
+ */
+static uint16_t
+ecma_property_shape_get_child (uint16_t shape_id, /**< shape id */
+                               ecma_string_t *name_p) /**< name of the new property */
+{
+  ecma_property_shape_t *shape_p = ecma_property_shape_get (shape_id);
+  uint32_t property_count = shape_p->property_count;
+  uint16_t child_id = shape_p->first_child_id;
+  uint32_t transitions = 0;
+
+  while (child_id != 0)
+  {
+    ecma_property_shape_t *child_p = ecma_property_shape_get (child_id);
+    jmem_cpointer_t *names_p = ecma_property_shape_get_names (child_p);
+    ecma_property_t *name_types_p = (ecma_property_t *) (names_p + property_count + 1);
+
+    if (ecma_string_compare_to_property_name (name_types_p[property_count], names_p[property_count], name_p))
+    {
+      child_p->refs++;
+      return child_id;
+    }
+
+    transitions++;
+    child_id = child_p->next_sibling_id;
+  }
+
+  if (transitions >= ECMA_PROPERTY_SHAPE_MAX_TRANSITIONS)
+  {
+    return 0;
+  }
+
+  size_t size = ECMA_PROPERTY_SHAPE_NAMES_SIZE (property_count + 1);
+  jmem_cpointer_t *new_names_p = (jmem_cpointer_t *) jmem_heap_alloc_block (size);
+
+  if (JERRY_CONTEXT (property_shape_free_id) == 0
+      && !ecma_property_shape_grow_table ())
+  {
+    jmem_heap_free_block (new_names_p, size);
+    return 0;
+  }
+
+  /* Growing the table moves the shapes. */
+  shape_p = ecma_property_shape_get (shape_id);
+
+  ecma_property_t *new_name_types_p = (ecma_property_t *) (new_names_p + property_count + 1);
+
+  if (property_count > 0)
+  {
+    jmem_cpointer_t *names_p = ecma_property_shape_get_names (shape_p);
+    ecma_property_t *name_types_p = (ecma_property_t *) (names_p + property_count);
+
+    for (uint32_t i = 0; i < property_count; i++)
+    {
+      new_names_p[i] = names_p[i];
+      new_name_types_p[i] = name_types_p[i];
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[i]));
+      }
+    }
+  }
+
+  new_names_p[property_count] = ecma_string_to_property_name (name_p, new_name_types_p + property_count);
+
+  child_id = JERRY_CONTEXT (property_shape_free_id);
+
+  ecma_property_shape_t *child_p = ecma_property_shape_get (child_id);
+  JERRY_CONTEXT (property_shape_free_id) = child_p->next_sibling_id;
+
+  child_p->refs = 1;
+  ECMA_SET_NON_NULL_POINTER (child_p->names_cp, new_names_p);
+  child_p->parent_id = shape_id;
+  child_p->first_child_id = 0;
+  child_p->next_sibling_id = shape_p->first_child_id;
+  child_p->property_count = (uint16_t) (property_count + 1);
+
+  shape_p->first_child_id = child_id;
+  shape_p->refs++;
+  return child_id;
+} /* ecma_property_shape_get_child */
+
+/**
+ * Decrease the reference count of a shape, and free it when it is no longer used.
+ */
+void
+ecma_property_shape_deref (uint16_t shape_id) /**< shape id */
+{
+  /* The empty shape is never freed. */
+  while (shape_id != ECMA_PROPERTY_SHAPE_ROOT)
+  {
+    ecma_property_shape_t *shape_p = ecma_property_shape_get (shape_id);
+
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    JERRY_ASSERT (shape_p->first_child_id == 0);
+
+    uint16_t parent_id = shape_p->parent_id;
+    ecma_property_shape_t *parent_p = ecma_property_shape_get (parent_id);
+
+    if (parent_p->first_child_id == shape_id)
+    {
+      parent_p->first_child_id = shape_p->next_sibling_id;
+    }
+    else
+    {
+      ecma_property_shape_t *prev_p = ecma_property_shape_get (parent_p->first_child_id);
+
+      while (prev_p->next_sibling_id != shape_id)
+      {
+        prev_p = ecma_property_shape_get (prev_p->next_sibling_id);
+      }
+
+      prev_p->next_sibling_id = shape_p->next_sibling_id;
+    }
+
+    uint32_t property_count = shape_p->property_count;
+    jmem_cpointer_t *names_p = ecma_property_shape_get_names (shape_p);
+    ecma_property_t *name_types_p = (ecma_property_t *) (names_p + property_count);
+
+    for (uint32_t i = 0; i < property_count; i++)
+    {
+      if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[i]));
+      }
+    }
+
+    jmem_heap_free_block (names_p, ECMA_PROPERTY_SHAPE_NAMES_SIZE (property_count));
+
+    shape_p->next_sibling_id = JERRY_CONTEXT (property_shape_free_id);
+    JERRY_CONTEXT (property_shape_free_id) = shape_id;
+
+    shape_id = parent_id;
+  }
+} /* ecma_property_shape_deref */
+
+/**
+ * Get the shape of an object.
+ *
+ * Note: fast arrays must not be passed to this function
+ *
+ * @return shape id - if the object is shaped
+ *         0 - otherwise
+ */
+uint16_t
+ecma_property_shape_get_id (const ecma_object_t *object_p) /**< object */
+{
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    return 0;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                   object_p->u1.property_list_cp);
+
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    return 0;
+  }
+
+  return prop_iter_p->shape_id;
+} /* ecma_property_shape_get_id */
+
+/**
+ * Get the name of a property of a shaped object.
+ *
+ * @return compressed pointer part of the property name,
+ *         LIT_INTERNAL_MAGIC_STRING_DELETED for the deleted slot of the first property pair
+ */
+jmem_cpointer_t
+ecma_property_shape_get_name (uint16_t shape_id, /**< shape of the object */
+                              uint32_t position, /**< position of the property pair in the property list */
+                              uint32_t index) /**< index of the property in the property pair */
+{
+  ecma_property_shape_t *shape_p = ecma_property_shape_get (shape_id);
+  uint32_t property_count = shape_p->property_count;
+  uint32_t name_index = ECMA_PROPERTY_SHAPE_FIRST_INDEX (property_count) - 2 * position + 1 - index;
+
+  if (name_index >= property_count)
+  {
+    return LIT_INTERNAL_MAGIC_STRING_DELETED;
+  }
+
+  return ecma_property_shape_get_names (shape_p)[name_index];
+} /* ecma_property_shape_get_name */
+
+/**
+ * Create a property in a shaped object or in an object without properties.
+ *
+ * @return pointer to the value of the new property - if the property is created
+ *         NULL - if the object is not shaped, in this case the caller must create the property
+ */
+ecma_property_value_t *
+ecma_property_shape_create_property (ecma_object_t *object_p, /**< the object */
+                                     ecma_string_t *name_p, /**< property name */
+                                     uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                                     ecma_property_value_t value, /**< property value */
+                                     ecma_property_t **out_prop_p) /**< [out] the property is also returned
+                                                                    *         if this field is non-NULL */
+{
+  uint16_t shape_id = ECMA_PROPERTY_SHAPE_ROOT;
+
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    shape_id = ecma_property_shape_get_id (object_p);
+
+    if (shape_id == 0)
+    {
+      return NULL;
+    }
+  }
+  else if (!ecma_property_shape_object_is_shapeable (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR << ECMA_PROPERTY_NAME_TYPE_SHIFT;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    name_type = (ecma_property_t) ECMA_DIRECT_STRING_TYPE_TO_PROP_NAME_TYPE (name_p);
+  }
+
+  uint16_t new_shape_id = 0;
+
+  if (JERRY_CONTEXT (property_shape_count) == 0)
+  {
+    ecma_property_shape_grow_table ();
+  }
+
+  if (!ECMA_PROPERTY_IS_INTERNAL (type_and_flags | name_type)
+      && ecma_property_shape_get (shape_id)->property_count < ECMA_PROPERTY_SHAPE_MAX_PROPERTIES)
+  {
+    new_shape_id = ecma_property_shape_get_child (shape_id, name_p);
+  }
+
+  if (new_shape_id == 0)
+  {
+    if (shape_id != ECMA_PROPERTY_SHAPE_ROOT)
+    {
+      ecma_property_shape_to_dictionary (object_p, NULL);
+    }
+
+    return NULL;
+  }
+
+  ecma_property_header_t *first_property_p;
+  uint32_t index = 0;
+
+  if (shape_id != ECMA_PROPERTY_SHAPE_ROOT
+      && (ecma_property_shape_get (shape_id)->property_count & 0x1) != 0)
+  {
+    /* The first entry of the first property pair is free. */
+    first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, object_p->u1.property_list_cp);
+    JERRY_ASSERT (first_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED);
+  }
+  else
+  {
+    /* The new shape is referenced, so it is not freed by the garbage collector. */
+    ecma_property_pair_t *property_pair_p = ecma_alloc_shaped_property_pair ();
+
+    first_property_p = &property_pair_p->header;
+    first_property_p->next_property_cp = object_p->u1.property_list_cp;
+    first_property_p->types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, first_property_p);
+    index = 1;
+  }
+
+  ecma_property_pair_t *first_property_pair_p = (ecma_property_pair_t *) first_property_p;
+
+  first_property_p->types[index] = (ecma_property_t) (type_and_flags | name_type);
+  first_property_pair_p->values[index] = value;
+  first_property_p->shape_id = new_shape_id;
+
+  ecma_property_t *property_p = first_property_p->types + index;
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == first_property_pair_p->values + index);
+
+  if (out_prop_p != NULL)
+  {
+    *out_prop_p = property_p;
+  }
+
+  ecma_property_shape_deref (shape_id);
+  return first_property_pair_p->values + index;
+} /* ecma_property_shape_create_property */
+
+/**
+ * Find a property of a shaped object.
+ *
+ * @return pointer to the property - if it is found
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_property_shape_find (ecma_object_t *object_p, /**< shaped object */
+                          ecma_string_t *name_p, /**< property name */
+                          jmem_cpointer_t *property_name_cp_p) /**< [out] compressed pointer part
+                                                                *         of the property name */
+{
+  ecma_property_shape_t *shape_p = ecma_property_shape_get (ecma_property_shape_get_id (object_p));
+  uint32_t property_count = shape_p->property_count;
+  jmem_cpointer_t *names_p = ecma_property_shape_get_names (shape_p);
+  ecma_property_t *name_types_p = (ecma_property_t *) (names_p + property_count);
+  uint32_t name_index = 0;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t name_type = (ecma_property_t) ECMA_DIRECT_STRING_TYPE_TO_PROP_NAME_TYPE (name_p);
+    jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    while (names_p[name_index] != name_cp || name_types_p[name_index] != name_type)
+    {
+      if (++name_index >= property_count)
+      {
+        return NULL;
+      }
+    }
+  }
+  else
+  {
+    while (true)
+    {
+      if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[name_index]) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[name_index]);
+
+        if (prop_name_p == name_p || ecma_compare_ecma_non_direct_strings (name_p, prop_name_p))
+        {
+          break;
+        }
+      }
+
+      if (++name_index >= property_count)
+      {
+        return NULL;
+      }
+    }
+  }
+
+  *property_name_cp_p = names_p[name_index];
+
+  uint32_t position = (ECMA_PROPERTY_SHAPE_FIRST_INDEX (property_count) - (name_index & ~1u)) >> 1;
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                   object_p->u1.property_list_cp);
+
+  while (position > 0)
+  {
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    position--;
+  }
+
+  ecma_property_t *property_p = prop_iter_p->types + (1 - (name_index & 0x1));
+
+  JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (*property_p));
+  return property_p;
+} /* ecma_property_shape_find */
+
+#if JERRY_LCACHE
+
+/**
+ * Remove the properties of a shaped object from the LCache.
+ */
+void
+ecma_property_shape_invalidate_lcache (ecma_object_t *object_p) /**< shaped object */
+{
+  uint16_t shape_id = ecma_property_shape_get_id (object_p);
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+  uint32_t position = 0;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (prop_iter_p->types[i] & ECMA_PROPERTY_FLAG_LCACHED)
+      {
+        ecma_lcache_invalidate (object_p,
+                                ecma_property_shape_get_name (shape_id, position, i),
+                                prop_iter_p->types + i);
+      }
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+    position++;
+  }
+} /* ecma_property_shape_invalidate_lcache */
+
+#endif /* JERRY_LCACHE */
+
+/**
+ * Convert a shaped object to a dictionary object, which property pairs store the property names.
+ *
+ * Note: the order of the properties is unchanged, but the properties are moved
+ *
+ * @return the new address of the property value passed in prop_value_p (NULL if it is NULL)
+ */
+ecma_property_value_t *
+ecma_property_shape_to_dictionary (ecma_object_t *object_p, /**< shaped object */
+                                   ecma_property_value_t *prop_value_p) /**< property value of the object
+                                                                         *   or NULL */
+{
+  uint16_t shape_id = ecma_property_shape_get_id (object_p);
+  JERRY_ASSERT (shape_id != 0);
+
+  uint32_t pair_count = (ecma_property_shape_get (shape_id)->property_count + 1u) >> 1;
+  ecma_property_pair_t *new_pairs_p[ECMA_PROPERTY_SHAPE_MAX_PROPERTIES / 2];
+
+  /* The allocations may run the garbage collector, so the new pairs are only linked
+   * into the property list when all of them are allocated. */
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    new_pairs_p[i] = ecma_alloc_property_pair ();
+  }
+
+#if JERRY_LCACHE
+  ecma_property_shape_invalidate_lcache (object_p);
+#endif /* JERRY_LCACHE */
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  for (uint32_t position = 0; position < pair_count; position++)
+  {
+    ecma_property_pair_t *prop_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t, prop_iter_cp);
+    ecma_property_pair_t *new_pair_p = new_pairs_p[position];
+
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_pair_p->header.types[i];
+      jmem_cpointer_t name_cp = ecma_property_shape_get_name (shape_id, position, i);
+
+      JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (property)
+                    || (property == ECMA_PROPERTY_TYPE_DELETED && name_cp == LIT_INTERNAL_MAGIC_STRING_DELETED));
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+      }
+
+      new_pair_p->header.types[i] = property;
+      new_pair_p->values[i] = prop_pair_p->values[i];
+      new_pair_p->names_cp[i] = name_cp;
+
+      if (prop_pair_p->values + i == prop_value_p)
+      {
+        prop_value_p = new_pair_p->values + i;
+      }
+    }
+
+    new_pair_p->header.next_property_cp = JMEM_CP_NULL;
+
+    if (position + 1 < pair_count)
+    {
+      ECMA_SET_NON_NULL_POINTER (new_pair_p->header.next_property_cp, new_pairs_p[position + 1]);
+    }
+
+    prop_iter_cp = prop_pair_p->header.next_property_cp;
+    ecma_dealloc_shaped_property_pair (prop_pair_p);
+  }
+
+  JERRY_ASSERT (prop_iter_cp == JMEM_CP_NULL);
+
+  ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, new_pairs_p[0]);
+  ecma_property_shape_deref (shape_id);
+
+#if JERRY_VM_INLINE_CACHE
+  /* Inline cache entries of inherited properties refer to the properties directly. */
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (vm_inline_cache_epoch) == 0))
+  {
+    memset (JERRY_CONTEXT (vm_inline_cache), 0, sizeof (JERRY_CONTEXT (vm_inline_cache)));
+  }
+#endif /* JERRY_VM_INLINE_CACHE */
+
+  return prop_value_p;
+} /* ecma_property_shape_to_dictionary */
+
+/**
+ * Free the shape table.
+ */
+void
+ecma_property_shape_finalize (void)
+{
+  uint32_t count = JERRY_CONTEXT (property_shape_count);
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  /* All objects are freed, so only the empty shape is left. */
+  JERRY_ASSERT (JERRY_CONTEXT (property_shapes_p)[ECMA_PROPERTY_SHAPE_ROOT].first_child_id == 0);
+
+  jmem_heap_free_block (JERRY_CONTEXT (property_shapes_p), count * sizeof (ecma_property_shape_t));
+  JERRY_CONTEXT (property_shapes_p) = NULL;
+  JERRY_CONTEXT (property_shape_count) = 0;
+  JERRY_CONTEXT (property_shape_free_id) = 0;
+} /* ecma_property_shape_finalize */
+
+#endif /* JERRY_PROPERTY_SHAPES */
+
+/**
+ * @}
+ * @}
+ */
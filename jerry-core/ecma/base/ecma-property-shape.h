@@ -0,0 +1,70 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_PROPERTY_SHAPE_H
+#define ECMA_PROPERTY_SHAPE_H
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyshape Property shapes
+ * @{
+ */
+
+#if JERRY_PROPERTY_SHAPES
+
+/**
+ * Shape id of the empty shape.
+ */
+#define ECMA_PROPERTY_SHAPE_ROOT 1
+
+/**
+ * Maximum number of properties of a shaped object.
+ */
+#define ECMA_PROPERTY_SHAPE_MAX_PROPERTIES 32
+
+/**
+ * Maximum number of shapes which extend the same shape by one property.
+ */
+#define ECMA_PROPERTY_SHAPE_MAX_TRANSITIONS 64
+
+/**
+ * Size of a property pair of a shaped object, which has no name slots.
+ */
+#define ECMA_PROPERTY_SHAPE_PAIR_SIZE offsetof (ecma_property_pair_t, names_cp)
+
+uint16_t ecma_property_shape_get_id (const ecma_object_t *object_p);
+jmem_cpointer_t ecma_property_shape_get_name (uint16_t shape_id, uint32_t position, uint32_t index);
+ecma_property_value_t *ecma_property_shape_create_property (ecma_object_t *object_p, ecma_string_t *name_p,
+                                                            uint8_t type_and_flags, ecma_property_value_t value,
+                                                            ecma_property_t **out_prop_p);
+ecma_property_t *ecma_property_shape_find (ecma_object_t *object_p, ecma_string_t *name_p,
+                                           jmem_cpointer_t *property_name_cp_p);
+ecma_property_value_t *ecma_property_shape_to_dictionary (ecma_object_t *object_p,
+                                                          ecma_property_value_t *prop_value_p);
+#if JERRY_LCACHE
+void ecma_property_shape_invalidate_lcache (ecma_object_t *object_p);
+#endif /* JERRY_LCACHE */
+void ecma_property_shape_deref (uint16_t shape_id);
+void ecma_property_shape_finalize (void);
+
+#endif /* JERRY_PROPERTY_SHAPES */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_PROPERTY_SHAPE_H */
@@ -21,6 +21,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "lit-char-helpers.h"
 
 #if JERRY_BUILTIN_DATE
@@ -254,23 +255,159 @@ ecma_date_week_day (ecma_number_t time) /**< time value */
   return week_day >= 0 ? week_day : week_day + 7;
 } /* ecma_date_week_day */
 
+/**
+ * Distance of the time values in milliseconds, which are checked before
+ * a new interval is stored in the local time zone adjustment cache.
+ *
+ * Note:
+ *      the cache assumes that the time zone adjustment changes at most once
+ *      between these time values, which holds for daylight saving time
+ */
+#define ECMA_DATE_TZA_PROBE_DISTANCE (19 * ECMA_DATE_MS_PER_DAY)
+
+/**
+ * Find the time zone transition between two integer time values.
+ *
+ * @return the time value next to the transition, which has a different
+ *         time zone adjustment than tza
+ */
+static ecma_number_t
+ecma_date_find_tza_transition (ecma_number_t inside, /**< time value whose adjustment is tza */
+                               ecma_number_t outside, /**< time value whose adjustment is not tza */
+                               ecma_number_t tza) /**< local time zone adjustment */
+{
+  while (fabs (outside - inside) > 1)
+  {
+    ecma_number_t middle = floor ((inside + outside) / 2);
+
+    if (jerry_port_get_local_time_zone_adjustment (middle, true) == tza)
+    {
+      inside = middle;
+    }
+    else
+    {
+      outside = middle;
+    }
+  }
+
+  return outside;
+} /* ecma_date_find_tza_transition */
+
 /**
  * Abstract operation: LocalTZA
  *
+ * The adjustments are cached as intervals of time values, so the port
+ * is only called when the time value is outside of the cached intervals.
+ *
  *  See also:
  *          ECMA-262 v11, 20.4.1.7
  *
  * @return local time zone adjustment
  */
-extern inline ecma_number_t JERRY_ATTR_ALWAYS_INLINE
+ecma_number_t
 ecma_date_local_time_zone_adjustment (ecma_number_t time) /**< time value */
 {
-  return jerry_port_get_local_time_zone_adjustment (time, true);
+  /* Time values are integers, other values (including NaN) are not cached. */
+  if (time != floor (time) || fabs (time) > ECMA_DATE_MAX_VALUE)
+  {
+    return jerry_port_get_local_time_zone_adjustment (time, true);
+  }
+
+  ecma_date_tza_interval_t *cache_p = JERRY_CONTEXT (date_tza_cache);
+
+  for (uint32_t i = 0; i < ECMA_DATE_TZA_CACHE_SIZE; i++)
+  {
+    if (time >= cache_p[i].start && time < cache_p[i].end)
+    {
+      return cache_p[i].tza;
+    }
+  }
+
+  ecma_number_t tza = jerry_port_get_local_time_zone_adjustment (time, true);
+  ecma_number_t start = time - ECMA_DATE_TZA_PROBE_DISTANCE;
+  ecma_number_t end = time + ECMA_DATE_TZA_PROBE_DISTANCE;
+
+  if (jerry_port_get_local_time_zone_adjustment (start, true) != tza)
+  {
+    start = ecma_date_find_tza_transition (time, start, tza) + 1;
+  }
+
+  if (jerry_port_get_local_time_zone_adjustment (end, true) != tza)
+  {
+    end = ecma_date_find_tza_transition (time, end, tza);
+  }
+
+  /* Merge the new interval with the overlapping or adjacent intervals. */
+  uint32_t index = ECMA_DATE_TZA_CACHE_SIZE;
+
+  for (uint32_t i = 0; i < ECMA_DATE_TZA_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].tza == tza
+        && cache_p[i].start < cache_p[i].end
+        && cache_p[i].start <= end
+        && cache_p[i].end >= start)
+    {
+      start = JERRY_MIN (start, cache_p[i].start);
+      end = JERRY_MAX (end, cache_p[i].end);
+
+      if (index == ECMA_DATE_TZA_CACHE_SIZE)
+      {
+        index = i;
+      }
+      else
+      {
+        cache_p[i].end = cache_p[i].start;
+      }
+    }
+  }
+
+  if (index == ECMA_DATE_TZA_CACHE_SIZE)
+  {
+    index = JERRY_CONTEXT (date_tza_cache_next);
+    JERRY_CONTEXT (date_tza_cache_next) = (index + 1) % ECMA_DATE_TZA_CACHE_SIZE;
+  }
+
+  cache_p[index].start = start;
+  cache_p[index].end = end;
+  cache_p[index].tza = tza;
+  return tza;
 } /* ecma_date_local_time_zone_adjustment */
 
+/**
+ * Invalidate the cached local time zone adjustments, including
+ * the adjustments stored in the date objects.
+ */
+void
+ecma_date_reset_time_zone_cache (void)
+{
+  memset (JERRY_CONTEXT (date_tza_cache), 0, sizeof (JERRY_CONTEXT (date_tza_cache)));
+  JERRY_CONTEXT (date_tza_cache_next) = 0;
+
+#if JERRY_ESNEXT
+  jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *iter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, iter_cp);
+
+    if (!ecma_is_lexical_environment (iter_p)
+        && ecma_object_class_is (iter_p, ECMA_OBJECT_CLASS_DATE))
+    {
+      ecma_date_object_t *date_object_p = (ecma_date_object_t *) iter_p;
+      date_object_p->header.u.cls.u1.date_flags &= (uint8_t) ~ECMA_DATE_TZA_SET;
+    }
+
+    iter_cp = iter_p->gc_next_cp;
+  }
+#endif /* JERRY_ESNEXT */
+} /* ecma_date_reset_time_zone_cache */
+
 /**
  * Abstract operation: UTC
  *
+ * The local time is converted by the adjustment of the UTC time value,
+ * which is computed from the adjustment of the local time value.
+ *
  *  See also:
  *          ECMA-262 v11, 20.4.1.9
  *
@@ -279,7 +416,8 @@ ecma_date_local_time_zone_adjustment (ecma_number_t time) /**< time value */
 ecma_number_t
 ecma_date_utc (ecma_number_t time) /**< time value */
 {
-  return time - jerry_port_get_local_time_zone_adjustment (time, false);
+  ecma_number_t tza = ecma_date_local_time_zone_adjustment (time);
+  return time - ecma_date_local_time_zone_adjustment (time - tza);
 } /* ecma_date_utc */
 
 /**
@@ -28,31 +28,138 @@
  */
 
 /**
- * Check whether the object is pushed onto the occurence stack
+ * Compute the hash of an object in the occurence set
+ *
+ * @return hash of the object
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_json_occurence_set_hash (ecma_object_t *object_p) /**< object */
+{
+  return (uint32_t) ((uintptr_t) object_p >> JMEM_ALIGNMENT_LOG) * 2654435761u;
+} /* ecma_json_occurence_set_hash */
+
+/**
+ * Insert an object into the occurence set
  *
  * Used by:
- *         - ecma_builtin_json_object step 1
- *         - ecma_builtin_json_array step 1
+ *         - ecma_builtin_json_serialize_object step 1
+ *         - ecma_builtin_json_serialize_array step 1
  *
- * @return true - if the object is pushed onto the occurence stack
- *         false - otherwise
+ * @return true - if the object is inserted
+ *         false - if the object is already in the set (the structure is cyclical)
  */
 bool
-ecma_json_has_object_in_stack (ecma_json_occurence_stack_item_t *stack_p, /**< stack */
-                               ecma_object_t *object_p) /**< object */
+ecma_json_occurence_set_insert (ecma_json_occurence_set_t *set_p, /**< occurence set */
+                                ecma_object_t *object_p) /**< object */
 {
-  while (stack_p != NULL)
+  if ((set_p->count + 1) * 2 > set_p->size)
   {
-    if (stack_p->object_p == object_p)
+    /* Keep the load factor below 50%, so the probe sequences remain short. */
+    ecma_object_t **old_buffer_p = set_p->buffer_p;
+    uint32_t old_size = set_p->size;
+    uint32_t new_size = (old_size == 0) ? 16 : old_size * 2;
+
+    set_p->buffer_p = (ecma_object_t **) jmem_heap_alloc_block (new_size * sizeof (ecma_object_t *));
+    set_p->size = new_size;
+    memset (set_p->buffer_p, 0, new_size * sizeof (ecma_object_t *));
+
+    for (uint32_t i = 0; i < old_size; i++)
     {
-      return true;
+      if (old_buffer_p[i] != NULL)
+      {
+        uint32_t index = ecma_json_occurence_set_hash (old_buffer_p[i]) & (new_size - 1);
+
+        while (set_p->buffer_p[index] != NULL)
+        {
+          index = (index + 1) & (new_size - 1);
+        }
+
+        set_p->buffer_p[index] = old_buffer_p[i];
+      }
     }
 
-    stack_p = stack_p->next_p;
+    if (old_buffer_p != NULL)
+    {
+      jmem_heap_free_block (old_buffer_p, old_size * sizeof (ecma_object_t *));
+    }
   }
 
-  return false;
-} /* ecma_json_has_object_in_stack */
+  uint32_t mask = set_p->size - 1;
+  uint32_t index = ecma_json_occurence_set_hash (object_p) & mask;
+
+  while (set_p->buffer_p[index] != NULL)
+  {
+    if (set_p->buffer_p[index] == object_p)
+    {
+      return false;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  set_p->buffer_p[index] = object_p;
+  set_p->count++;
+  return true;
+} /* ecma_json_occurence_set_insert */
+
+/**
+ * Remove an object from the occurence set
+ *
+ * Used by:
+ *         - ecma_builtin_json_serialize_object step 11
+ *         - ecma_builtin_json_serialize_array step 12
+ */
+void
+ecma_json_occurence_set_remove (ecma_json_occurence_set_t *set_p, /**< occurence set */
+                                ecma_object_t *object_p) /**< object */
+{
+  uint32_t mask = set_p->size - 1;
+  uint32_t index = ecma_json_occurence_set_hash (object_p) & mask;
+
+  while (set_p->buffer_p[index] != object_p)
+  {
+    JERRY_ASSERT (set_p->buffer_p[index] != NULL);
+    index = (index + 1) & mask;
+  }
+
+  /* Shift back the following items of the probe sequence, so no tombstones are needed. */
+  uint32_t next_index = index;
+
+  while (true)
+  {
+    next_index = (next_index + 1) & mask;
+    ecma_object_t *next_p = set_p->buffer_p[next_index];
+
+    if (next_p == NULL)
+    {
+      break;
+    }
+
+    uint32_t home_index = ecma_json_occurence_set_hash (next_p) & mask;
+
+    /* The item can be moved when its home index is not in the cyclic range (index, next_index]. */
+    if (((next_index - home_index) & mask) >= ((next_index - index) & mask))
+    {
+      set_p->buffer_p[index] = next_p;
+      index = next_index;
+    }
+  }
+
+  set_p->buffer_p[index] = NULL;
+  set_p->count--;
+} /* ecma_json_occurence_set_remove */
+
+/**
+ * Free the occurence set
+ */
+void
+ecma_json_occurence_set_free (ecma_json_occurence_set_t *set_p) /**< occurence set */
+{
+  if (set_p->buffer_p != NULL)
+  {
+    jmem_heap_free_block (set_p->buffer_p, set_p->size * sizeof (ecma_object_t *));
+  }
+} /* ecma_json_occurence_set_free */
 
 #endif /* JERRY_BUILTIN_JSON */
 
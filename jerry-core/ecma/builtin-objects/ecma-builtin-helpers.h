@@ -51,8 +51,8 @@ ecma_value_t
 ecma_builtin_helper_uint32_index_normalize (ecma_value_t arg, uint32_t length, uint32_t *number_p);
 ecma_value_t
 ecma_builtin_helper_array_index_normalize (ecma_value_t arg, ecma_length_t length, ecma_length_t *number_p);
-ecma_value_t
-ecma_builtin_helper_string_index_normalize (ecma_number_t index, uint32_t length, bool nan_to_zero);
+lit_utf8_size_t
+ecma_builtin_helper_string_index_normalize (ecma_number_t index, lit_utf8_size_t length, bool nan_to_zero);
 ecma_value_t
 ecma_builtin_helper_string_prototype_object_index_of (ecma_string_t *original_str_p, ecma_value_t arg1,
                                                       ecma_value_t arg2, ecma_string_index_of_mode_t mode);
@@ -166,6 +166,7 @@ int32_t ecma_date_ms_from_time (ecma_number_t time);
 int32_t ecma_date_time_in_day_from_time (ecma_number_t time);
 
 ecma_number_t ecma_date_local_time_zone_adjustment (ecma_number_t time);
+void ecma_date_reset_time_zone_cache (void);
 ecma_number_t ecma_date_utc (ecma_number_t time);
 ecma_number_t ecma_date_make_time (ecma_number_t hour, ecma_number_t min, ecma_number_t sec, ecma_number_t ms);
 ecma_number_t ecma_date_make_day (ecma_number_t year, ecma_number_t month, ecma_number_t date);
@@ -184,13 +185,14 @@ ecma_value_t ecma_date_value_to_time_string (ecma_number_t datetime_number);
 /* ecma-builtin-helper-json.c */
 
 /**
- * Occurence stack item of JSON.stringify()
+ * Set of the objects which are currently serialized by JSON.stringify()
  */
-typedef struct struct_ecma_json_occurence_stack_item_t
+typedef struct
 {
-  struct struct_ecma_json_occurence_stack_item_t *next_p; /**< next stack item */
-  ecma_object_t *object_p; /**< current object */
-} ecma_json_occurence_stack_item_t;
+  ecma_object_t **buffer_p; /**< open addressing hash table of the objects */
+  uint32_t size; /**< size of the hash table (zero or a power of 2) */
+  uint32_t count; /**< number of the objects in the hash table */
+} ecma_json_occurence_set_t;
 
 /**
  * Context for JSON.stringify()
@@ -200,8 +202,8 @@ typedef struct
   /** Collection for property keys. */
   ecma_collection_t *property_list_p;
 
-  /** Collection for traversing objects. */
-  ecma_json_occurence_stack_item_t *occurence_stack_last_p;
+  /** Objects which are currently traversed. */
+  ecma_json_occurence_set_t occurence_set;
 
   /** The actual indentation text. */
   ecma_stringbuilder_t indent_builder;
@@ -217,9 +219,13 @@ typedef struct
 } ecma_json_stringify_context_t;
 
 ecma_value_t ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p,
-                                             lit_utf8_size_t string_size);
+                                             lit_utf8_size_t string_size,
+                                             uint32_t options);
+ecma_value_t ecma_builtin_json_parse_stream (jerry_json_read_callback_t read_cb, void *user_p);
 ecma_value_t ecma_builtin_json_stringify_no_opts (const ecma_value_t value);
-bool ecma_json_has_object_in_stack (ecma_json_occurence_stack_item_t *stack_p, ecma_object_t *object_p);
+bool ecma_json_occurence_set_insert (ecma_json_occurence_set_t *set_p, ecma_object_t *object_p);
+void ecma_json_occurence_set_remove (ecma_json_occurence_set_t *set_p, ecma_object_t *object_p);
+void ecma_json_occurence_set_free (ecma_json_occurence_set_t *set_p);
 
 ecma_value_t
 ecma_builtin_helper_json_create_non_formatted_json (lit_utf8_byte_t left_bracket, lit_utf8_byte_t right_bracket,
@@ -25,6 +25,8 @@
 #include "ecma-builtin-helpers.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "ecma-property-shape.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -44,6 +46,11 @@
  */
 #define ECMA_JSON_HEX_ESCAPE_SEQUENCE_LENGTH (4)
 
+/**
+ * Initial size of the buffer which holds the current chunk of a streamed JSON text
+ */
+#define ECMA_JSON_STREAM_BUFFER_SIZE (4096)
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -82,6 +89,13 @@ typedef struct
   ecma_json_token_type_t type; /**< type of the current token */
   const lit_utf8_byte_t *current_p; /**< current position of the string processed by the parser */
   const lit_utf8_byte_t *end_p; /**< end of the string processed by the parser */
+  uint32_t options; /**< combination of jerry_json_parse_option_enable_feature_t values */
+  jerry_json_read_callback_t read_cb; /**< callback which reads the next chunk of a streamed JSON text
+                                       *   (NULL if the whole text is available) */
+  void *user_p; /**< user pointer passed to read_cb */
+  bool read_failed; /**< read_cb has returned JERRY_JSON_READ_ERROR */
+  lit_utf8_byte_t *buffer_p; /**< buffer of a streamed JSON text */
+  lit_utf8_size_t buffer_size; /**< size of the buffer */
 
   /**
    * Fields depending on type.
@@ -93,6 +107,132 @@ typedef struct
   } u;
 } ecma_json_token_t;
 
+/**
+ * Read the next chunk of a streamed JSON text.
+ *
+ * The bytes starting from *keep_p are moved to the beginning of the buffer
+ * (the buffer is grown when they fill it), and the new chunk is appended
+ * after them. The token positions and *keep_p are updated accordingly.
+ *
+ * @return true - if new bytes are available
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_read_chunk (ecma_json_token_t *token_p, /**< token argument */
+                              const lit_utf8_byte_t **keep_p) /**< [in, out] first byte which must be kept */
+{
+  if (token_p->read_cb == NULL)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t keep_size = (lit_utf8_size_t) (token_p->end_p - *keep_p);
+
+  if (keep_size > 0)
+  {
+    memmove (token_p->buffer_p, *keep_p, keep_size);
+  }
+
+  if (keep_size == token_p->buffer_size)
+  {
+    lit_utf8_size_t new_size = token_p->buffer_size * 2;
+    token_p->buffer_p = jmem_heap_realloc_block (token_p->buffer_p, token_p->buffer_size, new_size);
+    token_p->buffer_size = new_size;
+  }
+
+  lit_utf8_size_t free_size = token_p->buffer_size - keep_size;
+  jerry_size_t read_size = token_p->read_cb (token_p->buffer_p + keep_size, free_size, token_p->user_p);
+
+  if (read_size == JERRY_JSON_READ_ERROR)
+  {
+    /* The rest of the text is treated as missing, the error is reported after the parsing. */
+    token_p->read_failed = true;
+    read_size = 0;
+  }
+
+  JERRY_ASSERT (read_size <= free_size);
+
+  if (read_size == 0)
+  {
+    /* End of the text. */
+    token_p->read_cb = NULL;
+  }
+
+  *keep_p = token_p->buffer_p;
+  token_p->current_p = token_p->buffer_p;
+  token_p->end_p = token_p->buffer_p + keep_size + read_size;
+  return read_size > 0;
+} /* ecma_builtin_json_read_chunk */
+
+/**
+ * Read the chunks of a streamed JSON text until the whole token
+ * starting at *start_p, and the byte after it, is in the buffer.
+ */
+static void
+ecma_builtin_json_read_token (ecma_json_token_t *token_p, /**< token argument */
+                              const lit_utf8_byte_t **start_p) /**< [in, out] start of the token */
+{
+  bool is_string = (**start_p == LIT_CHAR_DOUBLE_QUOTE);
+  lit_utf8_size_t offset = 1;
+
+  do
+  {
+    const lit_utf8_byte_t *current_p = *start_p + offset;
+    const lit_utf8_byte_t *end_p = token_p->end_p;
+
+    if (is_string)
+    {
+      while (current_p < end_p)
+      {
+        const lit_utf8_byte_t *quote_p = memchr (current_p, LIT_CHAR_DOUBLE_QUOTE, (size_t) (end_p - current_p));
+
+        if (quote_p == NULL)
+        {
+          current_p = end_p;
+          break;
+        }
+
+        /* The quote is escaped when it is preceded by an odd number of backslashes. */
+        const lit_utf8_byte_t *backslash_p = quote_p;
+
+        while (backslash_p > *start_p + 1 && backslash_p[-1] == LIT_CHAR_BACKSLASH)
+        {
+          backslash_p--;
+        }
+
+        if (((quote_p - backslash_p) & 0x1) == 0)
+        {
+          return;
+        }
+
+        current_p = quote_p + 1;
+      }
+    }
+    else
+    {
+      while (current_p < end_p)
+      {
+        lit_utf8_byte_t c = *current_p;
+
+        if (!lit_char_is_decimal_digit (c)
+            && !(c >= LIT_CHAR_LOWERCASE_A && c <= LIT_CHAR_LOWERCASE_Z)
+            && c != LIT_CHAR_MINUS
+            && c != LIT_CHAR_PLUS
+            && c != LIT_CHAR_DOT
+            && c != LIT_CHAR_UPPERCASE_E)
+        {
+          return;
+        }
+
+        current_p++;
+      }
+    }
+
+    offset = (lit_utf8_size_t) (current_p - *start_p);
+  }
+  while (ecma_builtin_json_read_chunk (token_p, start_p));
+} /* ecma_builtin_json_read_token */
+
 /**
  * Parse and extract string token.
  */
@@ -102,6 +242,32 @@ ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
 
+  if (token_p->options & JERRY_JSON_PARSE_EXTERNAL_STRINGS)
+  {
+    const lit_utf8_byte_t *string_end_p = current_p;
+
+    while (string_end_p < end_p
+           && *string_end_p > 0x1f
+           && *string_end_p != LIT_CHAR_DOUBLE_QUOTE
+           && *string_end_p != LIT_CHAR_BACKSLASH)
+    {
+      string_end_p++;
+    }
+
+    lit_utf8_size_t string_size = (lit_utf8_size_t) (string_end_p - current_p);
+
+    if (string_end_p < end_p
+        && *string_end_p == LIT_CHAR_DOUBLE_QUOTE
+        && lit_is_valid_cesu8_string (current_p, string_size))
+    {
+      /* The string has no escape sequences, so it can refer to the JSON text. */
+      token_p->u.string_p = ecma_new_ecma_external_string_from_cesu8 (current_p, string_size, NULL);
+      token_p->current_p = string_end_p + 1;
+      token_p->type = TOKEN_STRING;
+      return;
+    }
+  }
+
   ecma_stringbuilder_t result_builder = ecma_stringbuilder_create ();
   const lit_utf8_byte_t *unappended_p = current_p;
 
@@ -306,19 +472,36 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argum
   const lit_utf8_byte_t *end_p = token_p->end_p;
   token_p->type = TOKEN_INVALID;
 
-  while (current_p < end_p
-         && (*current_p == LIT_CHAR_SP
-             || *current_p == LIT_CHAR_CR
-             || *current_p == LIT_CHAR_LF
-             || *current_p == LIT_CHAR_TAB))
+  while (true)
   {
-    current_p++;
+    while (current_p < end_p
+           && (*current_p == LIT_CHAR_SP
+               || *current_p == LIT_CHAR_CR
+               || *current_p == LIT_CHAR_LF
+               || *current_p == LIT_CHAR_TAB))
+    {
+      current_p++;
+    }
+
+    if (current_p < end_p)
+    {
+      break;
+    }
+
+    if (!ecma_builtin_json_read_chunk (token_p, &current_p))
+    {
+      token_p->type = TOKEN_END;
+      return;
+    }
+
+    end_p = token_p->end_p;
   }
 
-  if (current_p == end_p)
+  if (token_p->read_cb != NULL
+      && (parse_string || *current_p != LIT_CHAR_DOUBLE_QUOTE))
   {
-    token_p->type = TOKEN_END;
-    return;
+    ecma_builtin_json_read_token (token_p, &current_p);
+    end_p = token_p->end_p;
   }
 
   switch (*current_p)
@@ -790,6 +973,32 @@ ecma_value_t ecma_builtin_json_internalize_process_property (ecma_object_t *revi
   return ECMA_VALUE_TRUE;
 } /* ecma_builtin_json_internalize_process_property */
 
+/**
+ * Parse the JSON text described by the token.
+ *
+ * @return ecma_value_t containing an object or an error massage
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parse_text (ecma_json_token_t *token_p) /**< token argument */
+{
+  ecma_builtin_json_parse_next_token (token_p, true);
+  ecma_value_t result = ecma_builtin_json_parse_value (token_p);
+
+  if (!ecma_is_value_empty (result))
+  {
+    ecma_builtin_json_parse_next_token (token_p, false);
+    if (token_p->type == TOKEN_END)
+    {
+      return result;
+    }
+
+    ecma_free_value (result);
+  }
+
+  return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format"));
+} /* ecma_builtin_json_parse_text */
+
 /**
  * Function to set a string token from the given arguments, fills its fields and advances the string pointer.
  *
@@ -798,28 +1007,64 @@ ecma_value_t ecma_builtin_json_internalize_process_property (ecma_object_t *revi
  */
 ecma_value_t
 ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p, /**< String to parse */
-                                lit_utf8_size_t string_size) /**< size of the string */
+                                lit_utf8_size_t string_size, /**< size of the string */
+                                uint32_t options) /**< combination of jerry_json_parse_option_enable_feature_t
+                                                   *   values */
 {
   ecma_json_token_t token;
   token.current_p = str_start_p;
   token.end_p = str_start_p + string_size;
+  token.options = options;
+  token.read_cb = NULL;
 
-  ecma_builtin_json_parse_next_token (&token, true);
-  ecma_value_t result = ecma_builtin_json_parse_value (&token);
+  return ecma_builtin_json_parse_text (&token);
+} /*ecma_builtin_json_parse_buffer*/
 
-  if (!ecma_is_value_empty (result))
+/**
+ * Parse a JSON text which is read in chunks by a callback.
+ *
+ * Only the current token is kept in memory, so the whole text is never stored.
+ *
+ * @return ecma_value_t containing an object or an error massage
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_parse_stream (jerry_json_read_callback_t read_cb, /**< callback which reads the next chunk */
+                                void *user_p) /**< user pointer passed to read_cb */
+{
+  JERRY_ASSERT (read_cb != NULL);
+
+  ecma_json_token_t token;
+  token.buffer_size = ECMA_JSON_STREAM_BUFFER_SIZE;
+  token.buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (token.buffer_size);
+  token.current_p = token.buffer_p;
+  token.end_p = token.buffer_p;
+  token.options = JERRY_JSON_PARSE_NO_OPTS;
+  token.read_cb = read_cb;
+  token.user_p = user_p;
+  token.read_failed = false;
+
+  ecma_value_t result = ecma_builtin_json_parse_text (&token);
+
+  jmem_heap_free_block (token.buffer_p, token.buffer_size);
+
+  if (JERRY_UNLIKELY (token.read_failed))
   {
-    ecma_builtin_json_parse_next_token (&token, false);
-    if (token.type == TOKEN_END)
+    /* A valid prefix of the text must not be returned as the result. */
+    if (ECMA_IS_VALUE_ERROR (result))
     {
-      return result;
+      jcontext_release_exception ();
+    }
+    else
+    {
+      ecma_free_value (result);
     }
 
-    ecma_free_value (result);
+    return ecma_raise_common_error (ECMA_ERR_MSG ("JSON text cannot be read"));
   }
 
-  return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format"));
-} /*ecma_builtin_json_parse_buffer*/
+  return result;
+} /* ecma_builtin_json_parse_stream */
 
 /**
  * The JSON object's 'parse' routine
@@ -845,7 +1090,7 @@ ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
   }
 
   ECMA_STRING_TO_UTF8_STRING (text_string_p, str_start_p, string_size);
-  ecma_value_t result = ecma_builtin_json_parse_buffer (str_start_p, string_size);
+  ecma_value_t result = ecma_builtin_json_parse_buffer (str_start_p, string_size, JERRY_JSON_PARSE_NO_OPTS);
   ECMA_FINALIZE_UTF8_STRING (str_start_p, string_size);
   ecma_deref_ecma_string (text_string_p);
 
@@ -885,6 +1130,16 @@ ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< builder for the r
 
   ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 
+  /* Skip the leading ASCII characters which need no escaping without decoding them. */
+  while (str_p < str_end_p
+         && *str_p >= LIT_CHAR_SP
+         && *str_p <= LIT_UTF8_1_BYTE_CODE_POINT_MAX
+         && *str_p != LIT_CHAR_DOUBLE_QUOTE
+         && *str_p != LIT_CHAR_BACKSLASH)
+  {
+    str_p++;
+  }
+
   while (str_p < str_end_p)
   {
     ecma_char_t c = lit_cesu8_read_next (&str_p);
@@ -987,6 +1242,118 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
                                       ecma_object_t *holder_p,
                                       ecma_string_t *key_p);
 
+static ecma_value_t
+ecma_builtin_json_serialize_value (ecma_json_stringify_context_t *context_p,
+                                   ecma_object_t *holder_p,
+                                   ecma_string_t *key_p,
+                                   ecma_value_t value);
+
+/**
+ * Collect the enumerable string keys of an ordinary object by walking its property list.
+ *
+ * This is a faster form of EnumerableOwnPropertyNames, which does not need
+ * to look up the descriptors and to sort the keys of ordinary objects.
+ *
+ * @return collection of the keys in creation order
+ *         NULL - if the object is not an ordinary object or it has array index keys
+ */
+static ecma_collection_t *
+ecma_builtin_json_get_ordinary_object_keys (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL
+      || ecma_get_object_is_builtin (obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_collection_t *keys_p = ecma_new_collection ();
+  jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_cp = prop_iter_p->next_property_cp;
+    }
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+#if JERRY_PROPERTY_SHAPES
+  uint16_t shape_id = ecma_property_shape_get_id (obj_p);
+  uint32_t position = 0;
+#endif /* JERRY_PROPERTY_SHAPES */
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_iter_p->types[i];
+
+      if (!ECMA_PROPERTY_IS_RAW (property) || !(property & ECMA_PROPERTY_FLAG_ENUMERABLE))
+      {
+        continue;
+      }
+
+#if JERRY_PROPERTY_SHAPES
+      jmem_cpointer_t name_cp = ((shape_id != 0) ? ecma_property_shape_get_name (shape_id, position, i)
+                                                 : ((ecma_property_pair_t *) prop_iter_p)->names_cp[i]);
+#else /* !JERRY_PROPERTY_SHAPES */
+      jmem_cpointer_t name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[i];
+#endif /* JERRY_PROPERTY_SHAPES */
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+          && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+          && name_cp < LIT_MAGIC_STRING__COUNT)
+      {
+        continue;
+      }
+
+      ecma_string_t *name_p = ecma_string_from_property_name (property, name_cp);
+
+#if JERRY_ESNEXT
+      if (ecma_prop_name_is_symbol (name_p))
+      {
+        ecma_deref_ecma_string (name_p);
+        continue;
+      }
+#endif /* JERRY_ESNEXT */
+
+      if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+      {
+        /* Array index keys must be listed in ascending order first. */
+        ecma_deref_ecma_string (name_p);
+        ecma_collection_free (keys_p);
+        return NULL;
+      }
+
+      ecma_collection_push_back (keys_p, ecma_make_string_value (name_p));
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+#if JERRY_PROPERTY_SHAPES
+    position++;
+#endif /* JERRY_PROPERTY_SHAPES */
+  }
+
+  /* The properties are stored in reverse creation order. */
+  ecma_value_t *buffer_p = keys_p->buffer_p;
+
+  for (uint32_t i = 0, j = keys_p->item_count; i + 1 < j; i++, j--)
+  {
+    ecma_value_t key = buffer_p[i];
+    buffer_p[i] = buffer_p[j - 1];
+    buffer_p[j - 1] = key;
+  }
+
+  return keys_p;
+} /* ecma_builtin_json_get_ordinary_object_keys */
+
 /**
  * Abstract operation 'SerializeJSONObject' defined in 24.3.2.3
  *
@@ -997,18 +1364,12 @@ static ecma_value_t
 ecma_builtin_json_serialize_object (ecma_json_stringify_context_t *context_p, /**< context*/
                                     ecma_object_t *obj_p) /**< the object*/
 {
-  /* 1. */
-  if (ecma_json_has_object_in_stack (context_p->occurence_stack_last_p, obj_p))
+  /* 1. - 2. */
+  if (!ecma_json_occurence_set_insert (&context_p->occurence_set, obj_p))
   {
     return ecma_raise_type_error (ECMA_ERR_MSG ("The structure is cyclical"));
   }
 
-  /* 2. */
-  ecma_json_occurence_stack_item_t stack_item;
-  stack_item.next_p = context_p->occurence_stack_last_p;
-  stack_item.object_p = obj_p;
-  context_p->occurence_stack_last_p = &stack_item;
-
   /* 3. - 4.*/
   const lit_utf8_size_t stepback_size = ecma_stringbuilder_get_size (&context_p->indent_builder);
   ecma_stringbuilder_append (&context_p->indent_builder, context_p->gap_str_p);
@@ -1025,7 +1386,12 @@ ecma_builtin_json_serialize_object (ecma_json_stringify_context_t *context_p, /*
   /* 6. */
   else
   {
-    property_keys_p = ecma_op_object_get_enumerable_property_names (obj_p, ECMA_ENUMERABLE_PROPERTY_KEYS);
+    property_keys_p = ecma_builtin_json_get_ordinary_object_keys (obj_p);
+
+    if (property_keys_p == NULL)
+    {
+      property_keys_p = ecma_op_object_get_enumerable_property_names (obj_p, ECMA_ENUMERABLE_PROPERTY_KEYS);
+    }
 
 #if JERRY_BUILTIN_PROXY
     if (property_keys_p == NULL)
@@ -1103,7 +1469,7 @@ ecma_builtin_json_serialize_object (ecma_json_stringify_context_t *context_p, /*
   result = ECMA_VALUE_EMPTY;
 
   /* 11. */
-  context_p->occurence_stack_last_p = stack_item.next_p;
+  ecma_json_occurence_set_remove (&context_p->occurence_set, obj_p);
 
   /* 12. */
   ecma_stringbuilder_revert (&context_p->indent_builder, stepback_size);
@@ -1134,18 +1500,12 @@ ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**
   JERRY_ASSERT (ecma_is_value_true (is_array));
 #endif /* !JERRY_NDEBUG */
 
-  /* 1. */
-  if (ecma_json_has_object_in_stack (context_p->occurence_stack_last_p, obj_p))
+  /* 1. - 2. */
+  if (!ecma_json_occurence_set_insert (&context_p->occurence_set, obj_p))
   {
     return ecma_raise_type_error (ECMA_ERR_MSG ("The structure is cyclical"));
   }
 
-  /* 2. */
-  ecma_json_occurence_stack_item_t stack_item;
-  stack_item.next_p = context_p->occurence_stack_last_p;
-  stack_item.object_p = obj_p;
-  context_p->occurence_stack_last_p = &stack_item;
-
   /* 3. - 4.*/
   const lit_utf8_size_t stepback_size = ecma_stringbuilder_get_size (&context_p->indent_builder);
   ecma_stringbuilder_append (&context_p->indent_builder, context_p->gap_str_p);
@@ -1183,7 +1543,27 @@ ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**
                                      separator_size);
     }
 
-    ecma_value_t result = ecma_builtin_json_serialize_property (context_p, obj_p, index_str_p);
+    ecma_value_t element = ECMA_VALUE_ARRAY_HOLE;
+
+    /* The element is read directly from the buffer of fast arrays. The array is checked
+     * for each element, since toJSON or a getter may change it during the serialization. */
+    if (ecma_op_object_is_fast_array (obj_p)
+        && index < ((ecma_extended_object_t *) obj_p)->u.array.length)
+    {
+      element = ECMA_GET_NON_NULL_POINTER (ecma_value_t, obj_p->u1.property_list_cp)[index];
+    }
+
+    ecma_value_t result;
+
+    if (!ecma_is_value_array_hole (element))
+    {
+      result = ecma_builtin_json_serialize_value (context_p, obj_p, index_str_p, ecma_fast_copy_value (element));
+    }
+    else
+    {
+      result = ecma_builtin_json_serialize_property (context_p, obj_p, index_str_p);
+    }
+
     ecma_deref_ecma_string (index_str_p);
 
     if (ECMA_IS_VALUE_ERROR (result))
@@ -1220,7 +1600,7 @@ ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**
   ecma_stringbuilder_append_byte (&context_p->result_builder, LIT_CHAR_RIGHT_SQUARE);
 
   /* 12. */
-  context_p->occurence_stack_last_p = stack_item.next_p;
+  ecma_json_occurence_set_remove (&context_p->occurence_set, obj_p);
 
   /* 13. */
   ecma_stringbuilder_revert (&context_p->indent_builder, stepback_size);
@@ -1248,6 +1628,24 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
     return value;
   }
 
+  return ecma_builtin_json_serialize_value (context_p, holder_p, key_p, value);
+} /* ecma_builtin_json_serialize_property */
+
+/**
+ * Steps 3. - 12. of abstract operation 'SerializeJSONProperty' defined in 24.3.2.1
+ *
+ * Note:
+ *      the value is released by this function
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_serialize_value (ecma_json_stringify_context_t *context_p, /**< context*/
+                                   ecma_object_t *holder_p, /**< the object*/
+                                   ecma_string_t *key_p, /**< property key*/
+                                   ecma_value_t value) /**< value of the property */
+{
   /* 3. */
   if (ecma_is_value_object (value) || ecma_is_value_bigint (value))
   {
@@ -1408,11 +1806,12 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
     /* 10.a */
     if (!ecma_number_is_nan (num_value) && !ecma_number_is_infinity (num_value))
     {
-      ecma_string_t *result_string_p = ecma_op_to_string (value);
-      JERRY_ASSERT (result_string_p != NULL);
+      lit_utf8_byte_t num_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+      lit_utf8_size_t num_size = ecma_number_to_utf8_string (num_value,
+                                                             num_buffer,
+                                                             ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER);
 
-      ecma_stringbuilder_append (&context_p->result_builder, result_string_p);
-      ecma_deref_ecma_string (result_string_p);
+      ecma_stringbuilder_append_raw (&context_p->result_builder, num_buffer, num_size);
     }
     else
     {
@@ -1466,7 +1865,7 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
   /* 12. */
   ecma_free_value (value);
   return ECMA_VALUE_UNDEFINED;
-} /* ecma_builtin_json_serialize_property */
+} /* ecma_builtin_json_serialize_value */
 
 /**
  * Helper function to stringify an object in JSON format representing an ecma_value.
@@ -1489,6 +1888,9 @@ static ecma_value_t ecma_builtin_json_str_helper (ecma_json_stringify_context_t
   JERRY_ASSERT (ecma_is_value_true (put_comp_val));
 
   context_p->result_builder = ecma_stringbuilder_create ();
+  context_p->occurence_set.buffer_p = NULL;
+  context_p->occurence_set.size = 0;
+  context_p->occurence_set.count = 0;
 
   if (!ecma_compare_ecma_string_to_magic_id (context_p->gap_str_p, LIT_MAGIC_STRING__EMPTY))
   {
@@ -1497,6 +1899,7 @@ static ecma_value_t ecma_builtin_json_str_helper (ecma_json_stringify_context_t
 
   ret_value = ecma_builtin_json_serialize_property (context_p, obj_wrapper_p, empty_str_p);
   ecma_deref_object (obj_wrapper_p);
+  ecma_json_occurence_set_free (&context_p->occurence_set);
 
   if (ECMA_IS_VALUE_ERROR (ret_value) || ecma_is_value_undefined (ret_value))
   {
@@ -1520,7 +1923,6 @@ ecma_value_t
 ecma_builtin_json_stringify_no_opts (const ecma_value_t value) /**< value to stringify */
 {
   ecma_json_stringify_context_t context;
-  context.occurence_stack_last_p = NULL;
   context.indent_builder = ecma_stringbuilder_create ();
   context.property_list_p = NULL;
   context.replacer_function_p = NULL;
@@ -1772,7 +2174,6 @@ ecma_builtin_json_stringify (ecma_value_t this_arg, /**< 'this' argument */
   ecma_free_value (space);
 
   /* 1., 2., 3. */
-  context.occurence_stack_last_p = NULL;
   context.indent_builder = ecma_stringbuilder_create ();
 
   /* 9. */
@@ -1052,7 +1052,8 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
 #if JERRY_BUILTIN_REALMS
   if (index >= 8 * sizeof (uint8_t))
   {
-    bitset_p += sizeof (ecma_value_t);
+    /* The rest of the bit set is stored after the realm value. */
+    bitset_p = ((uint8_t *) (built_in_props_p + 1)) + ((index >> 3) - 1);
   }
 #endif /* JERRY_BUILTIN_REALMS */
 
@@ -1360,7 +1361,7 @@ ecma_builtin_list_lazy_property_names (ecma_object_t *object_p, /**< a built-in
   uint8_t bitset = built_in_props_p->u2.instantiated_bitset[0];
 
 #if JERRY_BUILTIN_REALMS
-  uint8_t *bitset_p = built_in_props_p->u2.instantiated_bitset + 1 + sizeof (ecma_value_t);
+  uint8_t *bitset_p = (uint8_t *) (built_in_props_p + 1);
 #else /* !JERRY_BUILTIN_REALMS */
   uint8_t *bitset_p = built_in_props_p->u2.instantiated_bitset + 1;
 #endif /* JERRY_BUILTIN_REALMS */
@@ -507,6 +507,57 @@ ecma_builtin_typedarray_prototype_reverse (ecma_value_t this_arg, /**< this argu
   return ecma_copy_value (this_arg);
 } /* ecma_builtin_typedarray_prototype_reverse */
 
+/**
+ * Check whether the elements of a typedArray can be copied into another
+ * typedArray without conversion, i.e. the conversion keeps the raw bits.
+ *
+ * @return true - if the raw bytes can be copied, false - otherwise
+ */
+static bool
+ecma_builtin_typedarray_prototype_is_bitwise_copyable (ecma_typedarray_type_t target_id, /**< target type */
+                                                       ecma_typedarray_type_t src_id) /**< source type */
+{
+  if (target_id == src_id)
+  {
+    return true;
+  }
+
+  switch (target_id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_UINT8_ARRAY:
+    {
+      return (src_id == ECMA_INT8_ARRAY || src_id == ECMA_UINT8_ARRAY || src_id == ECMA_UINT8_CLAMPED_ARRAY);
+    }
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      /* Negative Int8 values are clamped to zero. */
+      return src_id == ECMA_UINT8_ARRAY;
+    }
+    case ECMA_INT16_ARRAY:
+    case ECMA_UINT16_ARRAY:
+    {
+      return (src_id == ECMA_INT16_ARRAY || src_id == ECMA_UINT16_ARRAY);
+    }
+    case ECMA_INT32_ARRAY:
+    case ECMA_UINT32_ARRAY:
+    {
+      return (src_id == ECMA_INT32_ARRAY || src_id == ECMA_UINT32_ARRAY);
+    }
+#if JERRY_BUILTIN_BIGINT
+    case ECMA_BIGINT64_ARRAY:
+    case ECMA_BIGUINT64_ARRAY:
+    {
+      return ECMA_TYPEDARRAY_IS_BIGINT_TYPE (src_id);
+    }
+#endif /* JERRY_BUILTIN_BIGINT */
+    default:
+    {
+      return false;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_is_bitwise_copyable */
+
 /**
  * The %TypedArray%.prototype object's 'set' routine for a typedArray source
  *
@@ -570,7 +621,7 @@ ecma_op_typedarray_set_with_typedarray (ecma_value_t this_arg, /**< this argumen
   /* 27. limit */
   uint32_t limit = target_byte_index + target_info.element_size * src_info.length;
 
-  if (src_info.id == target_info.id)
+  if (ecma_builtin_typedarray_prototype_is_bitwise_copyable (target_info.id, src_info.id))
   {
     memmove (target_info.buffer_p + target_byte_index, src_info.buffer_p,
              target_info.element_size * src_info.length);
@@ -580,21 +631,43 @@ ecma_op_typedarray_set_with_typedarray (ecma_value_t this_arg, /**< this argumen
     ecma_typedarray_getter_fn_t src_typedarray_getter_cb = ecma_get_typedarray_getter_fn (src_info.id);
     ecma_typedarray_setter_fn_t target_typedarray_setter_cb = ecma_get_typedarray_setter_fn (target_info.id);
 
+    uint32_t src_byte_length = src_info.element_size * src_info.length;
+    lit_utf8_byte_t *src_buffer_p = src_info.buffer_p;
+
+    /* 24. The elements are converted one by one, so an overlapping source must be cloned first. */
+    if (src_arraybuffer_p == arraybuffer_p
+        && src_info.buffer_p < target_info.buffer_p + limit
+        && target_info.buffer_p + target_byte_index < src_info.buffer_p + src_byte_length)
+    {
+      src_buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (src_byte_length);
+      memcpy (src_buffer_p, src_info.buffer_p, src_byte_length);
+    }
+
+    ecma_value_t ret_value = ECMA_VALUE_UNDEFINED;
     uint32_t src_byte_index = 0;
+
     while (target_byte_index < limit)
     {
-      ecma_value_t element = src_typedarray_getter_cb (src_info.buffer_p + src_byte_index);
+      ecma_value_t element = src_typedarray_getter_cb (src_buffer_p + src_byte_index);
       ecma_value_t set_element = target_typedarray_setter_cb (target_info.buffer_p + target_byte_index, element);
       ecma_free_value (element);
 
       if (ECMA_IS_VALUE_ERROR (set_element))
       {
-        return set_element;
+        ret_value = set_element;
+        break;
       }
 
       src_byte_index += src_info.element_size;
       target_byte_index += target_info.element_size;
     }
+
+    if (src_buffer_p != src_info.buffer_p)
+    {
+      jmem_heap_free_block (src_buffer_p, src_byte_length);
+    }
+
+    return ret_value;
   }
 
   return ECMA_VALUE_UNDEFINED;
@@ -1016,8 +1089,9 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this object
     return ecma_raise_type_error (ECMA_ERR_MSG (ecma_error_arraybuffer_is_detached));
   }
 
-  while (byte_index < limit)
+  if (byte_index < limit)
   {
+    /* Only the first element is converted, the rest is filled with its bytes. */
     ecma_value_t set_element = typedarray_setter_cb (info_p->buffer_p + byte_index, value_to_set);
 
     if (ECMA_IS_VALUE_ERROR (set_element))
@@ -1026,7 +1100,16 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this object
       return set_element;
     }
 
-    byte_index += info_p->element_size;
+    lit_utf8_byte_t *start_p = info_p->buffer_p + byte_index;
+    uint32_t fill_length = limit - byte_index;
+    uint32_t filled_length = info_p->element_size;
+
+    while (filled_length < fill_length)
+    {
+      uint32_t copy_length = JERRY_MIN (filled_length, fill_length - filled_length);
+      memcpy (start_p + filled_length, start_p, copy_length);
+      filled_length += copy_length;
+    }
   }
 
   ecma_free_value (value_to_set);
@@ -1049,51 +1132,7 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
                                                        ecma_value_t compare_func, /**< compare function */
                                                        ecma_object_t *array_buffer_p) /**< array buffer */
 {
-  if (ecma_is_value_undefined (compare_func))
-  {
-    /* Default comparison when no comparefn is passed. */
-#if JERRY_BUILTIN_BIGINT
-    if (ecma_is_value_bigint (lhs) && ecma_is_value_bigint (rhs))
-    {
-      return ecma_make_number_value (ecma_bigint_compare_to_bigint (lhs, rhs));
-    }
-#endif /* JERRY_BUILTIN_BIGINT */
-
-    ecma_number_t result = ECMA_NUMBER_ZERO;
-
-    double lhs_value = (double) ecma_get_number_from_value (lhs);
-    double rhs_value = (double) ecma_get_number_from_value (rhs);
-
-    if (ecma_number_is_nan (lhs_value))
-    {
-      // Keep NaNs at the end of the array.
-      result = ECMA_NUMBER_ONE;
-    }
-    else if (ecma_number_is_nan (rhs_value))
-    {
-      // Keep NaNs at the end of the array.
-      result = ECMA_NUMBER_MINUS_ONE;
-    }
-    else if (lhs_value < rhs_value)
-    {
-      result = ECMA_NUMBER_MINUS_ONE;
-    }
-    else if (lhs_value > rhs_value || (ecma_number_is_zero (rhs_value) && ecma_number_is_negative (rhs_value)))
-    {
-      result = ECMA_NUMBER_ONE;
-    }
-    else
-    {
-      result = ECMA_NUMBER_ZERO;
-    }
-
-    return ecma_make_number_value (result);
-  }
-
-  /*
-   * compare_func, if not undefined, will always contain a callable function object.
-   * We checked this previously, before this function was called.
-   */
+  /* Without comparefn, the elements are sorted by ecma_builtin_typedarray_prototype_sort_native. */
   JERRY_ASSERT (ecma_op_is_callable (compare_func));
   ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (compare_func);
 
@@ -1134,6 +1173,211 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
   return ecma_make_number_value (ret_num);
 } /* ecma_builtin_typedarray_prototype_sort_compare_helper */
 
+/**
+ * Ordering classes of the typedArray element types used by the native sort.
+ */
+typedef enum
+{
+  ECMA_TYPEDARRAY_SORT_UNSIGNED, /**< unsigned integer elements */
+  ECMA_TYPEDARRAY_SORT_SIGNED, /**< two's complement integer elements */
+  ECMA_TYPEDARRAY_SORT_FLOAT, /**< IEEE 754 floating point elements */
+} ecma_typedarray_sort_kind_t;
+
+/**
+ * Read the raw bits of a typedArray element.
+ *
+ * @return element bits
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_typedarray_prototype_sort_load (const lit_utf8_byte_t *src_p, /**< element */
+                                             uint8_t element_size) /**< element size */
+{
+  switch (element_size)
+  {
+    case 2:
+    {
+      uint16_t value;
+      memcpy (&value, src_p, sizeof (uint16_t));
+      return value;
+    }
+    case 4:
+    {
+      uint32_t value;
+      memcpy (&value, src_p, sizeof (uint32_t));
+      return value;
+    }
+    default:
+    {
+      JERRY_ASSERT (element_size == 8);
+
+      uint64_t value;
+      memcpy (&value, src_p, sizeof (uint64_t));
+      return value;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_sort_load */
+
+/**
+ * Convert the raw bits of a typedArray element to an unsigned key, whose
+ * ordering is the same as the default sort order of the typedArray:
+ * -0 is placed before +0, and NaN values are placed after everything else.
+ *
+ * @return sort key
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_typedarray_prototype_sort_key (uint64_t bits, /**< element bits */
+                                            uint8_t element_size, /**< element size */
+                                            ecma_typedarray_sort_kind_t kind) /**< ordering class */
+{
+  if (kind == ECMA_TYPEDARRAY_SORT_UNSIGNED)
+  {
+    return bits;
+  }
+
+  uint32_t bit_size = (uint32_t) element_size * JERRY_BITSINBYTE;
+  uint64_t sign_bit = ((uint64_t) 1) << (bit_size - 1);
+
+  if (kind == ECMA_TYPEDARRAY_SORT_SIGNED)
+  {
+    return bits ^ sign_bit;
+  }
+
+  uint64_t mask = (sign_bit - 1) | sign_bit;
+  uint64_t infinity = (element_size == 4) ? 0x7f800000u : 0x7ff0000000000000ull;
+
+  if ((bits & ~sign_bit) > infinity)
+  {
+    /* NaN values (including the negative ones) are greater than any other value. */
+    return mask;
+  }
+
+  return (bits & sign_bit) ? (~bits & mask) : (bits | sign_bit);
+} /* ecma_builtin_typedarray_prototype_sort_key */
+
+/**
+ * Sort the elements of a typedArray in place using the default ordering.
+ *
+ * Byte elements are sorted by counting, wider elements by an LSD radix sort
+ * which needs a temporary buffer with the same size as the elements. Unlike
+ * the generic sort, no ecma values are created for the elements.
+ */
+static void
+ecma_builtin_typedarray_prototype_sort_native (ecma_typedarray_info_t *info_p) /**< object info */
+{
+  ecma_typedarray_sort_kind_t kind = ECMA_TYPEDARRAY_SORT_UNSIGNED;
+
+  switch (info_p->id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_INT16_ARRAY:
+    case ECMA_INT32_ARRAY:
+#if JERRY_BUILTIN_BIGINT
+    case ECMA_BIGINT64_ARRAY:
+#endif /* JERRY_BUILTIN_BIGINT */
+    {
+      kind = ECMA_TYPEDARRAY_SORT_SIGNED;
+      break;
+    }
+    case ECMA_FLOAT32_ARRAY:
+#if JERRY_NUMBER_TYPE_FLOAT64
+    case ECMA_FLOAT64_ARRAY:
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+    {
+      kind = ECMA_TYPEDARRAY_SORT_FLOAT;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  uint32_t length = info_p->length;
+  uint8_t element_size = info_p->element_size;
+  lit_utf8_byte_t *buffer_p = info_p->buffer_p;
+  uint32_t counts[256];
+
+  if (element_size == 1)
+  {
+    uint8_t key_xor = (kind == ECMA_TYPEDARRAY_SORT_SIGNED) ? 0x80 : 0;
+
+    memset (counts, 0, sizeof (counts));
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      counts[buffer_p[i] ^ key_xor]++;
+    }
+
+    for (uint32_t key = 0; key < 256; key++)
+    {
+      memset (buffer_p, (int) (key ^ key_xor), counts[key]);
+      buffer_p += counts[key];
+    }
+    return;
+  }
+
+  uint32_t byte_length = length * element_size;
+  JMEM_DEFINE_LOCAL_ARRAY (temp_buffer_p, byte_length, lit_utf8_byte_t);
+
+  lit_utf8_byte_t *src_p = buffer_p;
+  lit_utf8_byte_t *dst_p = temp_buffer_p;
+
+  for (uint32_t shift = 0; shift < (uint32_t) element_size * JERRY_BITSINBYTE; shift += JERRY_BITSINBYTE)
+  {
+    memset (counts, 0, sizeof (counts));
+
+    for (uint32_t i = 0; i < byte_length; i += element_size)
+    {
+      uint64_t bits = ecma_builtin_typedarray_prototype_sort_load (src_p + i, element_size);
+      counts[(ecma_builtin_typedarray_prototype_sort_key (bits, element_size, kind) >> shift) & 0xff]++;
+    }
+
+    uint32_t offset = 0;
+    bool is_sorted = false;
+
+    for (uint32_t digit = 0; digit < 256; digit++)
+    {
+      uint32_t count = counts[digit];
+
+      if (count == length)
+      {
+        /* All elements have the same digit. */
+        is_sorted = true;
+        break;
+      }
+
+      counts[digit] = offset;
+      offset += count * element_size;
+    }
+
+    if (is_sorted)
+    {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < byte_length; i += element_size)
+    {
+      uint64_t bits = ecma_builtin_typedarray_prototype_sort_load (src_p + i, element_size);
+      uint64_t key = ecma_builtin_typedarray_prototype_sort_key (bits, element_size, kind);
+      uint32_t digit = (uint32_t) (key >> shift) & 0xff;
+
+      memcpy (dst_p + counts[digit], src_p + i, element_size);
+      counts[digit] += element_size;
+    }
+
+    lit_utf8_byte_t *swap_p = src_p;
+    src_p = dst_p;
+    dst_p = swap_p;
+  }
+
+  if (src_p != buffer_p)
+  {
+    memcpy (buffer_p, src_p, byte_length);
+  }
+
+  JMEM_FINALIZE_LOCAL_ARRAY (temp_buffer_p);
+} /* ecma_builtin_typedarray_prototype_sort_native */
+
 /**
  * The %TypedArray%.prototype object's 'sort' routine.
  *
@@ -1156,6 +1400,12 @@ ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argumen
     return ecma_copy_value (this_arg);
   }
 
+  if (ecma_is_value_undefined (compare_func))
+  {
+    ecma_builtin_typedarray_prototype_sort_native (info_p);
+    return ecma_copy_value (this_arg);
+  }
+
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info_p->length, ecma_value_t);
 
@@ -1297,6 +1547,159 @@ ecma_builtin_typedarray_prototype_find_helper (ecma_value_t this_arg, /**< this
   return is_find ? ECMA_VALUE_UNDEFINED : ecma_make_integer_value (-1);
 } /* ecma_builtin_typedarray_prototype_find_helper */
 
+/**
+ * Search a number in the elements of a non-BigInt typedArray without
+ * creating ecma values for the elements. Positive and negative zero
+ * are equal, NaN is only found when is_nan_equal is true.
+ *
+ * @return index of the first matching element at or after from_index
+ *         info_p->length - if no element matches
+ */
+static uint32_t
+ecma_builtin_typedarray_prototype_search_number (ecma_typedarray_info_t *info_p, /**< object info */
+                                                 ecma_number_t search_num, /**< number to search */
+                                                 uint32_t from_index, /**< start index */
+                                                 bool is_nan_equal) /**< NaN matches NaN */
+{
+  lit_utf8_byte_t *buffer_p = info_p->buffer_p;
+  uint32_t length = info_p->length;
+  bool is_nan = ecma_number_is_nan (search_num);
+  ecma_number_t min_value;
+  ecma_number_t max_value;
+
+  switch (info_p->id)
+  {
+    case ECMA_FLOAT32_ARRAY:
+    {
+      float search_float = (float) search_num;
+
+      if (is_nan ? !is_nan_equal : ((ecma_number_t) search_float != search_num))
+      {
+        return length;
+      }
+
+      for (uint32_t i = from_index; i < length; i++)
+      {
+        float element;
+        memcpy (&element, buffer_p + i * sizeof (float), sizeof (float));
+
+        if (is_nan ? (element != element) : (element == search_float))
+        {
+          return i;
+        }
+      }
+      return length;
+    }
+#if JERRY_NUMBER_TYPE_FLOAT64
+    case ECMA_FLOAT64_ARRAY:
+    {
+      if (is_nan && !is_nan_equal)
+      {
+        return length;
+      }
+
+      for (uint32_t i = from_index; i < length; i++)
+      {
+        double element;
+        memcpy (&element, buffer_p + i * sizeof (double), sizeof (double));
+
+        if (is_nan ? (element != element) : (element == search_num))
+        {
+          return i;
+        }
+      }
+      return length;
+    }
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+    case ECMA_INT8_ARRAY:
+    {
+      min_value = INT8_MIN;
+      max_value = INT8_MAX;
+      break;
+    }
+    case ECMA_UINT8_ARRAY:
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      min_value = 0;
+      max_value = UINT8_MAX;
+      break;
+    }
+    case ECMA_INT16_ARRAY:
+    {
+      min_value = INT16_MIN;
+      max_value = INT16_MAX;
+      break;
+    }
+    case ECMA_UINT16_ARRAY:
+    {
+      min_value = 0;
+      max_value = UINT16_MAX;
+      break;
+    }
+    case ECMA_INT32_ARRAY:
+    {
+      min_value = (ecma_number_t) INT32_MIN;
+      max_value = (ecma_number_t) INT32_MAX;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (info_p->id == ECMA_UINT32_ARRAY);
+      min_value = 0;
+      max_value = (ecma_number_t) UINT32_MAX;
+      break;
+    }
+  }
+
+  /* Integer elements can only be equal to integers in their range (this also excludes NaN). */
+  if (!(search_num >= min_value && search_num <= max_value)
+      || (ecma_number_t) (int64_t) search_num != search_num)
+  {
+    return length;
+  }
+
+  uint32_t search_bits = (uint32_t) (int64_t) search_num;
+
+  switch (info_p->element_size)
+  {
+    case 1:
+    {
+      const lit_utf8_byte_t *found_p = memchr (buffer_p + from_index, (int) (uint8_t) search_bits, length - from_index);
+      return (found_p != NULL) ? (uint32_t) (found_p - buffer_p) : length;
+    }
+    case 2:
+    {
+      for (uint32_t i = from_index; i < length; i++)
+      {
+        uint16_t element;
+        memcpy (&element, buffer_p + i * sizeof (uint16_t), sizeof (uint16_t));
+
+        if (element == (uint16_t) search_bits)
+        {
+          return i;
+        }
+      }
+      return length;
+    }
+    default:
+    {
+      JERRY_ASSERT (info_p->element_size == 4);
+
+      for (uint32_t i = from_index; i < length; i++)
+      {
+        uint32_t element;
+        memcpy (&element, buffer_p + i * sizeof (uint32_t), sizeof (uint32_t));
+
+        if (element == search_bits)
+        {
+          return i;
+        }
+      }
+      return length;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_search_number */
+
 /**
  * The %TypedArray%.prototype object's 'indexOf' routine
  *
@@ -1342,6 +1745,21 @@ ecma_builtin_typedarray_prototype_index_of (ecma_typedarray_info_t *info_p, /**<
 
   }
 
+  if (ecma_arraybuffer_is_detached (info_p->array_buffer_p))
+  {
+    return ecma_make_integer_value (-1);
+  }
+
+  if (!is_bigint)
+  {
+    uint32_t index = ecma_builtin_typedarray_prototype_search_number (info_p,
+                                                                      ecma_get_number_from_value (args[0]),
+                                                                      from_index,
+                                                                      false);
+
+    return (index < info_p->length) ? ecma_make_uint32_value (index) : ecma_make_integer_value (-1);
+  }
+
   ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
 
   /* 11. */
@@ -1716,6 +2134,16 @@ ecma_builtin_typedarray_prototype_includes (ecma_typedarray_info_t *info_p, /**<
     return ecma_raise_type_error (ECMA_ERR_MSG (ecma_error_arraybuffer_is_detached));
   }
 
+  if (!is_bigint)
+  {
+    uint32_t index = ecma_builtin_typedarray_prototype_search_number (info_p,
+                                                                      ecma_get_number_from_value (args[0]),
+                                                                      from_index,
+                                                                      true);
+
+    return ecma_make_boolean_value (index < info_p->length);
+  }
+
   while (search_pos < limit)
   {
     ecma_value_t element = getter_cb (info_p->buffer_p + search_pos);
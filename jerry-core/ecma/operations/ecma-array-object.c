@@ -912,11 +912,11 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
           JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
 
 #if JERRY_PROPERTY_HASHMAP
-          if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP)
+          if (hashmap_status != ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP
+              && (ecma_property_hashmap_delete (object_p, prop_pair_p->names_cp[i], current_prop_p->types + i)
+                  == ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP))
           {
-            hashmap_status = ecma_property_hashmap_delete (object_p,
-                                                           prop_pair_p->names_cp[i],
-                                                           current_prop_p->types + i);
+            hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP;
           }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
@@ -951,10 +951,9 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
   }
 
 #if JERRY_PROPERTY_HASHMAP
-  if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
+  if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_SHRINK_HASHMAP)
   {
-    ecma_property_hashmap_free (object_p);
-    ecma_property_hashmap_create (object_p);
+    ecma_property_hashmap_shrink (object_p);
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
@@ -132,15 +132,14 @@ ecma_big_uint_normalize_result (ecma_extended_primitive_t *value_p, /**< BigUInt
 
   ecma_bigint_digit_t *first_digit_p = ECMA_BIGINT_GET_DIGITS (value_p, 0);
 
-  /* The following code is tricky. The value stored in first_digit_p[-1] is the size
-   * of the BigUInt value, and it cannot be zero. Hence the loop below will terminate. */
-  JERRY_ASSERT (first_digit_p[-1] != 0);
-
+  /* The digit before first_digit_p is not always the non-zero size of the
+   * BigUInt value (it is the upper half of the value field when values are
+   * NaN-boxed), so the loop is bounded explicitly. */
   do
   {
     --last_digit_p;
   }
-  while (last_digit_p[-1] == 0);
+  while (last_digit_p > first_digit_p && last_digit_p[-1] == 0);
 
   JERRY_ASSERT (last_digit_p >= first_digit_p);
 
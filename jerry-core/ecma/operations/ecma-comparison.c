@@ -46,7 +46,13 @@ ecma_op_abstract_equality_compare (ecma_value_t x, /**< first operand */
 {
   if (x == y)
   {
+#if JERRY_NAN_BOXING
+    /* Boxed NaN values share the same canonical bit pattern. */
+    return ecma_make_boolean_value (!ecma_is_value_float_number (x)
+                                    || !ecma_number_is_nan (ecma_get_float_from_value (x)));
+#else /* !JERRY_NAN_BOXING */
     return ECMA_VALUE_TRUE;
+#endif /* JERRY_NAN_BOXING */
   }
 
   if (ecma_are_values_integer_numbers (x, y))
@@ -15,6 +15,7 @@
 #include "jcontext.h"
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-big-uint.h"
 #include "ecma-builtins.h"
 #include "ecma-builtin-helpers.h"
 #include "ecma-exceptions.h"
@@ -35,12 +36,40 @@
  * @{
  */
 
+/**
+ * Minimum number of entries before a hash index is built for the internal buffer.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_MINIMUM_ENTRIES 8
+
+/**
+ * Minimum number of slots of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_MINIMUM_SIZE 32
+
+/**
+ * Value of a deleted hash index slot.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_DELETED UINT32_MAX
+
+/**
+ * Get the slots of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_GET_SLOTS(index_p) \
+  ((uint32_t *) ((index_p) + 1))
+
+/**
+ * Compute the total size of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE(size) \
+  (sizeof (ecma_container_hash_index_t) + (size) * sizeof (uint32_t))
+
 /**
  * Create a new internal buffer.
  *
  * Note:
  *   The first element of the collection tracks the size of the buffer.
  *   ECMA_VALUE_EMPTY values are not calculated into the size.
+ *   The second element of the collection stores the hash index of the entries.
  *
  * @return pointer to the internal buffer
  */
@@ -48,11 +77,230 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (void)
 {
   ecma_collection_t *collection_p = ecma_new_collection ();
-  ecma_collection_push_back (collection_p, (ecma_value_t) 0);
+  ecma_value_t header[] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+
+  ECMA_CONTAINER_SET_HASH_INDEX (collection_p, NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Compute the hash of a key. Keys which are the same according
+ * to the SameValueZero algorithm have the same hash.
+ *
+ * @return hash code
+ */
+static uint32_t
+ecma_op_internal_buffer_hash (ecma_value_t key) /**< key */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_string (key))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (key));
+  }
+  else if (ecma_is_value_number (key))
+  {
+    ecma_number_t number = ecma_get_number_from_value (key);
+
+    /* Both zeros and all NaN values must have the same hash. Integer and
+     * float representations of the same number have the same binary form. */
+    if (ecma_number_is_nan (number))
+    {
+      hash = 1;
+    }
+    else if (ecma_number_is_zero (number))
+    {
+      hash = 0;
+    }
+    else
+    {
+      uint32_t bits[sizeof (ecma_number_t) / sizeof (uint32_t)];
+      memcpy (bits, &number, sizeof (ecma_number_t));
+
+      hash = 0;
+
+      for (uint32_t i = 0; i < sizeof (ecma_number_t) / sizeof (uint32_t); i++)
+      {
+        hash = (hash * 31) ^ bits[i];
+      }
+    }
+  }
+#if JERRY_BUILTIN_BIGINT
+  else if (ecma_is_value_bigint (key) && key != ECMA_BIGINT_ZERO)
+  {
+    ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (key);
+    hash = bigint_p->u.bigint_sign_and_size ^ *ECMA_BIGINT_GET_DIGITS (bigint_p, 0);
+  }
+#endif /* JERRY_BUILTIN_BIGINT */
+  else
+  {
+    /* Objects, symbols and simple values are compared by identity. */
+    hash = (uint32_t) key;
+  }
+
+  /* Mix the bits, since the low bits of the sources above are often similar. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6b;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35;
+  hash ^= hash >> 16;
+
+  return hash;
+} /* ecma_op_internal_buffer_hash */
+
+/**
+ * Release the hash index of the internal buffer.
+ */
+static void
+ecma_op_internal_buffer_free_index (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    jmem_heap_free_block (index_p, ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE (index_p->size));
+    ECMA_CONTAINER_SET_HASH_INDEX (container_p, NULL);
+  }
+} /* ecma_op_internal_buffer_free_index */
+
+/**
+ * Insert an entry offset into the hash index. The key must not be present in the index.
+ */
+static void
+ecma_op_internal_buffer_index_insert_offset (ecma_container_hash_index_t *index_p, /**< hash index */
+                                             ecma_value_t key, /**< key of the entry */
+                                             uint32_t offset) /**< offset of the entry */
+{
+  uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_GET_SLOTS (index_p);
+  uint32_t mask = index_p->size - 1;
+  uint32_t slot_index = ecma_op_internal_buffer_hash (key) & mask;
+
+  /* The index always has empty slots, so the loop terminates. */
+  while (slots_p[slot_index] != 0 && slots_p[slot_index] != ECMA_CONTAINER_HASH_INDEX_DELETED)
+  {
+    slot_index = (slot_index + 1) & mask;
+  }
+
+  if (slots_p[slot_index] == 0)
+  {
+    index_p->used_count++;
+  }
+
+  slots_p[slot_index] = offset + 1;
+} /* ecma_op_internal_buffer_index_insert_offset */
+
+/**
+ * Build a new hash index for all entries of the internal buffer.
+ *
+ * Note:
+ *   the index is an optional acceleration structure, when there is
+ *   not enough memory the buffer is searched without an index
+ */
+static void
+ecma_op_internal_buffer_rebuild_index (ecma_collection_t *container_p, /**< internal container pointer */
+                                       lit_magic_string_id_t lit_id) /**< class id */
+{
+  uint32_t live_count = ECMA_CONTAINER_GET_SIZE (container_p);
+  uint32_t size = ECMA_CONTAINER_HASH_INDEX_MINIMUM_SIZE;
+
+  /* At least half of the slots must be empty after rebuild. */
+  while (size < live_count * 2)
+  {
+    size <<= 1;
+  }
+
+  size_t total_size = ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE (size);
+
+  /* The allocation might trigger a garbage collection which removes weak entries through the old index. */
+  ecma_container_hash_index_t *new_index_p;
+  new_index_p = (ecma_container_hash_index_t *) jmem_heap_alloc_block_null_on_error (total_size);
+
+  ecma_op_internal_buffer_free_index (container_p);
+
+  if (new_index_p == NULL)
+  {
+    return;
+  }
+
+  memset (new_index_p, 0, total_size);
+  new_index_p->size = size;
+
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_internal_buffer_index_insert_offset (new_index_p, start_p[i], i);
+    }
+  }
+
+  ECMA_CONTAINER_SET_HASH_INDEX (container_p, new_index_p);
+} /* ecma_op_internal_buffer_rebuild_index */
+
+/**
+ * Register the last appended entry of the internal buffer in the hash index.
+ */
+static void
+ecma_op_internal_buffer_index_append (ecma_collection_t *container_p, /**< internal container pointer */
+                                      lit_magic_string_id_t lit_id) /**< class id */
+{
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+
+  if (index_p == NULL)
+  {
+    if (entry_count >= ECMA_CONTAINER_HASH_INDEX_MINIMUM_ENTRIES * entry_size)
+    {
+      ecma_op_internal_buffer_rebuild_index (container_p, lit_id);
+    }
+    return;
+  }
+
+  /* Keep the load factor (including deleted slots) below 3/4. */
+  if ((index_p->used_count + 1) * 4 > index_p->size * 3)
+  {
+    ecma_op_internal_buffer_rebuild_index (container_p, lit_id);
+    return;
+  }
+
+  uint32_t offset = entry_count - entry_size;
+  ecma_op_internal_buffer_index_insert_offset (index_p, ECMA_CONTAINER_START (container_p)[offset], offset);
+} /* ecma_op_internal_buffer_index_append */
+
+/**
+ * Remove an entry from the hash index.
+ */
+static void
+ecma_op_internal_buffer_index_remove (ecma_collection_t *container_p, /**< internal container pointer */
+                                      ecma_value_t *entry_p) /**< entry pointer */
+{
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_GET_SLOTS (index_p);
+  uint32_t mask = index_p->size - 1;
+  uint32_t slot_index = ecma_op_internal_buffer_hash (*entry_p) & mask;
+  uint32_t slot_value = (uint32_t) (entry_p - ECMA_CONTAINER_START (container_p)) + 1;
+
+  while (slots_p[slot_index] != slot_value)
+  {
+    JERRY_ASSERT (slots_p[slot_index] != 0);
+    slot_index = (slot_index + 1) & mask;
+  }
+
+  slots_p[slot_index] = ECMA_CONTAINER_HASH_INDEX_DELETED;
+} /* ecma_op_internal_buffer_index_remove */
+
 /**
  * Append values to the internal buffer.
  */
@@ -64,6 +312,14 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
 {
   JERRY_ASSERT (container_p != NULL);
 
+  /* Entries are never removed from the buffer, so it is grown
+   * geometrically to avoid reallocating it on every append. */
+  if (container_p->capacity - container_p->item_count < ECMA_CONTAINER_PAIR_SIZE)
+  {
+    uint32_t grow_size = (container_p->capacity >> 3) * ECMA_CONTAINER_PAIR_SIZE;
+    ecma_collection_reserve (container_p, JERRY_MAX (grow_size, ECMA_COLLECTION_GROW_FACTOR));
+  }
+
   if (lit_id == LIT_MAGIC_STRING_WEAKMAP_UL || lit_id == LIT_MAGIC_STRING_MAP_UL)
   {
     ecma_value_t values[] = { ecma_copy_value_if_not_object (key_arg), ecma_copy_value_if_not_object (value_arg) };
@@ -75,6 +331,7 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+  ecma_op_internal_buffer_index_append (container_p, lit_id);
 } /* ecma_op_internal_buffer_append */
 
 /**
@@ -106,6 +363,8 @@ ecma_op_internal_buffer_delete (ecma_collection_t *container_p, /**< internal co
   JERRY_ASSERT (container_p != NULL);
   JERRY_ASSERT (entry_p != NULL);
 
+  ecma_op_internal_buffer_index_remove (container_p, &entry_p->key);
+
   ecma_free_value_if_not_object (entry_p->key);
   entry_p->key = ECMA_VALUE_EMPTY;
 
@@ -130,9 +389,35 @@ ecma_op_internal_buffer_find (ecma_collection_t *container_p, /**< internal cont
 {
   JERRY_ASSERT (container_p != NULL);
 
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_GET_SLOTS (index_p);
+    uint32_t mask = index_p->size - 1;
+    uint32_t slot_index = ecma_op_internal_buffer_hash (key_arg) & mask;
+
+    while (slots_p[slot_index] != 0)
+    {
+      if (slots_p[slot_index] != ECMA_CONTAINER_HASH_INDEX_DELETED)
+      {
+        ecma_value_t *entry_p = start_p + (slots_p[slot_index] - 1);
+
+        if (ecma_op_same_value_zero (*entry_p, key_arg, false))
+        {
+          return entry_p;
+        }
+      }
+
+      slot_index = (slot_index + 1) & mask;
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -339,6 +624,7 @@ ecma_op_container_free_entries (ecma_object_t *object_p) /**< collection object
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
+  ecma_op_internal_buffer_free_index (container_p);
 } /* ecma_op_container_free_entries */
 
 /**
@@ -28,6 +28,7 @@
 #include "ecma-proxy-object.h"
 #include "ecma-symbol-object.h"
 #include "jcontext.h"
+#include "js-parser.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -1022,6 +1023,35 @@ ecma_op_get_prototype_from_constructor (ecma_object_t *ctor_obj_p, /**< construc
   return proto_obj_p;
 } /* ecma_op_get_prototype_from_constructor */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Replace the lazy compiled code of a function object with its compiled body.
+ *
+ * @return compiled code of the function body - if success
+ *         NULL - otherwise (an exception is raised)
+ */
+static const ecma_compiled_code_t * JERRY_ATTR_NOINLINE
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p, /**< function object */
+                               const ecma_compiled_code_t *bytecode_data_p) /**< lazy compiled code */
+{
+  ecma_compiled_code_t *lazy_bytecode_p = (ecma_compiled_code_t *) bytecode_data_p;
+  ecma_compiled_code_t *compiled_code_p = parser_compile_lazy_function (lazy_bytecode_p);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    return NULL;
+  }
+
+  ecma_bytecode_ref (compiled_code_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, compiled_code_p);
+  ecma_bytecode_deref (lazy_bytecode_p);
+
+  return compiled_code_p;
+} /* ecma_op_function_compile_lazy */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Perform a JavaScript function object method call.
  *
@@ -1054,6 +1084,19 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   ecma_value_t this_binding = this_arg_value;
 
   const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
+
+#if JERRY_LAZY_FUNCTIONS
+  if (JERRY_UNLIKELY (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    bytecode_data_p = ecma_op_function_compile_lazy (ext_func_p, bytecode_data_p);
+
+    if (JERRY_UNLIKELY (bytecode_data_p == NULL))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   uint16_t status_flags = bytecode_data_p->status_flags;
 
   shared_args.header.bytecode_header_p = bytecode_data_p;
@@ -21,16 +21,12 @@
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
 #include "jcontext.h"
+#include "jerryscript-port.h"
 #include "opcodes.h"
 #include "vm-stack.h"
 
 #if JERRY_BUILTIN_PROMISE
 
-/**
- * Mask for job queue type.
- */
-#define ECMA_JOB_QUEURE_TYPE_MASK ((uintptr_t) 0x07)
-
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -79,13 +75,34 @@ typedef struct
   ecma_value_t then; /**< 'then' function */
 } ecma_job_promise_resolve_thenable_t;
 
+JERRY_STATIC_ASSERT (sizeof (ecma_job_promise_reaction_t) <= sizeof (ecma_job_queue_slot_t)
+                     && sizeof (ecma_job_promise_async_reaction_t) <= sizeof (ecma_job_queue_slot_t)
+                     && sizeof (ecma_job_promise_async_generator_t) <= sizeof (ecma_job_queue_slot_t)
+                     && sizeof (ecma_job_promise_resolve_thenable_t) <= sizeof (ecma_job_queue_slot_t),
+                     every_job_must_fit_into_a_job_queue_slot);
+
+/**
+ * Job removed from the job queue.
+ */
+typedef union
+{
+  ecma_job_queue_slot_t slot; /**< raw content of the job queue slot */
+  ecma_job_queue_item_t header; /**< job queue item header */
+  ecma_job_promise_reaction_t reaction; /**< PromiseReactionJob */
+  ecma_job_promise_async_reaction_t async_reaction; /**< PromiseAsyncReactionJob */
+  ecma_job_promise_async_generator_t async_generator; /**< PromiseAsyncGeneratorJob */
+  ecma_job_promise_resolve_thenable_t resolve_thenable; /**< PromiseResolveThenableJob */
+} ecma_job_t;
+
 /**
  * Initialize the jobqueue.
  */
 void ecma_job_queue_init (void)
 {
-  JERRY_CONTEXT (job_queue_head_p) = NULL;
-  JERRY_CONTEXT (job_queue_tail_p) = NULL;
+  JERRY_CONTEXT (job_queue_buffer_p) = NULL;
+  JERRY_CONTEXT (job_queue_capacity) = 0;
+  JERRY_CONTEXT (job_queue_start) = 0;
+  JERRY_CONTEXT (job_queue_count) = 0;
 } /* ecma_job_queue_init */
 
 /**
@@ -96,22 +113,11 @@ void ecma_job_queue_init (void)
 static inline ecma_job_queue_item_type_t JERRY_ATTR_ALWAYS_INLINE
 ecma_job_queue_get_type (ecma_job_queue_item_t *job_p) /**< the job */
 {
-  return (ecma_job_queue_item_type_t) (job_p->next_and_type & ECMA_JOB_QUEURE_TYPE_MASK);
+  return (ecma_job_queue_item_type_t) job_p->type;
 } /* ecma_job_queue_get_type */
 
 /**
- * Get the next job of the job queue.
- *
- * @return next job
- */
-static inline ecma_job_queue_item_t *JERRY_ATTR_ALWAYS_INLINE
-ecma_job_queue_get_next (ecma_job_queue_item_t *job_p) /**< the job */
-{
-  return (ecma_job_queue_item_t *) (job_p->next_and_type & ~ECMA_JOB_QUEURE_TYPE_MASK);
-} /* ecma_job_queue_get_next */
-
-/**
- * Free the heap and the member of the PromiseReactionJob.
+ * Free the members of the PromiseReactionJob.
  */
 static void
 ecma_free_promise_reaction_job (ecma_job_promise_reaction_t *job_p) /**< points to the PromiseReactionJob */
@@ -121,12 +127,10 @@ ecma_free_promise_reaction_job (ecma_job_promise_reaction_t *job_p) /**< points
   ecma_free_value (job_p->capability);
   ecma_free_value (job_p->handler);
   ecma_free_value (job_p->argument);
-
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_reaction_t));
 } /* ecma_free_promise_reaction_job */
 
 /**
- * Free the heap and the member of the PromiseAsyncReactionJob.
+ * Free the members of the PromiseAsyncReactionJob.
  */
 static void
 ecma_free_promise_async_reaction_job (ecma_job_promise_async_reaction_t *job_p) /**< points to the
@@ -136,12 +140,10 @@ ecma_free_promise_async_reaction_job (ecma_job_promise_async_reaction_t *job_p)
 
   ecma_free_value (job_p->executable_object);
   ecma_free_value (job_p->argument);
-
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_reaction_t));
 } /* ecma_free_promise_async_reaction_job */
 
 /**
- * Free the heap and the member of the PromiseAsyncGeneratorJob.
+ * Free the members of the PromiseAsyncGeneratorJob.
  */
 static void
 ecma_free_promise_async_generator_job (ecma_job_promise_async_generator_t *job_p) /**< points to the
@@ -150,12 +152,10 @@ ecma_free_promise_async_generator_job (ecma_job_promise_async_generator_t *job_p
   JERRY_ASSERT (job_p != NULL);
 
   ecma_free_value (job_p->executable_object);
-
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_generator_t));
 } /* ecma_free_promise_async_generator_job */
 
 /**
- * Free the heap and the member of the PromiseResolveThenableJob.
+ * Free the members of the PromiseResolveThenableJob.
  */
 static void
 ecma_free_promise_resolve_thenable_job (ecma_job_promise_resolve_thenable_t *job_p) /**< points to the
@@ -166,8 +166,6 @@ ecma_free_promise_resolve_thenable_job (ecma_job_promise_resolve_thenable_t *job
   ecma_free_value (job_p->promise);
   ecma_free_value (job_p->thenable);
   ecma_free_value (job_p->then);
-
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_resolve_thenable_t));
 } /* ecma_free_promise_resolve_thenable_job */
 
 /**
@@ -410,7 +408,6 @@ ecma_process_promise_async_generator_job (ecma_job_promise_async_generator_t *jo
   ecma_value_t result = ecma_async_generator_run ((vm_executable_object_t *) object_p);
 
   ecma_free_value (job_p->executable_object);
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_generator_t));
   return result;
 } /* ecma_process_promise_async_generator_job */
 
@@ -445,27 +442,80 @@ ecma_process_promise_resolve_thenable_job (ecma_job_promise_resolve_thenable_t *
 } /* ecma_process_promise_resolve_thenable_job */
 
 /**
- * Enqueue a Promise job into the jobqueue.
+ * Double the number of slots of the job queue ring buffer.
+ *
+ * Note:
+ *   the enqueued jobs are moved to the start of the new buffer
  */
 static void
-ecma_enqueue_job (ecma_job_queue_item_t *job_p) /**< the job */
+ecma_job_queue_grow (void)
 {
-  JERRY_ASSERT (job_p->next_and_type <= ECMA_JOB_QUEURE_TYPE_MASK);
+  uint32_t capacity = JERRY_CONTEXT (job_queue_capacity);
+  uint32_t new_capacity = (capacity == 0) ? ECMA_JOB_QUEUE_INITIAL_CAPACITY : (capacity << 1);
+
+  ecma_job_queue_slot_t *buffer_p;
+  buffer_p = (ecma_job_queue_slot_t *) jmem_heap_alloc_block (new_capacity * sizeof (ecma_job_queue_slot_t));
 
-  if (JERRY_CONTEXT (job_queue_head_p) == NULL)
+  ecma_job_queue_slot_t *old_buffer_p = JERRY_CONTEXT (job_queue_buffer_p);
+
+  if (old_buffer_p != NULL)
   {
-    JERRY_CONTEXT (job_queue_head_p) = job_p;
-    JERRY_CONTEXT (job_queue_tail_p) = job_p;
+    /* The queue is full, so it occupies every slot starting from the first job. */
+    JERRY_ASSERT (JERRY_CONTEXT (job_queue_count) == capacity);
+
+    uint32_t start = JERRY_CONTEXT (job_queue_start);
+    uint32_t head_count = capacity - start;
+
+    memcpy (buffer_p, old_buffer_p + start, head_count * sizeof (ecma_job_queue_slot_t));
+    memcpy (buffer_p + head_count, old_buffer_p, start * sizeof (ecma_job_queue_slot_t));
+
+    jmem_heap_free_block (old_buffer_p, capacity * sizeof (ecma_job_queue_slot_t));
   }
-  else
-  {
-    JERRY_ASSERT ((JERRY_CONTEXT (job_queue_tail_p)->next_and_type & ~ECMA_JOB_QUEURE_TYPE_MASK) == 0);
 
-    JERRY_CONTEXT (job_queue_tail_p)->next_and_type |= (uintptr_t) job_p;
-    JERRY_CONTEXT (job_queue_tail_p) = job_p;
+  JERRY_CONTEXT (job_queue_buffer_p) = buffer_p;
+  JERRY_CONTEXT (job_queue_capacity) = new_capacity;
+  JERRY_CONTEXT (job_queue_start) = 0;
+} /* ecma_job_queue_grow */
+
+/**
+ * Enqueue a Promise job into the jobqueue.
+ */
+static void
+ecma_enqueue_job (ecma_job_queue_item_t *job_p, /**< the job */
+                  size_t job_size) /**< size of the job */
+{
+  JERRY_ASSERT (job_size <= sizeof (ecma_job_queue_slot_t));
+
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (job_queue_count) == JERRY_CONTEXT (job_queue_capacity)))
+  {
+    ecma_job_queue_grow ();
   }
+
+  uint32_t index = ((JERRY_CONTEXT (job_queue_start) + JERRY_CONTEXT (job_queue_count))
+                    & (JERRY_CONTEXT (job_queue_capacity) - 1));
+
+  memcpy (JERRY_CONTEXT (job_queue_buffer_p) + index, job_p, job_size);
+  JERRY_CONTEXT (job_queue_count)++;
 } /* ecma_enqueue_job */
 
+/**
+ * Remove the first job from the job queue.
+ *
+ * Note:
+ *   the job is copied, because the ring buffer may be reallocated while the job is processed
+ */
+static void
+ecma_dequeue_job (ecma_job_t *job_p) /**< [out] the job */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (job_queue_count) > 0);
+
+  uint32_t start = JERRY_CONTEXT (job_queue_start);
+
+  memcpy (&job_p->slot, JERRY_CONTEXT (job_queue_buffer_p) + start, sizeof (ecma_job_queue_slot_t));
+  JERRY_CONTEXT (job_queue_start) = (start + 1) & (JERRY_CONTEXT (job_queue_capacity) - 1);
+  JERRY_CONTEXT (job_queue_count)--;
+} /* ecma_dequeue_job */
+
 /**
  * Enqueue a PromiseReactionJob into the job queue.
  */
@@ -474,14 +524,13 @@ ecma_enqueue_promise_reaction_job (ecma_value_t capability, /**< capability obje
                                    ecma_value_t handler, /**< handler function */
                                    ecma_value_t argument) /**< argument for the reaction */
 {
-  ecma_job_promise_reaction_t *job_p;
-  job_p = (ecma_job_promise_reaction_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_reaction_t));
-  job_p->header.next_and_type = ECMA_JOB_PROMISE_REACTION;
-  job_p->capability = ecma_copy_value (capability);
-  job_p->handler = ecma_copy_value (handler);
-  job_p->argument = ecma_copy_value (argument);
-
-  ecma_enqueue_job (&job_p->header);
+  ecma_job_promise_reaction_t job;
+  job.header.type = ECMA_JOB_PROMISE_REACTION;
+  job.capability = ecma_copy_value (capability);
+  job.handler = ecma_copy_value (handler);
+  job.argument = ecma_copy_value (argument);
+
+  ecma_enqueue_job (&job.header, sizeof (job));
 } /* ecma_enqueue_promise_reaction_job */
 
 /**
@@ -492,14 +541,13 @@ ecma_enqueue_promise_async_reaction_job (ecma_value_t executable_object, /**< ex
                                          ecma_value_t argument, /**< argument */
                                          bool is_rejected) /**< is_fulfilled */
 {
-  ecma_job_promise_async_reaction_t *job_p;
-  job_p = (ecma_job_promise_async_reaction_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_async_reaction_t));
-  job_p->header.next_and_type = (is_rejected ? ECMA_JOB_PROMISE_ASYNC_REACTION_REJECTED
-                                             : ECMA_JOB_PROMISE_ASYNC_REACTION_FULFILLED);
-  job_p->executable_object = ecma_copy_value (executable_object);
-  job_p->argument = ecma_copy_value (argument);
-
-  ecma_enqueue_job (&job_p->header);
+  ecma_job_promise_async_reaction_t job;
+  job.header.type = (is_rejected ? ECMA_JOB_PROMISE_ASYNC_REACTION_REJECTED
+                                 : ECMA_JOB_PROMISE_ASYNC_REACTION_FULFILLED);
+  job.executable_object = ecma_copy_value (executable_object);
+  job.argument = ecma_copy_value (argument);
+
+  ecma_enqueue_job (&job.header, sizeof (job));
 } /* ecma_enqueue_promise_async_reaction_job */
 
 /**
@@ -508,12 +556,11 @@ ecma_enqueue_promise_async_reaction_job (ecma_value_t executable_object, /**< ex
 void
 ecma_enqueue_promise_async_generator_job (ecma_value_t executable_object) /**< executable object */
 {
-  ecma_job_promise_async_generator_t *job_p;
-  job_p = (ecma_job_promise_async_generator_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_async_generator_t));
-  job_p->header.next_and_type = ECMA_JOB_PROMISE_ASYNC_GENERATOR;
-  job_p->executable_object = ecma_copy_value (executable_object);
+  ecma_job_promise_async_generator_t job;
+  job.header.type = ECMA_JOB_PROMISE_ASYNC_GENERATOR;
+  job.executable_object = ecma_copy_value (executable_object);
 
-  ecma_enqueue_job (&job_p->header);
+  ecma_enqueue_job (&job.header, sizeof (job));
 } /* ecma_enqueue_promise_async_generator_job */
 
 /**
@@ -528,58 +575,67 @@ ecma_enqueue_promise_resolve_thenable_job (ecma_value_t promise, /**< promise to
   JERRY_ASSERT (ecma_is_value_object (thenable));
   JERRY_ASSERT (ecma_op_is_callable (then));
 
-  ecma_job_promise_resolve_thenable_t *job_p;
-  job_p = (ecma_job_promise_resolve_thenable_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_resolve_thenable_t));
-  job_p->header.next_and_type = ECMA_JOB_PROMISE_THENABLE;
-  job_p->promise = ecma_copy_value (promise);
-  job_p->thenable = ecma_copy_value (thenable);
-  job_p->then = ecma_copy_value (then);
+  ecma_job_promise_resolve_thenable_t job;
+  job.header.type = ECMA_JOB_PROMISE_THENABLE;
+  job.promise = ecma_copy_value (promise);
+  job.thenable = ecma_copy_value (thenable);
+  job.then = ecma_copy_value (then);
 
-  ecma_enqueue_job (&job_p->header);
+  ecma_enqueue_job (&job.header, sizeof (job));
 } /* ecma_enqueue_promise_resolve_thenable_job */
 
 /**
- * Process enqueued Promise jobs until the first thrown error or until the
- * jobqueue becomes empty.
+ * Process enqueued Promise jobs until the first thrown error, until the
+ * jobqueue becomes empty, or until the budget of the call is exhausted.
  *
- * @return result of the last processed job - if the jobqueue was non-empty,
+ * Note:
+ *   at least one job is processed if the jobqueue is non-empty
+ *
+ * @return error of the last processed job - if a job has thrown an error,
  *         undefined - otherwise.
  */
 ecma_value_t
-ecma_process_all_enqueued_jobs (void)
+ecma_process_enqueued_jobs (uint32_t max_jobs, /**< maximum number of processed jobs (0 - unlimited) */
+                            uint32_t max_time) /**< time limit of processing in milliseconds (0 - unlimited) */
 {
   ecma_value_t ret = ECMA_VALUE_UNDEFINED;
+  double end_time = 0;
+
+  if (max_time != 0)
+  {
+    end_time = jerry_port_get_current_time () + (double) max_time;
+  }
 
-  while (JERRY_CONTEXT (job_queue_head_p) != NULL)
+  while (JERRY_CONTEXT (job_queue_count) > 0)
   {
-    ecma_job_queue_item_t *job_p = JERRY_CONTEXT (job_queue_head_p);
-    JERRY_CONTEXT (job_queue_head_p) = ecma_job_queue_get_next (job_p);
+    ecma_job_t job;
+    ecma_dequeue_job (&job);
 
     ecma_fast_free_value (ret);
 
-    switch (ecma_job_queue_get_type (job_p))
+    switch (ecma_job_queue_get_type (&job.header))
     {
       case ECMA_JOB_PROMISE_REACTION:
       {
-        ret = ecma_process_promise_reaction_job ((ecma_job_promise_reaction_t *) job_p);
+        ret = ecma_process_promise_reaction_job (&job.reaction);
         break;
       }
       case ECMA_JOB_PROMISE_ASYNC_REACTION_FULFILLED:
       case ECMA_JOB_PROMISE_ASYNC_REACTION_REJECTED:
       {
-        ret = ecma_process_promise_async_reaction_job ((ecma_job_promise_async_reaction_t *) job_p);
+        ret = ecma_process_promise_async_reaction_job (&job.async_reaction);
         break;
       }
       case ECMA_JOB_PROMISE_ASYNC_GENERATOR:
       {
-        ret = ecma_process_promise_async_generator_job ((ecma_job_promise_async_generator_t *) job_p);
+        ret = ecma_process_promise_async_generator_job (&job.async_generator);
         break;
       }
       default:
       {
-        JERRY_ASSERT (ecma_job_queue_get_type (job_p) == ECMA_JOB_PROMISE_THENABLE);
+        JERRY_ASSERT (ecma_job_queue_get_type (&job.header) == ECMA_JOB_PROMISE_THENABLE);
 
-        ret = ecma_process_promise_resolve_thenable_job ((ecma_job_promise_resolve_thenable_t *) job_p);
+        ret = ecma_process_promise_resolve_thenable_job (&job.resolve_thenable);
         break;
       }
     }
@@ -588,11 +644,21 @@ ecma_process_all_enqueued_jobs (void)
     {
       return ret;
     }
+
+    if (max_jobs != 0 && --max_jobs == 0)
+    {
+      break;
+    }
+
+    if (max_time != 0 && jerry_port_get_current_time () >= end_time)
+    {
+      break;
+    }
   }
 
   ecma_free_value (ret);
   return ECMA_VALUE_UNDEFINED;
-} /* ecma_process_all_enqueued_jobs */
+} /* ecma_process_enqueued_jobs */
 
 /**
  * Release enqueued Promise jobs.
@@ -600,40 +666,56 @@ ecma_process_all_enqueued_jobs (void)
 void
 ecma_free_all_enqueued_jobs (void)
 {
-  while (JERRY_CONTEXT (job_queue_head_p) != NULL)
+  while (JERRY_CONTEXT (job_queue_count) > 0)
   {
-    ecma_job_queue_item_t *job_p = JERRY_CONTEXT (job_queue_head_p);
-    JERRY_CONTEXT (job_queue_head_p) = ecma_job_queue_get_next (job_p);
+    ecma_job_t job;
+    ecma_dequeue_job (&job);
 
-    switch (ecma_job_queue_get_type (job_p))
+    switch (ecma_job_queue_get_type (&job.header))
     {
       case ECMA_JOB_PROMISE_REACTION:
       {
-        ecma_free_promise_reaction_job ((ecma_job_promise_reaction_t *) job_p);
+        ecma_free_promise_reaction_job (&job.reaction);
         break;
       }
       case ECMA_JOB_PROMISE_ASYNC_REACTION_FULFILLED:
       case ECMA_JOB_PROMISE_ASYNC_REACTION_REJECTED:
       {
-        ecma_free_promise_async_reaction_job ((ecma_job_promise_async_reaction_t *) job_p);
+        ecma_free_promise_async_reaction_job (&job.async_reaction);
         break;
       }
       case ECMA_JOB_PROMISE_ASYNC_GENERATOR:
       {
-        ecma_free_promise_async_generator_job ((ecma_job_promise_async_generator_t *) job_p);
+        ecma_free_promise_async_generator_job (&job.async_generator);
         break;
       }
       default:
       {
-        JERRY_ASSERT (ecma_job_queue_get_type (job_p) == ECMA_JOB_PROMISE_THENABLE);
+        JERRY_ASSERT (ecma_job_queue_get_type (&job.header) == ECMA_JOB_PROMISE_THENABLE);
 
-        ecma_free_promise_resolve_thenable_job ((ecma_job_promise_resolve_thenable_t *) job_p);
+        ecma_free_promise_resolve_thenable_job (&job.resolve_thenable);
         break;
       }
     }
   }
+
+  ecma_job_queue_free_unused_memory ();
 } /* ecma_free_all_enqueued_jobs */
 
+/**
+ * Free the ring buffer of the job queue if no jobs are enqueued.
+ */
+void
+ecma_job_queue_free_unused_memory (void)
+{
+  if (JERRY_CONTEXT (job_queue_count) == 0 && JERRY_CONTEXT (job_queue_buffer_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (job_queue_buffer_p),
+                          JERRY_CONTEXT (job_queue_capacity) * sizeof (ecma_job_queue_slot_t));
+    ecma_job_queue_init ();
+  }
+} /* ecma_job_queue_free_unused_memory */
+
 /**
  * @}
  * @}
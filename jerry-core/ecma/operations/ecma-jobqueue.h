@@ -42,9 +42,28 @@ typedef enum
  */
 typedef struct
 {
-  uintptr_t next_and_type; /**< next and type members of a queue item */
+  uint32_t type; /**< type of the job (ecma_job_queue_item_type_t) */
 } ecma_job_queue_item_t;
 
+/**
+ * Maximum number of values stored by a job.
+ */
+#define ECMA_JOB_QUEUE_SLOT_VALUE_COUNT 3
+
+/**
+ * Slot of the job queue ring buffer, which can hold any type of job.
+ */
+typedef struct
+{
+  ecma_job_queue_item_t header; /**< job queue item header */
+  ecma_value_t values[ECMA_JOB_QUEUE_SLOT_VALUE_COUNT]; /**< members of the job */
+} ecma_job_queue_slot_t;
+
+/**
+ * Number of slots allocated for the job queue when the first job is enqueued.
+ */
+#define ECMA_JOB_QUEUE_INITIAL_CAPACITY 16
+
 void ecma_job_queue_init (void);
 
 void ecma_enqueue_promise_reaction_job (ecma_value_t capability, ecma_value_t handler, ecma_value_t argument);
@@ -53,8 +72,9 @@ void ecma_enqueue_promise_async_reaction_job (ecma_value_t executable_object,
 void ecma_enqueue_promise_async_generator_job (ecma_value_t executable_object);
 void ecma_enqueue_promise_resolve_thenable_job (ecma_value_t promise, ecma_value_t thenable, ecma_value_t then);
 void ecma_free_all_enqueued_jobs (void);
+void ecma_job_queue_free_unused_memory (void);
 
-ecma_value_t ecma_process_all_enqueued_jobs (void);
+ecma_value_t ecma_process_enqueued_jobs (uint32_t max_jobs, uint32_t max_time);
 
 /**
  * @}
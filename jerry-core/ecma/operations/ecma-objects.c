@@ -27,6 +27,7 @@
 #include "ecma-arguments-object.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-property-shape.h"
 #include "ecma-proxy-object.h"
 #include "ecma-bigint.h"
 #include "jcontext.h"
@@ -2542,28 +2543,37 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p) /**< object */
   }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_PROPERTY_SHAPES
+  uint16_t shape_id = ecma_property_shape_get_id (obj_p);
+  uint32_t position = 0;
+#endif /* JERRY_PROPERTY_SHAPES */
+
   while (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
-    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
     {
       ecma_property_t *property_p = prop_iter_p->types + i;
 
       if (ECMA_PROPERTY_IS_RAW (*property_p))
       {
-        ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+#if JERRY_PROPERTY_SHAPES
+        jmem_cpointer_t name_cp = ((shape_id != 0) ? ecma_property_shape_get_name (shape_id, position, i)
+                                                   : ((ecma_property_pair_t *) prop_iter_p)->names_cp[i]);
+#else /* !JERRY_PROPERTY_SHAPES */
+        jmem_cpointer_t name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[i];
+#endif /* JERRY_PROPERTY_SHAPES */
 
         if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-            && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-            && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
+            && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+            && name_cp < LIT_MAGIC_STRING__COUNT)
         {
           continue;
         }
 
-        ecma_string_t *name_p = ecma_string_from_property_name (*property_p,
-                                                                prop_pair_p->names_cp[i]);
+        ecma_string_t *name_p = ecma_string_from_property_name (*property_p, name_cp);
 
         if (!ecma_object_prop_name_is_duplicated (prop_names_p, name_p))
         {
@@ -2592,6 +2602,9 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p) /**< object */
     }
 
     prop_iter_cp = prop_iter_p->next_property_cp;
+#if JERRY_PROPERTY_SHAPES
+    position++;
+#endif /* JERRY_PROPERTY_SHAPES */
   }
 
   if (prop_names_p->item_count != 0)
@@ -3442,6 +3455,10 @@ ecma_op_object_set_weak (ecma_object_t *object_p, /**< key object */
 
   if (property_p == NULL)
   {
+#if (JERRY_GC_STEP_LIMIT != 0)
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_HAS_WEAK_REFS;
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
     refs_p = ecma_new_collection ();
 
     ecma_property_value_t *value_p;
@@ -1248,6 +1248,32 @@ ecma_promise_finally (ecma_value_t promise, /**< the promise which call 'finally
   return ret_value;
 } /* ecma_promise_finally */
 
+/**
+ * Checks whether an async function awaiting the value can be resumed without creating a promise.
+ *
+ * Note:
+ *   awaiting a non-object value creates a promise which is fulfilled with the value
+ *   and only used for scheduling the resumption. This promise is not observable
+ *   unless promise events are reported, so it can be omitted.
+ *
+ * @return true - if the async function can be resumed directly with the value,
+ *         false - otherwise
+ */
+bool
+ecma_promise_async_can_resume_directly (ecma_value_t value) /**< awaited value */
+{
+#if JERRY_PROMISE_CALLBACK
+  const uint32_t filters = JERRY_PROMISE_EVENT_FILTER_MAIN | JERRY_PROMISE_EVENT_FILTER_ASYNC_MAIN;
+
+  if (JERRY_CONTEXT (promise_callback_filters) & filters)
+  {
+    return false;
+  }
+#endif /* JERRY_PROMISE_CALLBACK */
+
+  return !ecma_is_value_object (value);
+} /* ecma_promise_async_can_resume_directly */
+
 /**
  * Resume the execution of an async function after the promise is resolved
  */
@@ -1309,6 +1335,15 @@ ecma_value_t
 ecma_promise_async_await (ecma_extended_object_t *async_generator_object_p, /**< async generator function */
                           ecma_value_t value) /**< value to be resolved (takes the reference) */
 {
+  if (ecma_promise_async_can_resume_directly (value))
+  {
+    ecma_enqueue_promise_async_reaction_job (ecma_make_object_value ((ecma_object_t *) async_generator_object_p),
+                                             value,
+                                             false);
+    ecma_free_value (value);
+    return ECMA_VALUE_UNDEFINED;
+  }
+
   ecma_value_t promise = ecma_make_object_value (ecma_builtin_get (ECMA_BUILTIN_ID_PROMISE));
   ecma_value_t result = ecma_promise_reject_or_resolve (promise, value, true);
 
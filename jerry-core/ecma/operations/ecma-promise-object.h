@@ -126,6 +126,7 @@ ecma_value_t ecma_op_get_capabilities_executor_cb (ecma_object_t *function_obj_p
                                                    const ecma_value_t args_p[], const uint32_t args_count);
 
 ecma_value_t ecma_promise_finally (ecma_value_t promise, ecma_value_t on_finally);
+bool ecma_promise_async_can_resume_directly (ecma_value_t value);
 void ecma_promise_async_then (ecma_value_t promise, ecma_value_t executable_object);
 ecma_value_t ecma_promise_async_await (ecma_extended_object_t *async_generator_object_p, ecma_value_t value);
 ecma_value_t ecma_promise_run_executor (ecma_object_t *promise_p, ecma_value_t executor, ecma_value_t this_value);
@@ -39,6 +39,7 @@ void jerry_gc (jerry_gc_mode_t mode);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+void jerry_reset_time_zone_cache (void);
 
 /**
  * Parser and executor functions.
@@ -53,6 +54,8 @@ jerry_value_t jerry_run (const jerry_value_t func_val);
 jerry_value_t jerry_eval (const jerry_char_t *source_p, size_t source_size, uint32_t parse_opts);
 
 jerry_value_t jerry_run_all_enqueued_jobs (void);
+jerry_value_t jerry_run_enqueued_jobs_with_budget (uint32_t max_jobs, uint32_t max_time);
+bool jerry_has_enqueued_jobs (void);
 
 /**
  * Get the global context.
@@ -416,6 +419,9 @@ jerry_value_t jerry_get_typedarray_buffer (jerry_value_t value,
                                            jerry_length_t *byte_offset,
                                            jerry_length_t *byte_length);
 jerry_value_t jerry_json_parse (const jerry_char_t *string_p, jerry_size_t string_size);
+jerry_value_t jerry_json_parse_with_options (const jerry_char_t *string_p, jerry_size_t string_size,
+                                             uint32_t options);
+jerry_value_t jerry_json_parse_stream (jerry_json_read_callback_t read_cb, void *user_p);
 jerry_value_t jerry_json_stringify (const jerry_value_t object_to_stringify);
 jerry_value_t jerry_create_container (jerry_container_type_t container_type,
                                       const jerry_value_t *arguments_list_p,
@@ -112,11 +112,9 @@ void JERRY_ATTR_FORMAT (printf, 2, 3) jerry_port_log (jerry_log_level_t level, c
 
 /**
  * Get local time zone adjustment, in milliseconds, for the given timestamp.
- * The timestamp can be specified in either UTC or local time, depending on
- * the value of is_utc. Adding the value returned from this function to
- * a timestamp in UTC time should result in local time for the current time
- * zone, and subtracting it from a timestamp in local time should result in
- * UTC time.
+ * The timestamp is always in UTC time. Adding the value returned from this
+ * function to the timestamp should result in local time for the current time
+ * zone. The engine converts local time to UTC time by itself.
  *
  * Ideally, this function should satisfy the stipulations applied to LocalTZA
  * in section 20.3.1.7 of the ECMAScript version 9.0 spec.
@@ -129,13 +127,19 @@ void JERRY_ATTR_FORMAT (printf, 2, 3) jerry_port_log (jerry_log_level_t level, c
  *      JERRY_BUILTIN_DATE is defined to 1. Otherwise this function is
  *      not used.
  *
+ *      The engine caches the returned adjustments as intervals of time
+ *      values, assuming that the adjustment changes at most once in
+ *      19 days. When the local time zone changes, the cache must be
+ *      invalidated by calling jerry_reset_time_zone_cache.
+ *
  * @param unix_ms The unix timestamp we want an offset for, given in
  *                millisecond precision (could be now, in the future,
  *                or in the past). As with all unix timestamps, 0 refers to
  *                1970-01-01, a day is exactly 86 400 000 milliseconds, and
  *                leap seconds cause the same second to occur twice.
- * @param is_utc Is the given timestamp in UTC time? If false, it is in local
- *               time.
+ * @param is_utc Is the given timestamp in UTC time? The engine always passes
+ *               true, the parameter is only kept for compatibility with ports
+ *               which also handle local time.
  *
  * @return milliseconds between local time and UTC for the given timestamp,
  *         if available
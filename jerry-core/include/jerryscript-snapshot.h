@@ -47,6 +47,7 @@ typedef enum
 {
   JERRY_SNAPSHOT_EXEC_COPY_DATA = (1u << 0), /**< copy snashot data */
   JERRY_SNAPSHOT_EXEC_ALLOW_STATIC = (1u << 1), /**< static snapshots allowed */
+  JERRY_SNAPSHOT_EXEC_LAZY_LOAD = (1u << 2), /**< load functions on their first use */
 } jerry_exec_snapshot_opts_t;
 
 /**
@@ -155,8 +155,18 @@ typedef uint32_t jerry_length_t;
 
 /**
  * Description of a JerryScript value.
- */
+ *
+ * Note:
+ *   the size of the value depends on JERRY_NAN_BOXING, which must have the same value
+ *   for the application as for the engine. The engine initializer is exported under a
+ *   different name when NaN-boxing is enabled, so a mismatch is reported by the linker.
+ */
+#if defined (JERRY_NAN_BOXING) && JERRY_NAN_BOXING
+typedef uint64_t jerry_value_t;
+#define jerry_init jerry_init_nan_boxing
+#else /* !defined (JERRY_NAN_BOXING) || !JERRY_NAN_BOXING */
 typedef uint32_t jerry_value_t;
+#endif /* defined (JERRY_NAN_BOXING) && JERRY_NAN_BOXING */
 
 /**
  * Option bits for jerry_parse_options_t.
@@ -184,6 +194,32 @@ typedef struct
   uint32_t start_column; /**< start column of the source code if JERRY_PARSE_HAS_START is set in options */
 } jerry_parse_options_t;
 
+/**
+ * Option bits for jerry_json_parse_with_options.
+ */
+typedef enum
+{
+  JERRY_JSON_PARSE_NO_OPTS = 0, /**< no options passed */
+  JERRY_JSON_PARSE_EXTERNAL_STRINGS = (1 << 0), /**< string tokens without escape sequences are created as
+                                                  *   external strings which refer to the JSON text, so
+                                                  *   the JSON text must be kept alive while these strings
+                                                  *   are in use */
+} jerry_json_parse_option_enable_feature_t;
+
+/**
+ * Callback which is called by jerry_json_parse_stream to read the next chunk of the JSON text.
+ *
+ * The callback copies at most buffer_size bytes into buffer_p and returns with the number of
+ * copied bytes. Returning with 0 indicates the end of the JSON text, and returning with
+ * JERRY_JSON_READ_ERROR aborts the parsing.
+ */
+typedef jerry_size_t (*jerry_json_read_callback_t) (jerry_char_t *buffer_p, jerry_size_t buffer_size, void *user_p);
+
+/**
+ * Value returned by jerry_json_read_callback_t when the JSON text cannot be read.
+ */
+#define JERRY_JSON_READ_ERROR ((jerry_size_t) -1)
+
 /**
  * Description of ECMA property descriptor.
  */
@@ -250,7 +286,9 @@ typedef struct
   size_t size; /**< heap total size */
   size_t allocated_bytes; /**< currently allocated bytes */
   size_t peak_allocated_bytes; /**< peak allocated bytes */
-  size_t reserved[4]; /**< padding for future extensions */
+  size_t regexp_cache_hits; /**< number of RegExp compilations served from the RegExp cache */
+  size_t regexp_cache_misses; /**< number of RegExp compilations not found in the RegExp cache */
+  size_t reserved[2]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
 /**
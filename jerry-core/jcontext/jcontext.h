@@ -46,6 +46,11 @@
  */
 #define CONFIG_MEM_STACK_LIMIT (JERRY_STACK_LIMIT * 1024)
 
+/**
+ * Maximum size of the vm frames allocated on the heap in bytes
+ */
+#define CONFIG_VM_HEAP_FRAMES_LIMIT ((uint32_t) JERRY_VM_HEAP_FRAMES_LIMIT * 1024)
+
 /**
  * Max heap usage limit
  */
@@ -126,8 +131,12 @@ struct jerry_context_t
   ecma_global_object_t *global_object_p; /**< current global object */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< improves deallocation performance */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
+#if JERRY_HEAP_SIZE_CLASSES
+  uint32_t jmem_heap_bins[JMEM_HEAP_BIN_COUNT]; /**< offsets of the first blocks of the size class free lists */
+#endif /* JERRY_HEAP_SIZE_CLASSES */
 #if JERRY_BUILTIN_REGEXP
-  re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  re_cache_entry_t re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  uint16_t re_cache_buckets[RE_CACHE_SIZE]; /**< first entries of the regex cache hash buckets */
 #endif /* JERRY_BUILTIN_REGEXP */
 #if JERRY_CPOINTER_32_BIT
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
@@ -135,6 +144,13 @@ struct jerry_context_t
   const lit_utf8_byte_t * const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
+#if (JERRY_GC_STEP_LIMIT != 0)
+  jmem_cpointer_t ecma_gc_sweep_cp; /**< List of unreachable objects which are not freed yet. */
+  jmem_cpointer_t ecma_gc_mark_start_cp; /**< first object of the list which is not created by the incremental marking
+                                          *   since the last visit of the newly created objects */
+  jmem_cpointer_t ecma_gc_mark_cursor_cp; /**< next object of the list visited by the incremental marking */
+  jmem_cpointer_t ecma_gc_mark_end_cp; /**< end of the objects visited by the incremental marking */
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
   jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
 #if JERRY_ESNEXT
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
@@ -143,6 +159,10 @@ struct jerry_context_t
 #if JERRY_BUILTIN_BIGINT
   jmem_cpointer_t bigint_list_first_cp; /**< first item of the literal bigint list */
 #endif /* JERRY_BUILTIN_BIGINT */
+#if JERRY_LIT_HASH_TABLE
+  ecma_lit_hash_table_t string_hash_table; /**< hash table index of the literal string list */
+  ecma_lit_hash_table_t number_hash_table; /**< hash table index of the literal number list */
+#endif /* JERRY_LIT_HASH_TABLE */
 #if JERRY_ESNEXT
   jmem_cpointer_t global_symbols_cp[ECMA_BUILTIN_GLOBAL_SYMBOL_COUNT]; /**< global symbols */
 #endif /* JERRY_ESNEXT */
@@ -170,19 +190,49 @@ struct jerry_context_t
 #if (JERRY_GC_MARK_LIMIT != 0)
   uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects in the GC mark stack */
+  jmem_cpointer_t ecma_gc_mark_stack[ECMA_GC_MARK_STACK_SIZE]; /**< gray objects whose references are not marked yet */
+#if (JERRY_GC_STEP_LIMIT != 0)
+  uint32_t ecma_gc_mark_passes; /**< number of times the objects created during the incremental marking are visited */
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
 
 #if JERRY_PROPERTY_HASHMAP
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
+#if JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1
+  ecma_prop_hashmap_lookup_t ecma_prop_hashmap_lookups[ECMA_PROP_HASHMAP_LOOKUP_CACHE_SIZE]; /**< long property lookup
+                                                                                            *   counters */
+#endif /* JERRY_PROPERTY_HASHMAP_LOOKUP_LIMIT > 1 */
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_PROPERTY_SHAPES
+  ecma_property_shape_t *property_shapes_p; /**< property shape table, indexed by shape id */
+  uint32_t property_shape_count; /**< number of entries in the property shape table */
+  uint16_t property_shape_free_id; /**< first unused entry of the property shape table */
+#endif /* JERRY_PROPERTY_SHAPES */
+
+  ecma_string_index_cache_t string_index_cache; /**< last code unit position accessed in a non-ASCII string */
+
 #if JERRY_BUILTIN_REGEXP
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
+  uint16_t re_cache_count; /**< number of used regex cache entries */
+  uint16_t re_cache_lru_first; /**< most recently used regex cache entry */
+  uint16_t re_cache_lru_last; /**< least recently used regex cache entry, evicted when the cache is full */
+#if JERRY_MEM_STATS
+  uint32_t re_cache_hits; /**< number of regex compilations served from the cache */
+  uint32_t re_cache_misses; /**< number of regex compilations not found in the cache */
+#endif /* JERRY_MEM_STATS */
 #endif /* JERRY_BUILTIN_REGEXP */
 
+#if JERRY_BUILTIN_DATE
+  ecma_date_tza_interval_t date_tza_cache[ECMA_DATE_TZA_CACHE_SIZE]; /**< local time zone adjustment cache */
+  uint32_t date_tza_cache_next; /**< cache entry replaced by the next interval */
+#endif /* JERRY_BUILTIN_DATE */
+
 #if JERRY_BUILTIN_PROMISE
-  ecma_job_queue_item_t *job_queue_head_p; /**< points to the head item of the job queue */
-  ecma_job_queue_item_t *job_queue_tail_p; /**< points to the tail item of the job queue */
+  ecma_job_queue_slot_t *job_queue_buffer_p; /**< ring buffer of the job queue (NULL if not allocated) */
+  uint32_t job_queue_capacity; /**< number of slots of the ring buffer (0 or a power of 2) */
+  uint32_t job_queue_start; /**< slot index of the first enqueued job */
+  uint32_t job_queue_count; /**< number of enqueued jobs */
 #if JERRY_PROMISE_CALLBACK
   uint32_t promise_callback_filters; /**< reported event types for promise callback */
   void *promise_callback_user_p; /**< user pointer for promise callback */
@@ -202,6 +252,14 @@ struct jerry_context_t
   uintptr_t stack_base;  /**< stack base marker */
 #endif /* (JERRY_STACK_LIMIT != 0) */
 
+#if JERRY_VM_HEAP_FRAMES
+  vm_heap_frames_chunk_t *vm_heap_frames_chunk_p; /**< current chunk of the vm frame stack */
+  vm_heap_frames_chunk_t *vm_heap_frames_spare_chunk_p; /**< last released chunk of the vm frame stack */
+#if (JERRY_VM_HEAP_FRAMES_LIMIT != 0)
+  uint32_t vm_heap_frames_usage; /**< total size of the vm frames allocated on the heap */
+#endif /* (JERRY_VM_HEAP_FRAMES_LIMIT != 0) */
+#endif /* JERRY_VM_HEAP_FRAMES */
+
 #if JERRY_DEBUGGER
   uint8_t debugger_send_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for sending messages */
   uint8_t debugger_receive_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for receiving messages */
@@ -229,6 +287,11 @@ struct jerry_context_t
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* JERRY_LCACHE */
 
+#if JERRY_VM_INLINE_CACHE
+  uint32_t vm_inline_cache_epoch; /**< increased when a property is freed, see vm_inline_cache_entry_t */
+  vm_inline_cache_entry_t vm_inline_cache[VM_INLINE_CACHE_SIZE]; /**< inline caches of property accesses */
+#endif /* JERRY_VM_INLINE_CACHE */
+
 #if JERRY_ESNEXT
   /**
    * Allowed values and it's meaning:
@@ -141,6 +141,36 @@ jmem_stats_free_property_bytes (size_t property_size)
   heap_stats->property_bytes -= property_size;
 } /* jmem_stats_free_property_bytes */
 
+/**
+ * Register a garbage collector pause.
+ */
+void
+jmem_stats_gc_pause (double pause_time) /**< length of the pause in milliseconds */
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  size_t pause_us = (pause_time > 0) ? (size_t) (pause_time * 1000.0) : 0;
+
+  heap_stats->gc_pause_count++;
+  heap_stats->gc_pause_time += pause_us;
+
+  if (pause_us > heap_stats->peak_gc_pause_time)
+  {
+    heap_stats->peak_gc_pause_time = pause_us;
+  }
+
+  uint32_t index = 0;
+  size_t limit = JMEM_GC_PAUSE_HISTOGRAM_BASE;
+
+  while (index < JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1 && pause_us >= limit)
+  {
+    index++;
+    limit <<= 1;
+  }
+
+  heap_stats->gc_pause_histogram[index]++;
+} /* jmem_stats_gc_pause */
+
 #endif /* JERRY_MEM_STATS */
 
 /**
@@ -66,6 +66,22 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 } /* jmem_heap_get_region_end */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
+#if JERRY_HEAP_SIZE_CLASSES
+/**
+ * Checks whether a block with the given aligned size is stored in a size class free list.
+ */
+#define JMEM_HEAP_IS_BIN_SIZE(size) \
+  ((size) >= JMEM_HEAP_BIN_MIN_SIZE && (size) <= JMEM_HEAP_BIN_MAX_SIZE)
+
+/**
+ * Get the size class free list of a block with the given aligned size.
+ */
+#define JMEM_HEAP_GET_BIN(size) \
+  (JERRY_CONTEXT (jmem_heap_bins) + (((size) - JMEM_HEAP_BIN_MIN_SIZE) / JMEM_ALIGNMENT))
+
+static bool jmem_heap_flush_bins (void);
+#endif /* JERRY_HEAP_SIZE_CLASSES */
+
 /**
  * Startup initialization of heap
  */
@@ -91,6 +107,13 @@ jmem_heap_init (void)
 
   JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
 
+#if JERRY_HEAP_SIZE_CLASSES
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+  }
+#endif /* JERRY_HEAP_SIZE_CLASSES */
+
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
 
@@ -110,6 +133,20 @@ jmem_heap_finalize (void)
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 } /* jmem_heap_finalize */
 
+/**
+ * Account a newly allocated block and raise the heap limit if it is reached.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_account_alloc (size_t size) /**< size of the allocated block */
+{
+  JERRY_CONTEXT (jmem_heap_allocated_size) += size;
+
+  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+  {
+    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+  }
+} /* jmem_heap_account_alloc */
+
 /**
  * Allocation of memory region.
  *
@@ -129,6 +166,25 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
+#if JERRY_HEAP_SIZE_CLASSES
+  /* Fast path for blocks which are available in the size class free lists. */
+  if (JMEM_HEAP_IS_BIN_SIZE (required_size)
+      && *JMEM_HEAP_GET_BIN (required_size) != JMEM_HEAP_END_OF_LIST)
+  {
+    uint32_t *bin_p = JMEM_HEAP_GET_BIN (required_size);
+
+    data_space_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (*bin_p);
+    JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
+
+    JMEM_VALGRIND_DEFINED_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+    JERRY_ASSERT (data_space_p->size == required_size);
+    *bin_p = data_space_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+
+    jmem_heap_account_alloc (required_size);
+  }
+  else
+#endif /* JERRY_HEAP_SIZE_CLASSES */
   /* Fast path for 8 byte chunks, first region is guaranteed to be sufficient. */
   if (required_size == JMEM_ALIGNMENT
       && JERRY_LIKELY (JERRY_HEAP_CONTEXT (first).next_offset != JMEM_HEAP_END_OF_LIST))
@@ -137,12 +193,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
     JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
 
     JMEM_VALGRIND_DEFINED_SPACE (data_space_p, sizeof (jmem_heap_free_t));
-    JERRY_CONTEXT (jmem_heap_allocated_size) += JMEM_ALIGNMENT;
-
-    if (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-    {
-      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-    }
+    jmem_heap_account_alloc (JMEM_ALIGNMENT);
 
     if (data_space_p->size == JMEM_ALIGNMENT)
     {
@@ -220,12 +271,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
         JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
 
         /* Found enough space. */
-        JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
-
-        while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-        {
-          JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-        }
+        jmem_heap_account_alloc (required_size);
 
         break;
       }
@@ -244,12 +290,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
   return (void *) data_space_p;
 #else /* JERRY_SYSTEM_ALLOCATOR */
-  JERRY_CONTEXT (jmem_heap_allocated_size) += size;
-
-  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-  {
-    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-  }
+  jmem_heap_account_alloc (size);
 
   return malloc (size);
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
@@ -290,10 +331,22 @@ jmem_heap_gc_and_alloc_block (const size_t size, /**< required memory size */
 
   void *data_space_p = jmem_heap_alloc (size);
 
+#if JERRY_HEAP_SIZE_CLASSES
+  /* Blocks in the size class free lists are not merged with their neighbours,
+   * so they are returned to the address ordered list before reclaiming memory. */
+  if (JERRY_UNLIKELY (data_space_p == NULL) && jmem_heap_flush_bins ())
+  {
+    data_space_p = jmem_heap_alloc (size);
+  }
+#endif /* JERRY_HEAP_SIZE_CLASSES */
+
   while (JERRY_UNLIKELY (data_space_p == NULL) && JERRY_LIKELY (pressure < max_pressure))
   {
     pressure++;
     ecma_free_unused_memory (pressure);
+#if JERRY_HEAP_SIZE_CLASSES
+    jmem_heap_flush_bins ();
+#endif /* JERRY_HEAP_SIZE_CLASSES */
     data_space_p = jmem_heap_alloc (size);
   }
 
@@ -445,6 +498,43 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
   JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
 } /* jmem_heap_insert_block */
+
+#if JERRY_HEAP_SIZE_CLASSES
+/**
+ * Moves all blocks of the size class free lists into the address ordered free list,
+ * where they can be merged with their neighbours.
+ *
+ * @return true - if any block has been moved,
+ *         false - otherwise
+ */
+static bool
+jmem_heap_flush_bins (void)
+{
+  bool has_blocks = false;
+
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    uint32_t block_offset = JERRY_CONTEXT (jmem_heap_bins)[i];
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+
+    while (block_offset != JMEM_HEAP_END_OF_LIST)
+    {
+      jmem_heap_free_t *block_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (block_offset);
+      JERRY_ASSERT (jmem_is_heap_pointer (block_p));
+
+      JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+      const uint32_t block_size = block_p->size;
+      block_offset = block_p->next_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+      jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), block_size);
+      has_blocks = true;
+    }
+  }
+
+  return has_blocks;
+} /* jmem_heap_flush_bins */
+#endif /* JERRY_HEAP_SIZE_CLASSES */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
 /**
@@ -466,8 +556,25 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
   jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
-  jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
-  jmem_heap_insert_block (block_p, prev_p, aligned_size);
+
+#if JERRY_HEAP_SIZE_CLASSES
+  if (JMEM_HEAP_IS_BIN_SIZE (aligned_size))
+  {
+    uint32_t *bin_p = JMEM_HEAP_GET_BIN (aligned_size);
+
+    JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+    block_p->size = (uint32_t) aligned_size;
+    block_p->next_offset = *bin_p;
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, aligned_size);
+
+    *bin_p = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+  }
+  else
+#endif /* JERRY_HEAP_SIZE_CLASSES */
+  {
+    jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
+    jmem_heap_insert_block (block_p, prev_p, aligned_size);
+  }
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
@@ -623,12 +730,7 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
   {
     /* Managed to extend the block. Update memory usage and the skip pointer. */
     JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
-    JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
-
-    while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-    {
-      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-    }
+    jmem_heap_account_alloc (required_size);
   }
   else
   {
@@ -663,12 +765,7 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
   ecma_gc_run ();
 #endif /* JERRY_MEM_GC_BEFORE_EACH_ALLOC */
 
-  JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
-
-  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-  {
-    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-  }
+  jmem_heap_account_alloc (required_size);
 
   while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
   {
@@ -693,6 +790,20 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
   return;
 } /* jmem_heap_free_block */
 
+#if (JERRY_GC_STEP_LIMIT != 0)
+/**
+ * Set the heap limit, so the next garbage collection step is
+ * triggered after the specified amount of memory is allocated
+ */
+void
+jmem_heap_set_gc_step_interval (size_t interval) /**< number of bytes allocated before the next step */
+{
+  JERRY_ASSERT (interval > 0 && interval <= CONFIG_GC_LIMIT);
+
+  JERRY_CONTEXT (jmem_heap_limit) = JERRY_CONTEXT (jmem_heap_allocated_size) + interval;
+} /* jmem_heap_set_gc_step_interval */
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
 #ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
@@ -765,6 +876,26 @@ jmem_heap_stats_print (void)
                    heap_stats->peak_object_bytes,
                    heap_stats->property_bytes,
                    heap_stats->peak_property_bytes);
+
+  JERRY_DEBUG_MSG ("  GC pauses = %zu\n"
+                   "  Total GC pause time = %zu us\n"
+                   "  Longest GC pause = %zu us\n"
+                   "  GC pause histogram:\n",
+                   heap_stats->gc_pause_count,
+                   heap_stats->gc_pause_time,
+                   heap_stats->peak_gc_pause_time);
+
+  size_t limit = JMEM_GC_PAUSE_HISTOGRAM_BASE;
+
+  for (uint32_t i = 0; i < JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1; i++)
+  {
+    JERRY_DEBUG_MSG ("    < %zu us: %zu\n", limit, heap_stats->gc_pause_histogram[i]);
+    limit <<= 1;
+  }
+
+  JERRY_DEBUG_MSG ("    >= %zu us: %zu\n",
+                   limit >> 1,
+                   heap_stats->gc_pause_histogram[JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1]);
 } /* jmem_heap_stats_print */
 
 /**
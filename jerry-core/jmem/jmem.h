@@ -139,6 +139,25 @@ typedef struct
   uint32_t size; /**< Size of region */
 } jmem_heap_free_t;
 
+#if JERRY_HEAP_SIZE_CLASSES
+
+/**
+ * Smallest block size which is stored in the size class free lists.
+ */
+#define JMEM_HEAP_BIN_MIN_SIZE (2 * JMEM_ALIGNMENT)
+
+/**
+ * Largest block size which is stored in the size class free lists.
+ */
+#define JMEM_HEAP_BIN_MAX_SIZE 256
+
+/**
+ * Number of size class free lists.
+ */
+#define JMEM_HEAP_BIN_COUNT (((JMEM_HEAP_BIN_MAX_SIZE - JMEM_HEAP_BIN_MIN_SIZE) / JMEM_ALIGNMENT) + 1)
+
+#endif /* JERRY_HEAP_SIZE_CLASSES */
+
 void jmem_init (void);
 void jmem_finalize (void);
 
@@ -147,7 +166,22 @@ void *jmem_heap_alloc_block_null_on_error (const size_t size);
 void *jmem_heap_realloc_block (void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
+#if (JERRY_GC_STEP_LIMIT != 0)
+void jmem_heap_set_gc_step_interval (size_t interval);
+#endif /* (JERRY_GC_STEP_LIMIT != 0) */
+
 #if JERRY_MEM_STATS
+/**
+ * Upper limit of the first bucket of the GC pause time histogram in microseconds,
+ * the limit of each following bucket is twice the limit of the previous one.
+ */
+#define JMEM_GC_PAUSE_HISTOGRAM_BASE 100
+
+/**
+ * Number of buckets of the GC pause time histogram (the last bucket is unlimited).
+ */
+#define JMEM_GC_PAUSE_HISTOGRAM_SIZE 11
+
 /**
  * Heap memory usage statistics
  */
@@ -172,6 +206,11 @@ typedef struct
 
   size_t property_bytes; /**< allocated memory for properties */
   size_t peak_property_bytes; /**< peak allocated memory for properties */
+
+  size_t gc_pause_count; /**< number of garbage collector pauses */
+  size_t gc_pause_time; /**< total time of garbage collector pauses in microseconds */
+  size_t peak_gc_pause_time; /**< longest garbage collector pause in microseconds */
+  size_t gc_pause_histogram[JMEM_GC_PAUSE_HISTOGRAM_SIZE]; /**< number of pauses in each duration range */
 } jmem_heap_stats_t;
 
 void jmem_stats_allocate_byte_code_bytes (size_t property_size);
@@ -182,6 +221,7 @@ void jmem_stats_allocate_object_bytes (size_t object_size);
 void jmem_stats_free_object_bytes (size_t string_size);
 void jmem_stats_allocate_property_bytes (size_t property_size);
 void jmem_stats_free_property_bytes (size_t property_size);
+void jmem_stats_gc_pause (double pause_time);
 
 void jmem_heap_get_stats (jmem_heap_stats_t *);
 void jmem_heap_stats_reset_peak (void);
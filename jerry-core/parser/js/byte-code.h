@@ -891,12 +891,61 @@ typedef enum
   CBC_CODE_FLAGS_STATIC_FUNCTION = (1u << 8), /**< this function is a static snapshot function */
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 9), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 10), /**< compiled code needs a lexical block */
+#if JERRY_LAZY_FUNCTIONS
+  CBC_CODE_FLAGS_LAZY_FUNCTION = (1u << 11), /**< the function body is compiled on its first call
+                                              *   (see cbc_lazy_function_info_t) */
+#endif /* JERRY_LAZY_FUNCTIONS */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
            check a range of types without decoding the actual type. */
 } cbc_code_flags_t;
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Source code description of a function whose body is compiled on its first call.
+ *
+ * The compiled code of such functions has a cbc_uint8_arguments_t header without registers,
+ * and the literal group only contains the resource name (when available) followed by a
+ * function literal slot, which holds the compiled body once it is available (literal_end
+ * is increased at that point). This structure follows the function literal slot.
+ */
+typedef struct
+{
+  ecma_value_t source; /**< internal pointer to the argument list followed by the function body
+                        *   (released after the body is compiled) */
+  uint32_t argument_list_size; /**< size of the argument list */
+  uint32_t source_size; /**< total size of the argument list and the function body */
+  uint32_t line; /**< start line of the function body */
+  uint32_t column; /**< start column of the function body */
+} cbc_lazy_function_info_t;
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+#if JERRY_SNAPSHOT_EXEC
+
+/**
+ * Function of a snapshot which is loaded on its first use (see JERRY_SNAPSHOT_EXEC_LAZY_LOAD).
+ *
+ * The function literal slot of the enclosing compiled code refers to this structure
+ * until the function is loaded. The size field of its header is zero, which is never
+ * the case for real compiled code.
+ */
+typedef struct
+{
+  ecma_compiled_code_t header; /**< compiled code header (size is zero) */
+  const uint8_t *base_addr_p; /**< start of the function in the snapshot buffer */
+  const uint8_t *literal_base_p; /**< start of the literal table of the snapshot buffer */
+} cbc_snapshot_function_t;
+
+/**
+ * Checks whether a function literal refers to a snapshot function which is not loaded yet.
+ */
+#define CBC_IS_SNAPSHOT_FUNCTION(compiled_code_p) ((compiled_code_p)->size == 0)
+
+#endif /* JERRY_SNAPSHOT_EXEC */
+
 /**
  * Compact byte code function types.
  */
@@ -2492,6 +2492,134 @@ lexer_construct_unused_literal (parser_context_t *context_p) /**< context */
   return literal_p;
 } /* lexer_construct_unused_literal */
 
+/**
+ * Free the literal hash table of the current function.
+ */
+void
+lexer_free_literal_hash (parser_context_t *context_p) /**< context */
+{
+  if (context_p->literal_hash_p != NULL)
+  {
+    parser_free (context_p->literal_hash_p, context_p->literal_hash_size * sizeof (parser_literal_hash_entry_t));
+  }
+
+  context_p->literal_hash_p = NULL;
+  context_p->literal_hash_size = 0;
+} /* lexer_free_literal_hash */
+
+/**
+ * Release the literal hash tables of all functions which are being parsed.
+ * The literal pools of these functions are searched linearly afterwards.
+ *
+ * @return true - if any memory is released, false - otherwise
+ */
+bool
+lexer_release_literal_hashes (parser_context_t *context_p) /**< context */
+{
+  bool is_released = (context_p->literal_hash_p != NULL);
+
+  lexer_free_literal_hash (context_p);
+  context_p->literal_hash_size = 1;
+
+  parser_saved_context_t *saved_context_p = context_p->last_context_p;
+
+  while (saved_context_p != NULL)
+  {
+    if (saved_context_p->literal_hash_p != NULL)
+    {
+      parser_free (saved_context_p->literal_hash_p,
+                   saved_context_p->literal_hash_size * sizeof (parser_literal_hash_entry_t));
+      saved_context_p->literal_hash_p = NULL;
+      is_released = true;
+    }
+
+    saved_context_p->literal_hash_size = 1;
+    saved_context_p = saved_context_p->prev_context_p;
+  }
+
+  return is_released;
+} /* lexer_release_literal_hashes */
+
+/**
+ * Insert a literal into the literal hash table.
+ */
+static void
+lexer_insert_literal_hash (parser_context_t *context_p, /**< context */
+                           lexer_literal_t *literal_p, /**< identifier or string literal */
+                           lit_string_hash_t hash, /**< hash of the literal characters */
+                           uint32_t literal_index) /**< index of the literal */
+{
+  uint32_t mask = context_p->literal_hash_size - 1;
+  uint32_t position = hash & mask;
+
+  while (context_p->literal_hash_p[position].literal_p != NULL)
+  {
+    position = (position + 1) & mask;
+  }
+
+  parser_literal_hash_entry_t *entry_p = context_p->literal_hash_p + position;
+  entry_p->literal_p = literal_p;
+  entry_p->index = (uint16_t) literal_index;
+  entry_p->hash_high = (uint16_t) (hash >> 16);
+} /* lexer_insert_literal_hash */
+
+/**
+ * Build the literal hash table from the identifier and string
+ * literals of the literal pool, replacing the previous table.
+ *
+ * Note:
+ *   the table is only an optimization: when it cannot be allocated, the literal
+ *   pool of the current function is searched linearly instead of throwing an error
+ */
+static void
+lexer_build_literal_hash (parser_context_t *context_p) /**< context */
+{
+  uint32_t size = 2 * PARSER_LITERAL_HASH_THRESHOLD;
+
+  while (size < 2 * (uint32_t) context_p->literal_count)
+  {
+    size <<= 1;
+  }
+
+  lexer_free_literal_hash (context_p);
+
+  size_t table_size = size * sizeof (parser_literal_hash_entry_t);
+  parser_literal_hash_entry_t *hash_p;
+  hash_p = (parser_literal_hash_entry_t *) jmem_heap_alloc_block_null_on_error (table_size);
+
+  if (hash_p == NULL)
+  {
+    /* Non-zero size without a table disables further attempts. */
+    context_p->literal_hash_size = 1;
+    return;
+  }
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    hash_p[i].literal_p = NULL;
+  }
+
+  context_p->literal_hash_p = hash_p;
+  context_p->literal_hash_size = size;
+
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  uint32_t literal_index = 0;
+
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (literal_p->type == LEXER_IDENT_LITERAL || literal_p->type == LEXER_STRING_LITERAL)
+    {
+      lit_string_hash_t hash = lit_utf8_string_calc_hash (literal_p->u.char_p, literal_p->prop.length);
+      lexer_insert_literal_hash (context_p, literal_p, hash, literal_index);
+    }
+
+    literal_index++;
+  }
+} /* lexer_build_literal_hash */
+
 /**
  * Construct a literal object from an identifier.
  */
@@ -2511,6 +2639,7 @@ lexer_construct_literal_object (parser_context_t *context_p, /**< context */
   parser_list_iterator_t literal_iterator;
   lexer_literal_t *literal_p;
   uint32_t literal_index = 0;
+  lit_string_hash_t hash = 0;
   bool search_scope_stack = (literal_type == LEXER_IDENT_LITERAL);
 
   if (JERRY_UNLIKELY (literal_type == LEXER_NEW_IDENT_LITERAL))
@@ -2524,46 +2653,76 @@ lexer_construct_literal_object (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (literal_type != LEXER_IDENT_LITERAL || length <= PARSER_MAXIMUM_IDENT_LENGTH);
   JERRY_ASSERT (literal_type != LEXER_STRING_LITERAL || length <= PARSER_MAXIMUM_STRING_LENGTH);
 
-  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+  if (context_p->literal_hash_p != NULL)
+  {
+    /* Large literal pools are searched through the hash table. */
+    uint32_t mask = context_p->literal_hash_size - 1;
+    hash = lit_utf8_string_calc_hash (char_p, (lit_utf8_size_t) length);
 
-  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+    uint32_t position = hash & mask;
+
+    while ((literal_p = context_p->literal_hash_p[position].literal_p) != NULL)
+    {
+      if (context_p->literal_hash_p[position].hash_high == (uint16_t) (hash >> 16)
+          && literal_p->type == literal_type
+          && literal_p->prop.length == length
+          && memcmp (literal_p->u.char_p, char_p, length) == 0)
+      {
+        literal_index = context_p->literal_hash_p[position].index;
+        break;
+      }
+
+      position = (position + 1) & mask;
+    }
+  }
+  else
   {
-    if (literal_p->type == literal_type
-        && literal_p->prop.length == length
-        && memcmp (literal_p->u.char_p, char_p, length) == 0)
+    parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+
+    while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
     {
-      context_p->lit_object.literal_p = literal_p;
-      context_p->lit_object.index = (uint16_t) literal_index;
+      if (literal_p->type == literal_type
+          && literal_p->prop.length == length
+          && memcmp (literal_p->u.char_p, char_p, length) == 0)
+      {
+        break;
+      }
 
-      parser_free_allocated_buffer (context_p);
+      literal_index++;
+    }
+  }
+
+  if (literal_p != NULL)
+  {
+    context_p->lit_object.literal_p = literal_p;
+    context_p->lit_object.index = (uint16_t) literal_index;
+
+    parser_free_allocated_buffer (context_p);
+
+    if (search_scope_stack)
+    {
+      parser_scope_stack_t *scope_stack_start_p = context_p->scope_stack_p;
+      parser_scope_stack_t *scope_stack_p = scope_stack_start_p + context_p->scope_stack_top;
 
-      if (search_scope_stack)
+      while (scope_stack_p > scope_stack_start_p)
       {
-        parser_scope_stack_t *scope_stack_start_p = context_p->scope_stack_p;
-        parser_scope_stack_t *scope_stack_p = scope_stack_start_p + context_p->scope_stack_top;
+        scope_stack_p--;
 
-        while (scope_stack_p > scope_stack_start_p)
+        if (scope_stack_p->map_from == literal_index)
         {
-          scope_stack_p--;
-
-          if (scope_stack_p->map_from == literal_index)
-          {
-            JERRY_ASSERT (scanner_decode_map_to (scope_stack_p) >= PARSER_REGISTER_START
-                          || (literal_p->status_flags & LEXER_FLAG_USED));
-            context_p->lit_object.index = scanner_decode_map_to (scope_stack_p);
-            return;
-          }
+          JERRY_ASSERT (scanner_decode_map_to (scope_stack_p) >= PARSER_REGISTER_START
+                        || (literal_p->status_flags & LEXER_FLAG_USED));
+          context_p->lit_object.index = scanner_decode_map_to (scope_stack_p);
+          return;
         }
-
-        literal_p->status_flags |= LEXER_FLAG_USED;
       }
-      return;
-    }
 
-    literal_index++;
+      literal_p->status_flags |= LEXER_FLAG_USED;
+    }
+    return;
   }
 
-  JERRY_ASSERT (literal_index == context_p->literal_count);
+  literal_index = context_p->literal_count;
 
   if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
@@ -2607,6 +2766,22 @@ lexer_construct_literal_object (parser_context_t *context_p, /**< context */
   context_p->lit_object.index = (uint16_t) literal_index;
   context_p->literal_count++;
 
+  if (context_p->literal_hash_p == NULL)
+  {
+    if (context_p->literal_count >= PARSER_LITERAL_HASH_THRESHOLD && context_p->literal_hash_size == 0)
+    {
+      lexer_build_literal_hash (context_p);
+    }
+  }
+  else if (4 * (uint32_t) context_p->literal_count > 3 * context_p->literal_hash_size)
+  {
+    lexer_build_literal_hash (context_p);
+  }
+  else
+  {
+    lexer_insert_literal_hash (context_p, literal_p, hash, literal_index);
+  }
+
   JERRY_ASSERT (context_p->u.allocated_buffer_p == NULL);
 } /* lexer_construct_literal_object */
 
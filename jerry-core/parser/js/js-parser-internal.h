@@ -499,6 +499,16 @@ typedef struct
 
 #endif /* JERRY_LINE_INFO */
 
+/**
+ * Entry of the literal hash table.
+ */
+typedef struct
+{
+  lexer_literal_t *literal_p;                 /**< identifier or string literal (NULL for empty entries) */
+  uint16_t index;                             /**< index of the literal in the literal pool */
+  uint16_t hash_high;                         /**< upper half of the hash of the literal characters */
+} parser_literal_hash_entry_t;
+
 /**
  * Those members of a context which needs
  * to be saved when a sub-function is parsed.
@@ -524,6 +534,8 @@ typedef struct parser_saved_context_t
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< byte code size for branches */
   parser_mem_data_t literal_pool_data;        /**< literal list */
+  parser_literal_hash_entry_t *literal_hash_p; /**< literal hash table */
+  uint32_t literal_hash_size;                 /**< size of literal hash table */
   parser_scope_stack_t *scope_stack_p;        /**< scope stack */
   uint16_t scope_stack_size;                  /**< size of scope stack */
   uint16_t scope_stack_top;                   /**< preserved top of scope stack */
@@ -602,6 +614,9 @@ typedef struct
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< current byte code size for branches */
   parser_list_t literal_pool;                 /**< literal list */
+  parser_literal_hash_entry_t *literal_hash_p; /**< hash table of identifier and string literals
+                                               *   (NULL if the literal pool is searched linearly) */
+  uint32_t literal_hash_size;                 /**< size of literal hash table */
   parser_mem_data_t stack;                    /**< storage space */
   parser_scope_stack_t *scope_stack_p;        /**< scope stack */
   parser_mem_page_t *free_page_p;             /**< space for fast allocation */
@@ -781,6 +796,8 @@ const uint8_t *lexer_convert_literal_to_chars (parser_context_t *context_p,  con
                                                uint8_t *local_byte_array_p, lexer_string_options_t opts);
 void lexer_expect_object_literal_id (parser_context_t *context_p, uint32_t ident_opts);
 lexer_literal_t *lexer_construct_unused_literal (parser_context_t *context_p);
+void lexer_free_literal_hash (parser_context_t *context_p);
+bool lexer_release_literal_hashes (parser_context_t *context_p);
 void lexer_construct_literal_object (parser_context_t *context_p, const lexer_lit_location_t *lit_location_p,
                                      uint8_t literal_type);
 bool lexer_construct_number_object (parser_context_t *context_p, bool is_expr, bool is_negative_number);
@@ -836,6 +853,9 @@ void scanner_release_switch_cases (scanner_case_info_t *case_p);
 void scanner_seek (parser_context_t *context_p);
 void scanner_reverse_info_list (parser_context_t *context_p);
 void scanner_cleanup (parser_context_t *context_p);
+#if JERRY_LAZY_FUNCTIONS
+void scanner_release_until (parser_context_t *context_p, const uint8_t *source_end_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
 bool scanner_is_context_needed (parser_context_t *context_p, parser_check_context_type_t check_type);
 #if JERRY_ESNEXT
@@ -93,6 +93,15 @@
 
 #endif /* !PARSER_MAXIMUM_STACK_LIMIT */
 
+/**
+ * Number of literals in a function after which identifier and string
+ * literals are looked up through a hash table instead of a linear search.
+ * Limit: PARSER_MAXIMUM_NUMBER_OF_LITERALS. Recommended: 32.
+ */
+#ifndef PARSER_LITERAL_HASH_THRESHOLD
+#define PARSER_LITERAL_HASH_THRESHOLD 32
+#endif /* !PARSER_LITERAL_HASH_THRESHOLD */
+
 /* Checks. */
 
 #if (PARSER_MAXIMUM_STRING_LENGTH < 1) || (PARSER_MAXIMUM_STRING_LENGTH > PARSER_MAXIMUM_STRING_LIMIT)
@@ -125,6 +134,10 @@
 #error "Maximum function stack usage is not within range."
 #endif /* (PARSER_MAXIMUM_STACK_LIMIT < 16) || (PARSER_MAXIMUM_STACK_LIMIT > 65500) */
 
+#if (PARSER_LITERAL_HASH_THRESHOLD < 1) || (PARSER_LITERAL_HASH_THRESHOLD > PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+#error "Literal hash threshold is not within range."
+#endif /* (PARSER_LITERAL_HASH_THRESHOLD < 1) || (PARSER_LITERAL_HASH_THRESHOLD > PARSER_MAXIMUM_NUMBER_OF_LITERALS) */
+
 /**
  * @}
  * @}
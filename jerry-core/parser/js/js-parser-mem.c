@@ -42,9 +42,18 @@ parser_malloc (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (size > 0);
   result = jmem_heap_alloc_block_null_on_error (size);
 
-  if (result == NULL)
+  if (JERRY_UNLIKELY (result == NULL))
   {
-    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+    /* Literal hash tables are only needed for speed, so they are released before giving up. */
+    if (lexer_release_literal_hashes (context_p))
+    {
+      result = jmem_heap_alloc_block_null_on_error (size);
+    }
+
+    if (result == NULL)
+    {
+      parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+    }
   }
   return result;
 } /* parser_malloc */
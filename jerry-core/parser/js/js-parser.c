@@ -20,6 +20,7 @@
 #include "ecma-module.h"
 #include "jcontext.h"
 #include "js-parser-internal.h"
+#include "lit-char-helpers.h"
 
 #if JERRY_PARSER
 
@@ -608,6 +609,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   ecma_value_t *literal_pool_p;
   uint8_t *dst_p;
 
+  /* Literals are not searched anymore, so the hash table
+   * is released before the byte code is allocated. */
+  lexer_free_literal_hash (context_p);
+
 #if JERRY_ESNEXT
   if ((context_p->status_flags & (PARSER_IS_FUNCTION | PARSER_LEXICAL_BLOCK_NEEDED))
       == (PARSER_IS_FUNCTION | PARSER_LEXICAL_BLOCK_NEEDED))
@@ -1873,6 +1878,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   parser_list_init (&context.literal_pool,
                     sizeof (lexer_literal_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_literal_t)));
+  context.literal_hash_p = NULL;
+  context.literal_hash_size = 0;
   context.scope_stack_p = NULL;
   context.scope_stack_size = 0;
   context.scope_stack_top = 0;
@@ -2067,6 +2074,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   }
   PARSER_TRY_END
 
+  lexer_free_literal_hash (&context);
+
   if (context.scope_stack_p != NULL)
   {
     parser_free (context.scope_stack_p, context.scope_stack_size * sizeof (parser_scope_stack_t));
@@ -2195,6 +2204,8 @@ parser_save_context (parser_context_t *context_p, /**< context */
   saved_context_p->byte_code = context_p->byte_code;
   saved_context_p->byte_code_size = context_p->byte_code_size;
   saved_context_p->literal_pool_data = context_p->literal_pool.data;
+  saved_context_p->literal_hash_p = context_p->literal_hash_p;
+  saved_context_p->literal_hash_size = context_p->literal_hash_size;
   saved_context_p->scope_stack_p = context_p->scope_stack_p;
   saved_context_p->scope_stack_size = context_p->scope_stack_size;
   saved_context_p->scope_stack_top = context_p->scope_stack_top;
@@ -2230,6 +2241,8 @@ parser_save_context (parser_context_t *context_p, /**< context */
   parser_cbc_stream_init (&context_p->byte_code);
   context_p->byte_code_size = 0;
   parser_list_reset (&context_p->literal_pool);
+  context_p->literal_hash_p = NULL;
+  context_p->literal_hash_size = 0;
   context_p->scope_stack_p = NULL;
   context_p->scope_stack_size = 0;
   context_p->scope_stack_top = 0;
@@ -2260,6 +2273,7 @@ parser_restore_context (parser_context_t *context_p, /**< context */
                         parser_saved_context_t *saved_context_p) /**< target for saving the context */
 {
   parser_list_free (&context_p->literal_pool);
+  JERRY_ASSERT (context_p->literal_hash_p == NULL);
 
   if (context_p->scope_stack_p != NULL)
   {
@@ -2290,6 +2304,8 @@ parser_restore_context (parser_context_t *context_p, /**< context */
   context_p->byte_code = saved_context_p->byte_code;
   context_p->byte_code_size = saved_context_p->byte_code_size;
   context_p->literal_pool.data = saved_context_p->literal_pool_data;
+  context_p->literal_hash_p = saved_context_p->literal_hash_p;
+  context_p->literal_hash_size = saved_context_p->literal_hash_size;
   context_p->scope_stack_p = saved_context_p->scope_stack_p;
   context_p->scope_stack_size = saved_context_p->scope_stack_size;
   context_p->scope_stack_top = saved_context_p->scope_stack_top;
@@ -2308,6 +2324,234 @@ parser_restore_context (parser_context_t *context_p, /**< context */
 #endif /* JERRY_LINE_INFO */
 } /* parser_restore_context */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Extra status flags of functions whose body can be compiled on its first call.
+ */
+#define PARSER_LAZY_FUNCTION_STATUS_FLAGS (PARSER_FUNCTION_CLOSURE | PARSER_IS_FUNC_EXPRESSION)
+
+/**
+ * Skip the body of a function and create a compiled code which compiles
+ * the body when the function is called for the first time.
+ *
+ * Note:
+ *      only normal functions with simple argument lists are compiled lazily,
+ *      the parser state is unchanged when NULL is returned
+ *
+ * @return compiled code - if the function body is skipped
+ *         NULL - otherwise
+ */
+static ecma_compiled_code_t *
+parser_parse_lazy_function (parser_context_t *context_p, /**< context */
+                            uint32_t status_flags) /**< extra status flags */
+{
+  /* The code passed to eval is usually executed immediately. */
+  if ((status_flags & (uint32_t) ~PARSER_LAZY_FUNCTION_STATUS_FLAGS) != 0
+      || (context_p->global_status_flags & ECMA_PARSE_EVAL))
+  {
+    return NULL;
+  }
+
+#if JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    return NULL;
+  }
+#endif /* JERRY_DEBUGGER */
+
+  if (!lexer_check_next_character (context_p, LIT_CHAR_LEFT_PAREN))
+  {
+    return NULL;
+  }
+
+  scanner_function_info_t *info_p = (scanner_function_info_t *) context_p->next_scanner_info_p;
+
+  if (info_p->info.source_p != context_p->source_p + 1
+      || info_p->info.type != SCANNER_TYPE_FUNCTION
+      || info_p->end_location.source_p == NULL)
+  {
+    return NULL;
+  }
+
+#if JERRY_ESNEXT
+  if (info_p->info.u8_arg & SCANNER_FUNCTION_HAS_COMPLEX_ARGUMENT)
+  {
+    return NULL;
+  }
+#endif /* JERRY_ESNEXT */
+
+  lexer_token_t saved_token = context_p->token;
+  scanner_location_t start_location;
+  scanner_get_location (&start_location, context_p);
+
+  lexer_next_token (context_p);
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_PAREN);
+
+  const uint8_t *argument_list_p = context_p->source_p;
+  uint32_t argument_count = 0;
+
+  lexer_next_token (context_p);
+
+  /* Only identifiers which need no special handling are accepted. */
+  while (context_p->token.type == LEXER_LITERAL
+         && context_p->token.lit_location.type == LEXER_IDENT_LITERAL
+         && context_p->token.keyword_type < LEXER_FIRST_NON_STRICT_ARGUMENTS
+         && argument_count < CBC_MAXIMUM_BYTE_VALUE)
+  {
+    argument_count++;
+    lexer_next_token (context_p);
+
+    if (context_p->token.type != LEXER_COMMA)
+    {
+      break;
+    }
+
+    lexer_next_token (context_p);
+  }
+
+  if (context_p->token.type != LEXER_RIGHT_PAREN)
+  {
+    context_p->token = saved_token;
+    scanner_set_location (context_p, &start_location);
+    return NULL;
+  }
+
+  size_t argument_list_size = (size_t) (context_p->source_p - 1 - argument_list_p);
+
+  lexer_next_token (context_p);
+
+  if (context_p->token.type != LEXER_LEFT_BRACE)
+  {
+    context_p->token = saved_token;
+    scanner_set_location (context_p, &start_location);
+    return NULL;
+  }
+
+  const uint8_t *body_p = context_p->source_p;
+  parser_line_counter_t body_line = context_p->line;
+  parser_line_counter_t body_column = context_p->column;
+  scanner_location_t end_location = info_p->end_location;
+
+  JERRY_ASSERT (end_location.source_p > body_p && end_location.source_p[-1] == LIT_CHAR_RIGHT_BRACE);
+
+  size_t body_size = (size_t) (end_location.source_p - 1 - body_p);
+  size_t source_size = argument_list_size + body_size;
+
+  if (source_size == 0)
+  {
+    /* Empty functions are cheap to compile. */
+    context_p->token = saved_token;
+    scanner_set_location (context_p, &start_location);
+    return NULL;
+  }
+
+  bool is_strict = ((context_p->status_flags & PARSER_IS_STRICT)
+                    || (info_p->info.u8_arg & SCANNER_FUNCTION_IS_STRICT));
+
+  scanner_release_until (context_p, end_location.source_p);
+  scanner_set_location (context_p, &end_location);
+
+#if JERRY_ESNEXT
+  if (context_p->status_flags & PARSER_FUNCTION_IS_PARSING_ARGS)
+  {
+    /* Same as in parser_save_context. */
+    context_p->status_flags |= PARSER_LEXICAL_BLOCK_NEEDED;
+  }
+#endif /* JERRY_ESNEXT */
+
+  /* The closing brace is the current token as if the body was parsed. */
+  context_p->token.type = LEXER_RIGHT_BRACE;
+  context_p->token.flags = 0;
+  context_p->token.line = end_location.line;
+  context_p->token.column = end_location.column - 1;
+
+  uint8_t *source_p = (uint8_t *) parser_malloc (context_p, source_size);
+  memcpy (source_p, argument_list_p, argument_list_size);
+  memcpy (source_p + argument_list_size, body_p, body_size);
+
+  uint32_t const_literal_end = 0;
+#if JERRY_RESOURCE_NAME
+  const_literal_end++;
+#endif /* JERRY_RESOURCE_NAME */
+
+  /* The literal group is followed by the reserved slot of the compiled body. */
+  size_t total_size = (sizeof (cbc_uint8_arguments_t)
+                       + (const_literal_end + 1) * sizeof (ecma_value_t)
+                       + sizeof (cbc_lazy_function_info_t));
+
+#if JERRY_ESNEXT
+  /* function.name */
+  total_size += sizeof (ecma_value_t);
+#endif /* JERRY_ESNEXT */
+
+  total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
+
+  ecma_compiled_code_t *compiled_code_p;
+  compiled_code_p = (ecma_compiled_code_t *) jmem_heap_alloc_block_null_on_error (total_size);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    parser_free (source_p, source_size);
+    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+  }
+
+  memset (compiled_code_p, 0, total_size);
+
+#if JERRY_MEM_STATS
+  jmem_stats_allocate_byte_code_bytes (total_size);
+#endif /* JERRY_MEM_STATS */
+
+  compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
+  compiled_code_p->refs = 1;
+  compiled_code_p->status_flags = (uint16_t) (CBC_CODE_FLAGS_LAZY_FUNCTION
+                                              | CBC_FUNCTION_TO_TYPE_BITS (CBC_FUNCTION_NORMAL));
+
+  if (is_strict)
+  {
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) compiled_code_p;
+
+  args_p->argument_end = (uint8_t) argument_count;
+  args_p->const_literal_end = (uint8_t) const_literal_end;
+  args_p->literal_end = (uint8_t) const_literal_end;
+#if JERRY_BUILTIN_REALMS
+  ECMA_SET_INTERNAL_VALUE_POINTER (args_p->realm_value, JERRY_CONTEXT (global_object_p));
+#endif /* JERRY_BUILTIN_REALMS */
+
+  ecma_value_t *literal_pool_p = (ecma_value_t *) (args_p + 1);
+
+#if JERRY_RESOURCE_NAME
+  literal_pool_p[const_literal_end - 1] = context_p->resource_name;
+#endif /* JERRY_RESOURCE_NAME */
+
+  cbc_lazy_function_info_t *lazy_info_p = (cbc_lazy_function_info_t *) (literal_pool_p + const_literal_end + 1);
+
+  ECMA_SET_INTERNAL_VALUE_POINTER (lazy_info_p->source, source_p);
+  lazy_info_p->argument_list_size = (uint32_t) argument_list_size;
+  lazy_info_p->source_size = (uint32_t) source_size;
+  lazy_info_p->line = body_line;
+  lazy_info_p->column = body_column;
+
+#if JERRY_ESNEXT
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+#endif /* JERRY_ESNEXT */
+
+#if JERRY_PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("\n--- Function body skipped (%d bytes), compiled on its first call ---\n\n",
+                     (int) body_size);
+  }
+#endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+
+  return compiled_code_p;
+} /* parser_parse_lazy_function */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Parse function code
  *
@@ -2321,6 +2565,16 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   ecma_compiled_code_t *compiled_code_p;
 
   JERRY_ASSERT (status_flags & PARSER_IS_FUNCTION);
+
+#if JERRY_LAZY_FUNCTIONS
+  compiled_code_p = parser_parse_lazy_function (context_p, status_flags);
+
+  if (compiled_code_p != NULL)
+  {
+    return compiled_code_p;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   parser_save_context (context_p, &saved_context);
   context_p->status_flags |= status_flags;
 #if JERRY_ESNEXT
@@ -2820,6 +3074,10 @@ parser_raise_error (parser_context_t *context_p, /**< context */
     parser_free_literals (&context_p->literal_pool);
     context_p->literal_pool.data = saved_context_p->literal_pool_data;
 
+    lexer_free_literal_hash (context_p);
+    context_p->literal_hash_p = saved_context_p->literal_hash_p;
+    context_p->literal_hash_size = saved_context_p->literal_hash_size;
+
     if (context_p->scope_stack_p != NULL)
     {
       parser_free (context_p->scope_stack_p, context_p->scope_stack_size * sizeof (parser_scope_stack_t));
@@ -2863,6 +3121,105 @@ parser_raise_error (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (0);
 } /* parser_raise_error */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Compile the body of a function created by parser_parse_lazy_function.
+ *
+ * Note:
+ *      the compiled body is stored in the function literal slot of the
+ *      lazy compiled code, so the body is compiled only once
+ *
+ * @return pointer to the compiled body - if success
+ *         NULL - otherwise (an exception is raised)
+ */
+ecma_compiled_code_t *
+parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p) /**< lazy compiled code */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+  JERRY_ASSERT (!(bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS));
+
+  cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+  ecma_value_t *literal_pool_p = (ecma_value_t *) (args_p + 1);
+  uint32_t const_literal_end = args_p->const_literal_end;
+
+  if (args_p->literal_end > const_literal_end)
+  {
+    return ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t, literal_pool_p[const_literal_end]);
+  }
+
+  cbc_lazy_function_info_t *lazy_info_p = (cbc_lazy_function_info_t *) (literal_pool_p + const_literal_end + 1);
+  uint8_t *source_p = ECMA_GET_INTERNAL_VALUE_POINTER (uint8_t, lazy_info_p->source);
+
+  jerry_parse_options_t options;
+  options.options = JERRY_PARSE_HAS_START;
+  options.start_line = lazy_info_p->line;
+  options.start_column = lazy_info_p->column;
+
+  uint32_t parse_opts = ECMA_PARSE_NO_OPTS;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE)
+  {
+    parse_opts |= ECMA_PARSE_STRICT_MODE;
+  }
+
+#if JERRY_ESNEXT
+  parse_opts |= ECMA_PARSE_ALLOW_NEW_TARGET;
+#endif /* JERRY_ESNEXT */
+
+#if JERRY_BUILTIN_REALMS
+  ecma_global_object_t *saved_global_object_p = JERRY_CONTEXT (global_object_p);
+  JERRY_CONTEXT (global_object_p) = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_global_object_t, args_p->realm_value);
+#endif /* JERRY_BUILTIN_REALMS */
+
+  uint32_t argument_list_size = lazy_info_p->argument_list_size;
+  ecma_compiled_code_t *compiled_code_p;
+
+#if JERRY_RESOURCE_NAME
+  ecma_string_t *resource_name_p = ecma_get_string_from_value (literal_pool_p[const_literal_end - 1]);
+
+  ECMA_STRING_TO_UTF8_STRING (resource_name_p, resource_name_chars_p, resource_name_size);
+
+  options.options |= JERRY_PARSE_HAS_RESOURCE;
+  options.resource_name_p = resource_name_chars_p;
+  options.resource_name_length = resource_name_size;
+#endif /* JERRY_RESOURCE_NAME */
+
+  compiled_code_p = parser_parse_source (source_p,
+                                         argument_list_size,
+                                         source_p + argument_list_size,
+                                         lazy_info_p->source_size - argument_list_size,
+                                         parse_opts,
+                                         &options);
+
+#if JERRY_RESOURCE_NAME
+  ECMA_FINALIZE_UTF8_STRING (resource_name_chars_p, resource_name_size);
+#endif /* JERRY_RESOURCE_NAME */
+
+#if JERRY_BUILTIN_REALMS
+  JERRY_CONTEXT (global_object_p) = saved_global_object_p;
+#endif /* JERRY_BUILTIN_REALMS */
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    /* Exception has already thrown. */
+    return NULL;
+  }
+
+#if JERRY_ESNEXT
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = *ecma_compiled_code_resolve_function_name (bytecode_p);
+#endif /* JERRY_ESNEXT */
+
+  /* The reference of the compiled body is owned by the lazy compiled code from now on. */
+  ECMA_SET_INTERNAL_VALUE_POINTER (literal_pool_p[const_literal_end], compiled_code_p);
+  args_p->literal_end++;
+
+  jmem_heap_free_block (source_p, lazy_info_p->source_size);
+  return compiled_code_p;
+} /* parser_compile_lazy_function */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #endif /* JERRY_PARSER */
 
 /**
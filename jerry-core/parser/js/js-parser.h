@@ -197,6 +197,10 @@ parser_parse_script (const uint8_t *arg_list_p, size_t arg_list_size,
                      const uint8_t *source_p, size_t source_size,
                      uint32_t parse_opts, const jerry_parse_options_t *options_p);
 
+#if JERRY_LAZY_FUNCTIONS
+ecma_compiled_code_t *parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_ERROR_MESSAGES
 const char *parser_error_to_string (parser_error_t);
 #endif /* JERRY_ERROR_MESSAGES */
@@ -122,6 +122,9 @@ typedef enum
 #if JERRY_MODULE_SYSTEM
   SCAN_STACK_EXPORT_DEFAULT,               /**< scan primary expression after export default */
 #endif /* JERRY_MODULE_SYSTEM */
+#if JERRY_LAZY_FUNCTIONS
+  SCAN_STACK_LOOP_STATEMENT,               /**< statement part of "while" and "for" iterators */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } scan_stack_modes_t;
 
 /**
@@ -136,8 +139,59 @@ typedef enum
 #if JERRY_DEBUGGER
   SCANNER_CONTEXT_DEBUGGER_ENABLED = (1 << 1), /**< debugger is enabled */
 #endif /* JERRY_DEBUGGER */
+#if JERRY_LAZY_FUNCTIONS
+  SCANNER_CONTEXT_SCAN_FAILED = (1 << 2), /**< scanning is aborted by an error */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } scanner_context_flags_t;
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Flags for tracking the constructs which need early error checks.
+ *
+ * Note:
+ *      these flags only need to detect the errors, false positives
+ *      only force the eager compilation of the enclosing functions
+ */
+typedef enum
+{
+  SCANNER_EARLY_ERROR_OPERAND = (1 << 0), /**< the next primary expression is the operand of an operator */
+  SCANNER_EARLY_ERROR_UPDATE = (1 << 1), /**< a prefix increment or decrement is pending */
+  SCANNER_EARLY_ERROR_DELETE = (1 << 2), /**< a strict mode delete is pending */
+  SCANNER_EARLY_ERROR_UNARY = (1 << 3), /**< other unary operator is pending */
+  SCANNER_EARLY_ERROR_SIMPLE = (1 << 4), /**< the current member chain is not an operand of an operator */
+  SCANNER_EARLY_ERROR_LOGICAL = (1 << 5), /**< the expression contains a logical and or logical or operator */
+  SCANNER_EARLY_ERROR_NULLISH = (1 << 6), /**< the expression contains a nullish coalescing operator */
+  SCANNER_EARLY_ERROR_NEW = (1 << 7), /**< the member chain is the constructor of a new expression */
+  SCANNER_EARLY_ERROR_CHAIN = (1 << 8), /**< the last token ends a member chain */
+  SCANNER_EARLY_ERROR_REFERENCE = (1 << 9), /**< the member chain is an identifier or a property reference */
+  SCANNER_EARLY_ERROR_IDENTIFIER = (1 << 10), /**< the member chain is a single identifier */
+  SCANNER_EARLY_ERROR_BINDING = (1 << 11), /**< the last token is an identifier of a destructuring binding */
+  SCANNER_EARLY_ERROR_REST = (1 << 12), /**< the binding identifier is a rest element */
+  SCANNER_EARLY_ERROR_SUBSTATEMENT = (1 << 13), /**< the next statement is the body of an if, with or
+                                                 *   iteration statement */
+} scanner_early_error_flags_t;
+
+/**
+ * Early error flags which are saved when a bracketed expression is started.
+ */
+#define SCANNER_EARLY_ERROR_SAVED_FLAGS \
+  (SCANNER_EARLY_ERROR_UPDATE | SCANNER_EARLY_ERROR_DELETE | SCANNER_EARLY_ERROR_UNARY | SCANNER_EARLY_ERROR_SIMPLE \
+   | SCANNER_EARLY_ERROR_LOGICAL | SCANNER_EARLY_ERROR_NULLISH | SCANNER_EARLY_ERROR_NEW)
+
+/**
+ * Early error flags which describe the current member chain.
+ */
+#define SCANNER_EARLY_ERROR_CHAIN_FLAGS \
+  (SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_REFERENCE | SCANNER_EARLY_ERROR_IDENTIFIER)
+
+/**
+ * Maximum number of nested brackets whose early error flags are saved.
+ */
+#define SCANNER_EARLY_ERROR_MAX_DEPTH 9
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Checks whether the stack top is a for statement start.
  */
@@ -306,6 +360,10 @@ typedef enum
 #if JERRY_MODULE_SYSTEM
   SCANNER_LITERAL_POOL_IN_EXPORT = (1 << 14), /**< the declared variables are exported by the module system */
 #endif /* JERRY_MODULE_SYSTEM */
+#if JERRY_LAZY_FUNCTIONS
+  SCANNER_LITERAL_POOL_PARSE_EAGERLY = (1 << 15), /**< the code may contain early errors, so the functions
+                                                   *   enclosing it must not be compiled lazily */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } scanner_literal_pool_flags_t;
 
 /**
@@ -359,6 +417,11 @@ typedef struct scanner_literal_pool_t
   parser_list_t literal_pool; /**< list of literal */
   uint16_t status_flags; /**< combination of scanner_literal_pool_flags_t flags */
   uint16_t no_declarations; /**< size of scope stack required during parsing */
+#if JERRY_LAZY_FUNCTIONS
+  uint16_t early_error_flags; /**< early error flags of the enclosing code */
+  uint32_t loop_depth; /**< loop depth of the enclosing code */
+  uint32_t switch_depth; /**< switch depth of the enclosing code */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } scanner_literal_pool_t;
 
 /**
@@ -381,6 +444,13 @@ struct scanner_context_t
 #if JERRY_ESNEXT
   const uint8_t *async_source_p; /**< source position for async functions */
 #endif /* JERRY_ESNEXT */
+#if JERRY_LAZY_FUNCTIONS
+  uint64_t early_error_stack; /**< saved early error flags of the enclosing brackets */
+  uint32_t early_error_depth; /**< number of enclosing brackets */
+  uint32_t loop_depth; /**< number of iteration statements enclosing the current statement */
+  uint32_t switch_depth; /**< number of switch statements enclosing the current statement */
+  uint16_t early_error_flags; /**< combination of scanner_early_error_flags_t flags */
+#endif /* JERRY_LAZY_FUNCTIONS */
 };
 
 /* Scanner utils. */
@@ -415,6 +485,16 @@ void scanner_detect_invalid_var (parser_context_t *context_p, scanner_context_t
 void scanner_detect_invalid_let (parser_context_t *context_p, lexer_lit_location_t *let_literal_p);
 #endif /* JERRY_ESNEXT */
 void scanner_detect_eval_call (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+#if JERRY_LAZY_FUNCTIONS
+void scanner_parse_eagerly (scanner_context_t *scanner_context_p);
+void scanner_early_error_push (scanner_context_t *scanner_context_p);
+void scanner_early_error_pop (scanner_context_t *scanner_context_p, uint16_t chain_flags);
+void scanner_early_error_primary (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+void scanner_early_error_unary (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+void scanner_early_error_continue_chain (scanner_context_t *scanner_context_p);
+void scanner_early_error_end_chain (parser_context_t *context_p, scanner_context_t *scanner_context_p,
+                                    scan_stack_modes_t stack_top);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
 #if JERRY_ESNEXT
 lexer_lit_location_t *scanner_push_class_declaration (parser_context_t *context_p,
@@ -68,6 +68,10 @@ scanner_check_arrow_body (parser_context_t *context_p, /**< context */
 
   scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_ARROW;
 
+#if JERRY_LAZY_FUNCTIONS
+  scanner_context_p->early_error_flags = 0;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (context_p->token.type != LEXER_LEFT_BRACE)
   {
     scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
@@ -99,6 +103,15 @@ scanner_check_arrow (parser_context_t *context_p, /**< context */
       scanner_add_async_literal (context_p, scanner_context_p);
     }
 
+#if JERRY_LAZY_FUNCTIONS
+    /* Rest elements and destructuring patterns are only verified as arrow function arguments,
+     * e.g. the shorthand initializer of ({a = 1}) is an early error of an object literal. */
+    if (scanner_context_p->active_literal_pool_p->status_flags & SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT)
+    {
+      scanner_parse_eagerly (scanner_context_p);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
     scanner_pop_literal_pool (context_p, scanner_context_p);
     return;
@@ -181,8 +194,16 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
 
   scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
 
+#if JERRY_LAZY_FUNCTIONS
+  bool is_rest = false;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (context_p->token.type == LEXER_THREE_DOTS)
   {
+#if JERRY_LAZY_FUNCTIONS
+    is_rest = true;
+    scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
     lexer_next_token (context_p);
   }
 
@@ -214,6 +235,14 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
 
       lexer_next_token (context_p);
 
+#if JERRY_LAZY_FUNCTIONS
+      /* The rest parameter must be the last one. */
+      if (is_rest && context_p->token.type != LEXER_RIGHT_PAREN)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       if (context_p->token.type == LEXER_COMMA || context_p->token.type == LEXER_RIGHT_PAREN)
       {
         return;
@@ -240,6 +269,14 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
     case LEXER_LEFT_SQUARE:
     case LEXER_LEFT_BRACE:
     {
+#if JERRY_LAZY_FUNCTIONS
+      if (is_rest)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+
+      scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_append_hole (context_p, scanner_context_p);
       scanner_push_destructuring_pattern (context_p, scanner_context_p, SCANNER_BINDING_ARROW_ARG, false);
 
@@ -260,6 +297,13 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
     }
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  if (scanner_context_p->active_literal_pool_p->status_flags & SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT)
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   scanner_pop_literal_pool (context_p, scanner_context_p);
   parser_stack_pop_uint8 (context_p);
 
@@ -269,6 +313,9 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
   }
 
   parser_stack_push_uint8 (context_p, SCAN_STACK_PAREN_EXPRESSION);
+#if JERRY_LAZY_FUNCTIONS
+  scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
   if (process_arrow)
   {
@@ -347,8 +394,22 @@ scanner_check_function_after_if (parser_context_t *context_p, /**< context */
   lexer_next_token (context_p);
   scanner_context_p->mode = SCAN_MODE_STATEMENT;
 
+#if JERRY_LAZY_FUNCTIONS
+  scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (JERRY_UNLIKELY (context_p->token.type == LEXER_KEYW_FUNCTION))
   {
+#if JERRY_LAZY_FUNCTIONS
+    /* Function declarations are only allowed after if statements in non-strict mode. */
+    scanner_context_p->early_error_flags = 0;
+
+    if (context_p->status_flags & PARSER_IS_STRICT)
+    {
+      scanner_parse_eagerly (scanner_context_p);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     scanner_literal_pool_t *literal_pool_p;
     literal_pool_p = scanner_push_literal_pool (context_p, scanner_context_p, 0);
 
@@ -507,6 +568,9 @@ scanner_scan_bracket (parser_context_t *context_p, /**< context */
   while (depth > 0)
   {
     parser_stack_push_uint8 (context_p, SCAN_STACK_PAREN_EXPRESSION);
+#if JERRY_LAZY_FUNCTIONS
+    scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
     depth--;
   }
 
@@ -599,6 +663,14 @@ scanner_check_directives (parser_context_t *context_p, /**< context */
     if (is_use_strict)
     {
       scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_IS_STRICT;
+
+#if JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT
+      /* Functions with complex arguments cannot contain a use strict directive. */
+      if (scanner_context_p->active_literal_pool_p->status_flags & SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT */
     }
 
     if (context_p->token.type == LEXER_SEMICOLON)
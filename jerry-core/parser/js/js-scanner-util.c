@@ -528,6 +528,19 @@ scanner_push_literal_pool (parser_context_t *context_p, /**< context */
   literal_pool_p->status_flags = status_flags;
   literal_pool_p->no_declarations = 0;
 
+#if JERRY_LAZY_FUNCTIONS
+  literal_pool_p->early_error_flags = (uint16_t) (scanner_context_p->early_error_flags & ~SCANNER_EARLY_ERROR_CHAIN_FLAGS);
+  literal_pool_p->loop_depth = scanner_context_p->loop_depth;
+  literal_pool_p->switch_depth = scanner_context_p->switch_depth;
+
+  if (status_flags & SCANNER_LITERAL_POOL_FUNCTION)
+  {
+    /* Break and continue statements cannot cross function boundaries. */
+    scanner_context_p->loop_depth = 0;
+    scanner_context_p->switch_depth = 0;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   literal_pool_p->prev_p = prev_literal_pool_p;
   scanner_context_p->active_literal_pool_p = literal_pool_p;
 
@@ -576,12 +589,28 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
   }
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_LAZY_FUNCTIONS
+  if (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_FUNCTION)
+  {
+    scanner_context_p->early_error_flags = literal_pool_p->early_error_flags;
+    scanner_context_p->loop_depth = literal_pool_p->loop_depth;
+    scanner_context_p->switch_depth = literal_pool_p->switch_depth;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (JERRY_UNLIKELY (literal_pool_p->source_p == NULL))
   {
     JERRY_ASSERT (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_FUNCTION);
     JERRY_ASSERT (literal_pool_p->literal_pool.data.first_p == NULL
                   && literal_pool_p->literal_pool.data.last_p == NULL);
 
+#if JERRY_LAZY_FUNCTIONS
+    if (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_PARSE_EAGERLY)
+    {
+      prev_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_PARSE_EAGERLY;
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     scanner_context_p->active_literal_pool_p = literal_pool_p->prev_p;
     scanner_free (literal_pool_p, sizeof (scanner_literal_pool_t));
     return;
@@ -649,6 +678,23 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
   {
     uint8_t type = literal_p->type;
 
+#if JERRY_LAZY_FUNCTIONS
+    const uint8_t declaration_types = (SCANNER_LITERAL_IS_ARG
+                                       | SCANNER_LITERAL_IS_VAR
+                                       | SCANNER_LITERAL_IS_FUNC
+                                       | SCANNER_LITERAL_IS_LET
+                                       | SCANNER_LITERAL_IS_CONST);
+
+    /* Declaring eval or arguments is an early error in strict mode. */
+    if ((status_flags & SCANNER_LITERAL_POOL_IS_STRICT)
+        && (type & declaration_types)
+        && (scanner_literal_is_arguments (literal_p)
+            || lexer_compare_identifier_to_string (literal_p, (const uint8_t *) "eval", 4)))
+    {
+      status_flags |= SCANNER_LITERAL_POOL_PARSE_EAGERLY;
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     if (JERRY_UNLIKELY (no_declarations > PARSER_MAXIMUM_DEPTH_OF_SCOPE_STACK))
     {
       continue;
@@ -910,7 +956,14 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
       compressed_size++;
     }
 
-    compressed_size += sizeof (scanner_info_t);
+    size_t header_size = sizeof (scanner_info_t);
+
+    if (status_flags & SCANNER_LITERAL_POOL_FUNCTION)
+    {
+      header_size = SCANNER_FUNCTION_INFO_SIZE;
+    }
+
+    compressed_size += header_size;
 
     scanner_info_t *info_p;
 
@@ -929,13 +982,28 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
       no_declarations = PARSER_MAXIMUM_DEPTH_OF_SCOPE_STACK;
     }
 
-    uint8_t *data_p = (uint8_t *) (info_p + 1);
+    uint8_t *data_p = ((uint8_t *) info_p) + header_size;
     bool mapped_arguments = false;
 
     if (status_flags & SCANNER_LITERAL_POOL_FUNCTION)
     {
       info_p->type = SCANNER_TYPE_FUNCTION;
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_function_info_t *function_info_p = (scanner_function_info_t *) info_p;
+      function_info_p->end_location.source_p = NULL;
+
+      /* The end of the body is only known when the closing brace is reached without errors.
+       * Functions whose code may contain early errors which are not detected by the
+       * scanner are always parsed, since these errors must be reported immediately. */
+      if (context_p->token.type == LEXER_RIGHT_BRACE
+          && !(scanner_context_p->status_flags & SCANNER_CONTEXT_SCAN_FAILED)
+          && !(status_flags & SCANNER_LITERAL_POOL_PARSE_EAGERLY))
+      {
+        scanner_get_location (&function_info_p->end_location, context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       uint8_t u8_arg = 0;
 
       if (arguments_type != SCANNER_ARGUMENTS_NOT_PRESENT)
@@ -1205,6 +1273,13 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
 #endif /* JERRY_ESNEXT */
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  if ((status_flags & SCANNER_LITERAL_POOL_PARSE_EAGERLY) && prev_literal_pool_p != NULL)
+  {
+    prev_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_PARSE_EAGERLY;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   scanner_context_p->active_literal_pool_p = literal_pool_p->prev_p;
 
   parser_list_free (&literal_pool_p->literal_pool);
@@ -1531,6 +1606,10 @@ scanner_append_argument (parser_context_t *context_p, /**< context */
   {
     literal_p->length = 0;
 
+#if JERRY_LAZY_FUNCTIONS
+    literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_PARSE_EAGERLY;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_ESNEXT
     if (literal_p->type & SCANNER_LITERAL_IS_USED)
     {
@@ -1567,6 +1646,322 @@ scanner_detect_eval_call (parser_context_t *context_p, /**< context */
   }
 } /* scanner_detect_eval_call */
 
+#if JERRY_LAZY_FUNCTIONS
+
+JERRY_STATIC_ASSERT (SCANNER_EARLY_ERROR_SAVED_FLAGS == (0x7f << 1),
+                     scanner_early_error_saved_flags_must_be_the_seven_bits_after_the_first_bit);
+
+/**
+ * Number of bits used by the saved early error flags of a bracketed expression.
+ */
+#define SCANNER_EARLY_ERROR_SAVED_BITS 7
+
+/**
+ * Force the parsing of the functions enclosing the current code when they are created,
+ * since the code might contain early errors which are not detected by the scanner.
+ */
+void
+scanner_parse_eagerly (scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_PARSE_EAGERLY;
+} /* scanner_parse_eagerly */
+
+/**
+ * Save the early error flags when a bracketed expression is started.
+ */
+void
+scanner_early_error_push (scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+
+  if (scanner_context_p->early_error_depth < SCANNER_EARLY_ERROR_MAX_DEPTH)
+  {
+    uint64_t saved_flags = (uint64_t) ((flags & SCANNER_EARLY_ERROR_SAVED_FLAGS) >> 1);
+
+    scanner_context_p->early_error_stack <<= SCANNER_EARLY_ERROR_SAVED_BITS;
+    scanner_context_p->early_error_stack |= saved_flags;
+  }
+  else
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+
+  scanner_context_p->early_error_depth++;
+
+  flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_OPERAND
+                        | SCANNER_EARLY_ERROR_SAVED_FLAGS
+                        | SCANNER_EARLY_ERROR_CHAIN_FLAGS
+                        | SCANNER_EARLY_ERROR_BINDING);
+  scanner_context_p->early_error_flags = flags;
+} /* scanner_early_error_push */
+
+/**
+ * Restore the early error flags when a bracketed expression is ended.
+ */
+void
+scanner_early_error_pop (scanner_context_t *scanner_context_p, /**< scanner context */
+                         uint16_t chain_flags) /**< chain flags of the bracketed expression */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+
+  flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_OPERAND
+                        | SCANNER_EARLY_ERROR_SAVED_FLAGS
+                        | SCANNER_EARLY_ERROR_CHAIN_FLAGS
+                        | SCANNER_EARLY_ERROR_BINDING);
+
+  JERRY_ASSERT (scanner_context_p->early_error_depth > 0);
+  scanner_context_p->early_error_depth--;
+
+  if (scanner_context_p->early_error_depth < SCANNER_EARLY_ERROR_MAX_DEPTH)
+  {
+    uint64_t saved_flags = scanner_context_p->early_error_stack & ((1 << SCANNER_EARLY_ERROR_SAVED_BITS) - 1);
+
+    flags |= (uint16_t) (saved_flags << 1);
+    scanner_context_p->early_error_stack >>= SCANNER_EARLY_ERROR_SAVED_BITS;
+  }
+
+  /* The constructor of a new expression is not a reference. */
+  if (flags & SCANNER_EARLY_ERROR_NEW)
+  {
+    chain_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_REFERENCE;
+  }
+
+  scanner_context_p->early_error_flags = (uint16_t) (flags | chain_flags);
+} /* scanner_early_error_pop */
+
+/**
+ * Update the early error flags before a primary expression is scanned.
+ */
+void
+scanner_early_error_primary (parser_context_t *context_p, /**< context */
+                             scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+  lexer_token_type_t type = (lexer_token_type_t) context_p->token.type;
+  bool is_identifier = (type == LEXER_LITERAL && context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
+
+  /* The operand of a prefix update can only be a reference. Other unary
+   * operators are lost when an array or object literal is scanned. */
+  if (((flags & SCANNER_EARLY_ERROR_UPDATE)
+       && !is_identifier
+       && type != LEXER_KEYW_THIS
+       && type != LEXER_LEFT_PAREN)
+      || ((flags & SCANNER_EARLY_ERROR_UNARY) && (type == LEXER_LEFT_SQUARE || type == LEXER_LEFT_BRACE)))
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+
+  uint16_t new_flags = SCANNER_EARLY_ERROR_SIMPLE;
+
+  if (flags & SCANNER_EARLY_ERROR_OPERAND)
+  {
+    new_flags = 0;
+  }
+
+  if (is_identifier)
+  {
+    new_flags |= SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_IDENTIFIER;
+
+    if (!(flags & SCANNER_EARLY_ERROR_NEW)
+        && (!(context_p->status_flags & PARSER_IS_STRICT)
+            || (context_p->token.keyword_type != LEXER_KEYW_EVAL
+                && context_p->token.keyword_type != LEXER_KEYW_ARGUMENTS)))
+    {
+      new_flags |= SCANNER_EARLY_ERROR_REFERENCE;
+    }
+  }
+  else if (type == LEXER_KEYW_THIS)
+  {
+    new_flags |= SCANNER_EARLY_ERROR_CHAIN;
+  }
+
+  flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_SIMPLE
+                        | SCANNER_EARLY_ERROR_CHAIN_FLAGS
+                        | SCANNER_EARLY_ERROR_BINDING
+                        | SCANNER_EARLY_ERROR_REST);
+
+  /* The bracket might be consumed by the scanner, and the enclosed
+   * identifier is processed as the primary expression instead. */
+  if (type != LEXER_LEFT_PAREN)
+  {
+    flags &= (uint16_t) ~SCANNER_EARLY_ERROR_OPERAND;
+  }
+
+  scanner_context_p->early_error_flags = (uint16_t) (flags | new_flags);
+} /* scanner_early_error_primary */
+
+/**
+ * Update the early error flags after a unary operator.
+ */
+void
+scanner_early_error_unary (parser_context_t *context_p, /**< context */
+                           scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+
+  /* The operand of a prefix update cannot be a unary expression. */
+  if (flags & SCANNER_EARLY_ERROR_UPDATE)
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+
+  switch (context_p->token.type)
+  {
+    case LEXER_INCREASE:
+    case LEXER_DECREASE:
+    {
+      flags |= SCANNER_EARLY_ERROR_UPDATE;
+      break;
+    }
+    case LEXER_KEYW_DELETE:
+    {
+      if (context_p->status_flags & PARSER_IS_STRICT)
+      {
+        flags |= SCANNER_EARLY_ERROR_DELETE;
+      }
+      /* FALLTHRU */
+    }
+    default:
+    {
+      flags |= SCANNER_EARLY_ERROR_UNARY;
+      break;
+    }
+  }
+
+  scanner_context_p->early_error_flags = (uint16_t) (flags | SCANNER_EARLY_ERROR_OPERAND);
+} /* scanner_early_error_unary */
+
+/**
+ * Update the early error flags when a member chain is continued by
+ * a property access, a function call or a tagged template.
+ */
+void
+scanner_early_error_continue_chain (scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+
+  if (flags & SCANNER_EARLY_ERROR_BINDING)
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+
+  if (!(flags & SCANNER_EARLY_ERROR_CHAIN))
+  {
+    /* The start of the chain is unknown. */
+    flags &= (uint16_t) ~SCANNER_EARLY_ERROR_SIMPLE;
+  }
+
+  flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_IDENTIFIER | SCANNER_EARLY_ERROR_BINDING);
+  flags |= SCANNER_EARLY_ERROR_CHAIN;
+
+  /* The constructor of a new expression is not a reference. */
+  if (!(flags & SCANNER_EARLY_ERROR_NEW))
+  {
+    flags |= SCANNER_EARLY_ERROR_REFERENCE;
+  }
+
+  scanner_context_p->early_error_flags = flags;
+} /* scanner_early_error_continue_chain */
+
+/**
+ * Check the early errors when a member chain is ended by the current token.
+ */
+void
+scanner_early_error_end_chain (parser_context_t *context_p, /**< context */
+                               scanner_context_t *scanner_context_p, /**< scanner context */
+                               scan_stack_modes_t stack_top) /**< current stack top */
+{
+  uint16_t flags = scanner_context_p->early_error_flags;
+  lexer_token_type_t type = (lexer_token_type_t) context_p->token.type;
+  bool is_error = false;
+
+  if ((flags & SCANNER_EARLY_ERROR_UPDATE)
+      && (flags & (SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_REFERENCE)) != (SCANNER_EARLY_ERROR_CHAIN
+                                                                                  | SCANNER_EARLY_ERROR_REFERENCE))
+  {
+    is_error = true;
+  }
+
+  if ((flags & SCANNER_EARLY_ERROR_DELETE)
+      && (flags & (SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_IDENTIFIER)) == (SCANNER_EARLY_ERROR_CHAIN
+                                                                                   | SCANNER_EARLY_ERROR_IDENTIFIER))
+  {
+    is_error = true;
+  }
+
+  /* These flags are kept until the end of the statement or the enclosing bracket. */
+  uint16_t new_flags = (uint16_t) (flags & (SCANNER_EARLY_ERROR_LOGICAL | SCANNER_EARLY_ERROR_NULLISH));
+
+  if (flags & SCANNER_EARLY_ERROR_BINDING)
+  {
+    /* Only the end of the binding element or its initializer can follow a binding identifier. */
+    if (type != LEXER_RIGHT_SQUARE
+        && type != LEXER_RIGHT_BRACE
+        && ((flags & SCANNER_EARLY_ERROR_REST) || (type != LEXER_COMMA && type != LEXER_ASSIGN)))
+    {
+      is_error = true;
+    }
+  }
+  else if (LEXER_IS_BINARY_LVALUE_OP_TOKEN (type)
+           || (stack_top == SCAN_STACK_FOR_START && (type == LEXER_KEYW_IN || lexer_token_is_identifier (context_p, "of", 2))))
+  {
+    const uint16_t reference_flags = (SCANNER_EARLY_ERROR_SIMPLE
+                                      | SCANNER_EARLY_ERROR_CHAIN
+                                      | SCANNER_EARLY_ERROR_REFERENCE);
+
+    if ((flags & (reference_flags | SCANNER_EARLY_ERROR_UPDATE | SCANNER_EARLY_ERROR_DELETE)) != reference_flags)
+    {
+      is_error = true;
+    }
+  }
+  else if (type == LEXER_LOGICAL_OR || type == LEXER_LOGICAL_AND)
+  {
+#if JERRY_ESNEXT
+    /* Nullish coalescing cannot be mixed with logical and / or operators without parentheses. */
+    if (flags & SCANNER_EARLY_ERROR_NULLISH)
+    {
+      is_error = true;
+    }
+#endif /* JERRY_ESNEXT */
+
+    new_flags |= SCANNER_EARLY_ERROR_LOGICAL | SCANNER_EARLY_ERROR_OPERAND;
+  }
+#if JERRY_ESNEXT
+  else if (type == LEXER_NULLISH_COALESCING)
+  {
+    if (flags & SCANNER_EARLY_ERROR_LOGICAL)
+    {
+      is_error = true;
+    }
+
+    new_flags |= SCANNER_EARLY_ERROR_NULLISH | SCANNER_EARLY_ERROR_OPERAND;
+  }
+  else if (type == LEXER_EXPONENTIATION)
+  {
+    /* The left operand of an exponentiation cannot be a unary expression. */
+    if (flags & SCANNER_EARLY_ERROR_UNARY)
+    {
+      is_error = true;
+    }
+
+    new_flags |= SCANNER_EARLY_ERROR_OPERAND;
+  }
+#endif /* JERRY_ESNEXT */
+  else if (LEXER_IS_BINARY_NON_LVALUE_OP_TOKEN (type) && type != LEXER_QUESTION_MARK)
+  {
+    new_flags |= SCANNER_EARLY_ERROR_OPERAND;
+  }
+
+  if (is_error)
+  {
+    scanner_parse_eagerly (scanner_context_p);
+  }
+
+  scanner_context_p->early_error_flags = new_flags;
+} /* scanner_early_error_end_chain */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_ESNEXT
 
 /**
@@ -1895,6 +2290,71 @@ scanner_reverse_info_list (parser_context_t *context_p) /**< context */
   context_p->next_scanner_info_p = last_scanner_info_p;
 } /* scanner_reverse_info_list */
 
+/**
+ * Free a scanner info block.
+ */
+static void
+scanner_free_info (scanner_info_t *scanner_info_p) /**< scanner info block */
+{
+  size_t size = sizeof (scanner_info_t);
+
+  switch (scanner_info_p->type)
+  {
+    case SCANNER_TYPE_FUNCTION:
+    {
+      size = scanner_get_stream_size (scanner_info_p, SCANNER_FUNCTION_INFO_SIZE);
+      break;
+    }
+    case SCANNER_TYPE_BLOCK:
+    {
+      size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
+      break;
+    }
+    case SCANNER_TYPE_WHILE:
+    case SCANNER_TYPE_FOR_IN:
+#if JERRY_ESNEXT
+    case SCANNER_TYPE_FOR_OF:
+#endif /* JERRY_ESNEXT */
+    case SCANNER_TYPE_CASE:
+#if JERRY_ESNEXT
+    case SCANNER_TYPE_INITIALIZER:
+    case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+#endif /* JERRY_ESNEXT */
+    {
+      size = sizeof (scanner_location_info_t);
+      break;
+    }
+    case SCANNER_TYPE_FOR:
+    {
+      size = sizeof (scanner_for_info_t);
+      break;
+    }
+    case SCANNER_TYPE_SWITCH:
+    {
+      scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
+      size = sizeof (scanner_switch_info_t);
+      break;
+    }
+    default:
+    {
+#if JERRY_ESNEXT
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
+                    || scanner_info_p->type == SCANNER_TYPE_LITERAL_FLAGS
+                    || scanner_info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
+                    || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION
+                    || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
+                    || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
+                    || scanner_info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
+#else /* !JERRY_ESNEXT */
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
+#endif /* JERRY_ESNEXT */
+      break;
+    }
+  }
+
+  scanner_free (scanner_info_p, size);
+} /* scanner_free_info */
+
 /**
  * Release unused scanner info blocks.
  * This should happen only if an error is occured.
@@ -1915,64 +2375,13 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   {
     scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
 
-    size_t size = sizeof (scanner_info_t);
-
-    switch (scanner_info_p->type)
+    if (scanner_info_p->type == SCANNER_TYPE_END)
     {
-      case SCANNER_TYPE_END:
-      {
-        scanner_info_p = context_p->active_scanner_info_p;
-        continue;
-      }
-      case SCANNER_TYPE_FUNCTION:
-      case SCANNER_TYPE_BLOCK:
-      {
-        size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
-        break;
-      }
-      case SCANNER_TYPE_WHILE:
-      case SCANNER_TYPE_FOR_IN:
-#if JERRY_ESNEXT
-      case SCANNER_TYPE_FOR_OF:
-#endif /* JERRY_ESNEXT */
-      case SCANNER_TYPE_CASE:
-#if JERRY_ESNEXT
-      case SCANNER_TYPE_INITIALIZER:
-      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
-#endif /* JERRY_ESNEXT */
-      {
-        size = sizeof (scanner_location_info_t);
-        break;
-      }
-      case SCANNER_TYPE_FOR:
-      {
-        size = sizeof (scanner_for_info_t);
-        break;
-      }
-      case SCANNER_TYPE_SWITCH:
-      {
-        scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
-        size = sizeof (scanner_switch_info_t);
-        break;
-      }
-      default:
-      {
-#if JERRY_ESNEXT
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
-                      || scanner_info_p->type == SCANNER_TYPE_LITERAL_FLAGS
-                      || scanner_info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
-                      || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
-                      || scanner_info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
-#else /* !JERRY_ESNEXT */
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
-#endif /* JERRY_ESNEXT */
-        break;
-      }
+      scanner_info_p = context_p->active_scanner_info_p;
+      continue;
     }
 
-    scanner_free (scanner_info_p, size);
+    scanner_free_info (scanner_info_p);
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -1980,6 +2389,31 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Release the scanner info blocks which precede a given source position.
+ * Used when the body of a function is skipped by the parser.
+ */
+void
+scanner_release_until (parser_context_t *context_p, /**< context */
+                       const uint8_t *source_end_p) /**< end position */
+{
+  scanner_info_t *scanner_info_p = context_p->next_scanner_info_p;
+
+  while (scanner_info_p->source_p != NULL && scanner_info_p->source_p < source_end_p)
+  {
+    scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
+
+    scanner_free_info (scanner_info_p);
+    scanner_info_p = next_scanner_info_p;
+  }
+
+  context_p->next_scanner_info_p = scanner_info_p;
+} /* scanner_release_until */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Checks whether a context needs to be created for a block.
  *
@@ -1991,7 +2425,7 @@ scanner_is_context_needed (parser_context_t *context_p, /**< context */
                            parser_check_context_type_t check_type) /**< context type */
 {
   scanner_info_t *info_p = context_p->next_scanner_info_p;
-  const uint8_t *data_p = (const uint8_t *) (info_p + 1);
+  const uint8_t *data_p = SCANNER_INFO_GET_STREAM (info_p);
 
   JERRY_UNUSED (check_type);
 
@@ -2234,7 +2668,7 @@ void
 scanner_check_variables (parser_context_t *context_p) /**< context */
 {
   scanner_info_t *info_p = context_p->next_scanner_info_p;
-  const uint8_t *next_data_p = (const uint8_t *) (info_p + 1);
+  const uint8_t *next_data_p = ((const uint8_t *) info_p) + SCANNER_FUNCTION_INFO_SIZE;
   lexer_lit_location_t literal;
 
   JERRY_ASSERT (info_p->type == SCANNER_TYPE_FUNCTION);
@@ -2318,7 +2752,7 @@ scanner_create_variables (parser_context_t *context_p, /**< context */
                           uint32_t option_flags) /**< combination of scanner_create_variables_flags_t bits */
 {
   scanner_info_t *info_p = context_p->next_scanner_info_p;
-  const uint8_t *next_data_p = (const uint8_t *) (info_p + 1);
+  const uint8_t *next_data_p = SCANNER_INFO_GET_STREAM (info_p);
   uint8_t info_type = info_p->type;
   uint8_t info_u8_arg = info_p->u8_arg;
   lexer_lit_location_t literal;
@@ -77,6 +77,10 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
                                  lexer_token_type_t type, /**< current token type */
                                  scan_stack_modes_t stack_top) /**< current stack top */
 {
+#if JERRY_LAZY_FUNCTIONS
+  scanner_early_error_primary (context_p, scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   switch (type)
   {
     case LEXER_KEYW_NEW:
@@ -89,11 +93,22 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
         scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       }
 #endif /* JERRY_ESNEXT */
+
+#if JERRY_LAZY_FUNCTIONS
+      if (scanner_context_p->mode == SCAN_MODE_PRIMARY_EXPRESSION_AFTER_NEW)
+      {
+        scanner_context_p->early_error_flags |= SCANNER_EARLY_ERROR_NEW;
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
       break;
     }
     case LEXER_DIVIDE:
     case LEXER_ASSIGN_DIVIDE:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* The pattern and the flags of regular expressions are only checked by the parser. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       lexer_construct_regexp_object (context_p, true);
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       break;
@@ -136,6 +151,13 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
           location_p->type |= SCANNER_LITERAL_IS_FUNC | SCANNER_LITERAL_IS_LET;
         }
 #endif /* JERRY_MODULE_SYSTEM */
+
+#if JERRY_LAZY_FUNCTIONS
+        if (context_p->token.keyword_type == LEXER_KEYW_EVAL || context_p->token.keyword_type == LEXER_KEYW_ARGUMENTS)
+        {
+          scanner_parse_eagerly (scanner_context_p);
+        }
+#endif /* JERRY_LAZY_FUNCTIONS */
         lexer_next_token (context_p);
       }
 #if JERRY_MODULE_SYSTEM
@@ -184,6 +206,9 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
     {
       if (context_p->source_p[-1] != LIT_CHAR_GRAVE_ACCENT)
       {
+#if JERRY_LAZY_FUNCTIONS
+        scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
         parser_stack_push_uint8 (context_p, SCAN_STACK_TEMPLATE_STRING);
         scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
         break;
@@ -241,12 +266,20 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
 #if JERRY_ESNEXT
     case LEXER_KEYW_SUPER:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* The validity of super depends on the enclosing functions. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE;
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       break;
     }
     case LEXER_KEYW_CLASS:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* Class bodies have several early errors which are only checked by the parser. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_push_class_declaration (context_p, scanner_context_p, SCAN_STACK_CLASS_EXPRESSION);
 
       if (context_p->token.type != LEXER_LITERAL || context_p->token.lit_location.type != LEXER_IDENT_LITERAL)
@@ -316,6 +349,9 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
       if (stack_top == SCAN_STACK_PAREN_EXPRESSION)
       {
         parser_stack_pop_uint8 (context_p);
+#if JERRY_LAZY_FUNCTIONS
+        scanner_early_error_pop (scanner_context_p, SCANNER_EARLY_ERROR_CHAIN);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
 #if JERRY_ESNEXT
         if (context_p->stack_top_uint8 == SCAN_STACK_USE_ASYNC)
@@ -352,6 +388,9 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
   {
     case LEXER_DOT:
     {
+#if JERRY_LAZY_FUNCTIONS
+      scanner_early_error_continue_chain (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       lexer_scan_identifier (context_p);
 
       if (context_p->token.type != LEXER_LITERAL
@@ -364,6 +403,12 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
     }
     case LEXER_LEFT_PAREN:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* The arguments end the constructor of a new expression. */
+      scanner_early_error_continue_chain (scanner_context_p);
+      scanner_context_p->early_error_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_NEW;
+      scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       parser_stack_push_uint8 (context_p, SCAN_STACK_PAREN_EXPRESSION);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -371,8 +416,17 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
 #if JERRY_ESNEXT
     case LEXER_TEMPLATE_LITERAL:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* The result of a tagged template is not a reference. */
+      scanner_early_error_continue_chain (scanner_context_p);
+      scanner_context_p->early_error_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_REFERENCE;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       if (JERRY_UNLIKELY (context_p->source_p[-1] != LIT_CHAR_GRAVE_ACCENT))
       {
+#if JERRY_LAZY_FUNCTIONS
+        scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
         scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
         parser_stack_push_uint8 (context_p, SCAN_STACK_TAGGED_TEMPLATE_LITERAL);
       }
@@ -381,6 +435,10 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
 #endif /* JERRY_ESNEXT */
     case LEXER_LEFT_SQUARE:
     {
+#if JERRY_LAZY_FUNCTIONS
+      scanner_early_error_continue_chain (scanner_context_p);
+      scanner_early_error_push (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       parser_stack_push_uint8 (context_p, SCAN_STACK_PROPERTY_ACCESSOR);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -392,9 +450,25 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
 
       if (context_p->token.flags & LEXER_WAS_NEWLINE)
       {
+#if JERRY_LAZY_FUNCTIONS
+        scanner_early_error_end_chain (context_p, scanner_context_p, stack_top);
+#endif /* JERRY_LAZY_FUNCTIONS */
         return false;
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      const uint16_t reference_flags = SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_REFERENCE;
+      uint16_t flags = scanner_context_p->early_error_flags;
+
+      /* The operand of a postfix update must be a reference. */
+      if ((flags & (reference_flags | SCANNER_EARLY_ERROR_UPDATE | SCANNER_EARLY_ERROR_BINDING)) != reference_flags)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+
+      scanner_context_p->early_error_flags = (uint16_t) (flags & ~SCANNER_EARLY_ERROR_CHAIN_FLAGS);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       lexer_next_token (context_p);
       type = (lexer_token_type_t) context_p->token.type;
 
@@ -406,6 +480,9 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
     }
     case LEXER_QUESTION_MARK:
     {
+#if JERRY_LAZY_FUNCTIONS
+      scanner_early_error_end_chain (context_p, scanner_context_p, stack_top);
+#endif /* JERRY_LAZY_FUNCTIONS */
       parser_stack_push_uint8 (context_p, SCAN_STACK_COLON_EXPRESSION);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -416,6 +493,10 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
     }
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  scanner_early_error_end_chain (context_p, scanner_context_p, stack_top);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (LEXER_IS_BINARY_OP_TOKEN (type)
       && (type != LEXER_KEYW_IN || !SCANNER_IS_FOR_START (stack_top)))
   {
@@ -529,6 +610,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       status_flags |= SCANNER_LITERAL_POOL_IN_WITH;
       scanner_context_p->active_literal_pool_p->status_flags = status_flags;
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -562,6 +646,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_get_location (&location_info_p->location, context_p);
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -573,6 +660,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       }
 
       parser_stack_pop_uint8 (context_p);
+#if JERRY_LAZY_FUNCTIONS
+      scanner_early_error_pop (scanner_context_p, SCANNER_EARLY_ERROR_CHAIN);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
 #if JERRY_ESNEXT
       if (context_p->stack_top_uint8 == SCAN_STACK_USE_ASYNC)
@@ -601,6 +691,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       }
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -793,6 +886,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_get_location (&for_statement.u.for_info_p->end_location, context_p);
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -821,6 +917,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       scanner_switch_statement_t switch_statement = scanner_context_p->active_switch_statement;
       parser_stack_push (context_p, &switch_statement, sizeof (scanner_switch_statement_t));
       parser_stack_push_uint8 (context_p, SCAN_STACK_SWITCH_BLOCK);
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->switch_depth++;
+#endif /* JERRY_LAZY_FUNCTIONS */
 
       scanner_switch_info_t *switch_info_p;
       switch_info_p = (scanner_switch_info_t *) scanner_insert_info (context_p,
@@ -943,6 +1042,10 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
         if (context_p->token.type == LEXER_KEYW_IN || SCANNER_IDENTIFIER_IS_OF ())
         {
+#if JERRY_LAZY_FUNCTIONS
+          /* The assignment targets of destructuring patterns are only checked by the parser. */
+          scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
           scanner_info_t *info_p = scanner_insert_info (context_p, source_start.source_p, sizeof (scanner_info_t));
           info_p->type = SCANNER_TYPE_LITERAL_FLAGS;
           info_p->u8_arg = object_literal_flags | SCANNER_LITERAL_DESTRUCTURING_FOR;
@@ -950,8 +1053,20 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
         }
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_CHAIN_FLAGS;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       if (context_p->token.type != LEXER_ASSIGN)
       {
+#if JERRY_LAZY_FUNCTIONS
+        /* Destructuring declarations must have an initializer. */
+        if (stack_top == SCAN_STACK_VAR || stack_top == SCAN_STACK_LET || stack_top == SCAN_STACK_CONST)
+        {
+          scanner_parse_eagerly (scanner_context_p);
+        }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
         if (SCANNER_NEEDS_BINDING_LIST (binding_type))
         {
           scanner_pop_binding_list (scanner_context_p);
@@ -989,6 +1104,14 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       scanner_get_location (&location_info_p->location, context_p);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
 
+#if JERRY_LAZY_FUNCTIONS
+      if (binding_type == SCANNER_BINDING_NONE)
+      {
+        /* The assignment targets of destructuring patterns are only checked by the parser. */
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       if (SCANNER_NEEDS_BINDING_LIST (binding_type))
       {
         scanner_binding_item_t *item_p = scanner_context_p->active_binding_list_p->items_p;
@@ -1011,6 +1134,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
         break;
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->early_error_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_CHAIN_FLAGS;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       parser_stack_pop_uint8 (context_p);
       return SCAN_NEXT_TOKEN;
@@ -1024,6 +1150,17 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
         break;
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      if (stack_top == SCAN_STACK_PROPERTY_ACCESSOR)
+      {
+        scanner_early_error_pop (scanner_context_p, SCANNER_EARLY_ERROR_CHAIN | SCANNER_EARLY_ERROR_REFERENCE);
+      }
+      else
+      {
+        scanner_context_p->early_error_flags &= (uint16_t) ~SCANNER_EARLY_ERROR_CHAIN_FLAGS;
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       parser_stack_pop_uint8 (context_p);
       return SCAN_NEXT_TOKEN;
@@ -1141,6 +1278,11 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       {
         parser_stack_pop_uint8 (context_p);
         scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
+
+#if JERRY_LAZY_FUNCTIONS
+        scanner_early_error_pop (scanner_context_p,
+                                 (stack_top == SCAN_STACK_TAGGED_TEMPLATE_LITERAL) ? SCANNER_EARLY_ERROR_CHAIN : 0);
+#endif /* JERRY_LAZY_FUNCTIONS */
       }
       return SCAN_NEXT_TOKEN;
     }
@@ -1285,6 +1427,11 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
                         lexer_token_type_t type, /**< current token type */
                         scan_stack_modes_t stack_top) /**< current stack top */
 {
+#if JERRY_LAZY_FUNCTIONS
+  bool is_substatement = (scanner_context_p->early_error_flags & SCANNER_EARLY_ERROR_SUBSTATEMENT) != 0;
+  scanner_context_p->early_error_flags = 0;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   switch (type)
   {
     case LEXER_SEMICOLON:
@@ -1306,6 +1453,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
     }
     case LEXER_KEYW_DO:
     {
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->loop_depth++;
+      scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       parser_stack_push_uint8 (context_p, SCAN_STACK_DO_STATEMENT);
       return SCAN_NEXT_TOKEN;
@@ -1352,6 +1503,12 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
       }
       else if (type == LEXER_KEYW_WITH)
       {
+#if JERRY_LAZY_FUNCTIONS
+        if (context_p->status_flags & PARSER_IS_STRICT)
+        {
+          scanner_parse_eagerly (scanner_context_p);
+        }
+#endif /* JERRY_LAZY_FUNCTIONS */
         mode = SCAN_STACK_WITH_EXPRESSION;
       }
       else if (type == LEXER_KEYW_SWITCH)
@@ -1374,6 +1531,11 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
 
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->loop_depth++;
+      parser_stack_push_uint8 (context_p, SCAN_STACK_LOOP_STATEMENT);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       scanner_source_start_t source_start;
       source_start.source_p = context_p->source_p;
 
@@ -1397,6 +1559,11 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
         scanner_raise_error (context_p);
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context_p->loop_depth++;
+      parser_stack_push_uint8 (context_p, SCAN_STACK_LOOP_STATEMENT);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       scanner_for_statement_t for_statement;
       for_statement.u.source_p = context_p->source_p;
       uint8_t stack_mode = SCAN_STACK_FOR_START;
@@ -1460,6 +1627,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
             scanner_info_t *info_p = scanner_insert_info (context_p, source_p, sizeof (scanner_info_t));
             info_p->type = SCANNER_TYPE_LET_EXPRESSION;
 
+#if JERRY_LAZY_FUNCTIONS
+            /* The let identifier is not registered as a reference. */
+            scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
             scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
             break;
           }
@@ -1500,12 +1671,24 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
 #if JERRY_ESNEXT
     case LEXER_KEYW_LET:
     {
+#if JERRY_LAZY_FUNCTIONS
+      if (is_substatement)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_VAR_STATEMENT;
       parser_stack_push_uint8 (context_p, SCAN_STACK_LET);
       return SCAN_NEXT_TOKEN;
     }
     case LEXER_KEYW_CONST:
     {
+#if JERRY_LAZY_FUNCTIONS
+      if (is_substatement)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_VAR_STATEMENT;
       parser_stack_push_uint8 (context_p, SCAN_STACK_CONST);
       return SCAN_NEXT_TOKEN;
@@ -1542,8 +1725,20 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
           && context_p->token.type == LEXER_LITERAL
           && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
       {
+#if JERRY_LAZY_FUNCTIONS
+        /* Labels are not tracked by the scanner. */
+        scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
         return SCAN_NEXT_TOKEN;
       }
+
+#if JERRY_LAZY_FUNCTIONS
+      if (scanner_context_p->loop_depth == 0
+          && (type == LEXER_KEYW_CONTINUE || scanner_context_p->switch_depth == 0))
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
       return SCAN_KEEP_TOKEN;
     }
     case LEXER_KEYW_CASE:
@@ -1613,6 +1808,15 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
         scanner_raise_error (context_p);
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      if (is_substatement
+          || context_p->token.keyword_type == LEXER_KEYW_EVAL
+          || context_p->token.keyword_type == LEXER_KEYW_ARGUMENTS)
+      {
+        scanner_parse_eagerly (scanner_context_p);
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       lexer_lit_location_t *literal_p = scanner_add_literal (context_p, scanner_context_p);
 
 #if JERRY_ESNEXT
@@ -1651,6 +1855,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
 #if JERRY_ESNEXT
     case LEXER_KEYW_CLASS:
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* Class bodies have several early errors which are only checked by the parser. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       lexer_lit_location_t *literal_p;
       literal_p = scanner_push_class_declaration (context_p, scanner_context_p, SCAN_STACK_CLASS_STATEMENT);
 
@@ -1972,6 +2180,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
   {
     if (JERRY_UNLIKELY (lexer_check_next_character (context_p, LIT_CHAR_COLON)))
     {
+#if JERRY_LAZY_FUNCTIONS
+      /* Labels are not tracked by the scanner. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       lexer_consume_next_character (context_p);
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
@@ -2001,6 +2213,12 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
           || type == LEXER_LEFT_BRACE
           || (type == LEXER_LITERAL && context_p->token.lit_location.type == LEXER_IDENT_LITERAL))
       {
+#if JERRY_LAZY_FUNCTIONS
+        if (is_substatement)
+        {
+          scanner_parse_eagerly (scanner_context_p);
+        }
+#endif /* JERRY_LAZY_FUNCTIONS */
         scanner_context_p->mode = SCAN_MODE_VAR_STATEMENT;
         parser_stack_push_uint8 (context_p, SCAN_STACK_LET);
         return SCAN_KEEP_TOKEN;
@@ -2019,6 +2237,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
         lit_location_p->type |= SCANNER_LITERAL_NO_REG;
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      /* The let identifier is not registered as a reference. */
+      scanner_parse_eagerly (scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       return SCAN_KEEP_TOKEN;
     }
@@ -2035,6 +2257,9 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
     }
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_LAZY_FUNCTIONS
+    scanner_early_error_primary (context_p, scanner_context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
     scanner_add_reference (context_p, scanner_context_p);
 
     scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
@@ -2200,6 +2425,10 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
 
         scanner_context_p->active_switch_statement = switch_statement;
 
+#if JERRY_LAZY_FUNCTIONS
+        scanner_context_p->switch_depth--;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_ESNEXT
         scanner_pop_literal_pool (context_p, scanner_context_p);
 #endif /* JERRY_ESNEXT */
@@ -2219,6 +2448,9 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
           scanner_check_function_after_if (context_p, scanner_context_p);
           return SCAN_KEEP_TOKEN;
 #else /* !JERRY_ESNEXT */
+#if JERRY_LAZY_FUNCTIONS
+          scanner_context_p->early_error_flags = SCANNER_EARLY_ERROR_SUBSTATEMENT;
+#endif /* JERRY_LAZY_FUNCTIONS */
           scanner_context_p->mode = SCAN_MODE_STATEMENT;
           return SCAN_NEXT_TOKEN;
 #endif /* JERRY_ESNEXT */
@@ -2244,6 +2476,9 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
       case SCAN_STACK_DO_STATEMENT:
       {
         parser_stack_pop_uint8 (context_p);
+#if JERRY_LAZY_FUNCTIONS
+        scanner_context_p->loop_depth--;
+#endif /* JERRY_LAZY_FUNCTIONS */
 
         if (type != LEXER_KEYW_WHILE
             || (!terminator_found && !(context_p->token.flags & LEXER_WAS_NEWLINE)))
@@ -2267,6 +2502,14 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
         terminator_found = true;
         continue;
       }
+#if JERRY_LAZY_FUNCTIONS
+      case SCAN_STACK_LOOP_STATEMENT:
+      {
+        parser_stack_pop_uint8 (context_p);
+        scanner_context_p->loop_depth--;
+        continue;
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
 #if JERRY_ESNEXT
       case SCAN_STACK_PRIVATE_BLOCK_EARLY:
       {
@@ -2475,6 +2718,13 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #if JERRY_ESNEXT
   scanner_context.async_source_p = NULL;
 #endif /* JERRY_ESNEXT */
+#if JERRY_LAZY_FUNCTIONS
+  scanner_context.early_error_stack = 0;
+  scanner_context.early_error_depth = 0;
+  scanner_context.loop_depth = 0;
+  scanner_context.switch_depth = 0;
+  scanner_context.early_error_flags = 0;
+#endif /* JERRY_LAZY_FUNCTIONS */
 
   /* This assignment must be here because of Apple compilers. */
   context_p->u.scanner_context_p = &scanner_context;
@@ -2552,6 +2802,9 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
               || type == LEXER_SUBTRACT
               || LEXER_IS_UNARY_OP_TOKEN (type))
           {
+#if JERRY_LAZY_FUNCTIONS
+            scanner_early_error_unary (context_p, &scanner_context);
+#endif /* JERRY_LAZY_FUNCTIONS */
             break;
           }
           /* FALLTHRU */
@@ -2844,6 +3097,14 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #if JERRY_ESNEXT
           if (stack_top != SCAN_STACK_VAR && stack_top != SCAN_STACK_FOR_VAR_START)
           {
+#if JERRY_LAZY_FUNCTIONS
+            /* Lexical declarations cannot declare let. */
+            if (lexer_token_is_let (context_p))
+            {
+              scanner_parse_eagerly (&scanner_context);
+            }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
             scanner_detect_invalid_let (context_p, literal_p);
 
             if (stack_top == SCAN_STACK_LET || stack_top == SCAN_STACK_FOR_LET_START)
@@ -2918,6 +3179,17 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             }
           }
 
+#if JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT
+          /* Const declarations must have an initializer, except in for-in and for-of statements. */
+          if (stack_top == SCAN_STACK_CONST
+              || (stack_top == SCAN_STACK_FOR_CONST_START
+                  && context_p->token.type != LEXER_KEYW_IN
+                  && !SCANNER_IDENTIFIER_IS_OF ()))
+          {
+            scanner_parse_eagerly (&scanner_context);
+          }
+#endif /* JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT */
+
           if (SCANNER_IS_FOR_START (stack_top))
           {
 #if JERRY_MODULE_SYSTEM
@@ -2988,14 +3260,27 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
             do
             {
+#if JERRY_LAZY_FUNCTIONS
+              bool is_rest = false;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
               if (context_p->token.type == LEXER_THREE_DOTS)
               {
+#if JERRY_LAZY_FUNCTIONS
+                is_rest = true;
+#endif /* JERRY_LAZY_FUNCTIONS */
                 scanner_context.active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
                 lexer_next_token (context_p);
               }
 
               if (context_p->token.type == LEXER_LEFT_SQUARE || context_p->token.type == LEXER_LEFT_BRACE)
               {
+#if JERRY_LAZY_FUNCTIONS
+                if (is_rest)
+                {
+                  scanner_parse_eagerly (&scanner_context);
+                }
+#endif /* JERRY_LAZY_FUNCTIONS */
                 argument_literal_p = NULL;
                 break;
               }
@@ -3009,6 +3294,14 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
               argument_literal_p = scanner_append_argument (context_p, &scanner_context);
               lexer_next_token (context_p);
 
+#if JERRY_LAZY_FUNCTIONS
+              /* The rest parameter must be the last parameter without an initializer. */
+              if (is_rest && context_p->token.type != LEXER_RIGHT_PAREN)
+              {
+                scanner_parse_eagerly (&scanner_context);
+              }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
               if (context_p->token.type != LEXER_COMMA)
               {
                 break;
@@ -3149,6 +3442,9 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
             if (scanner_context.binding_type != SCANNER_BINDING_NONE)
             {
+#if JERRY_LAZY_FUNCTIONS
+              scanner_context.early_error_flags |= SCANNER_EARLY_ERROR_REST;
+#endif /* JERRY_LAZY_FUNCTIONS */
               scanner_context.mode = SCAN_MODE_BINDING;
             }
             break;
@@ -3170,6 +3466,14 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
           {
             uint16_t literal_pool_flags = SCANNER_LITERAL_POOL_FUNCTION;
 
+#if JERRY_LAZY_FUNCTIONS
+            /* The number of accessor arguments is only checked by the parser. */
+            if (context_p->token.type == LEXER_PROPERTY_GETTER || context_p->token.type == LEXER_PROPERTY_SETTER)
+            {
+              scanner_parse_eagerly (&scanner_context);
+            }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_ESNEXT
             if (context_p->token.type == LEXER_MULTIPLY)
             {
@@ -3219,6 +3523,16 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
           bool is_ident = (context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
 #endif /* JERRY_ESNEXT */
 
+#if JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT
+          /* Duplicated __proto__ properties are only detected by the parser. */
+          if (scanner_context.binding_type == SCANNER_BINDING_NONE
+              && (is_ident || context_p->token.lit_location.type == LEXER_STRING_LITERAL)
+              && lexer_compare_literal_to_string (context_p, "__proto__", 9))
+          {
+            scanner_parse_eagerly (&scanner_context);
+          }
+#endif /* JERRY_LAZY_FUNCTIONS && JERRY_ESNEXT */
+
           lexer_next_token (context_p);
 
 #if JERRY_ESNEXT
@@ -3262,6 +3576,10 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
             if (context_p->token.type == LEXER_ASSIGN)
             {
+#if JERRY_LAZY_FUNCTIONS
+              /* Shorthand initializers are only valid in destructuring assignments. */
+              scanner_parse_eagerly (&scanner_context);
+#endif /* JERRY_LAZY_FUNCTIONS */
               scanner_context.mode = SCAN_MODE_PRIMARY_EXPRESSION;
               break;
             }
@@ -3296,14 +3614,31 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
                         || scanner_context.binding_type == SCANNER_BINDING_ARG
                         || scanner_context.binding_type == SCANNER_BINDING_ARROW_ARG);
 
+#if JERRY_LAZY_FUNCTIONS
+          bool is_rest = (scanner_context.early_error_flags & SCANNER_EARLY_ERROR_REST) != 0;
+
+          scanner_context.early_error_flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_CHAIN_FLAGS
+                                                            | SCANNER_EARLY_ERROR_BINDING
+                                                            | SCANNER_EARLY_ERROR_REST);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
           if (type == LEXER_THREE_DOTS)
           {
+#if JERRY_LAZY_FUNCTIONS
+            is_rest = true;
+#endif /* JERRY_LAZY_FUNCTIONS */
             lexer_next_token (context_p);
             type = (lexer_token_type_t) context_p->token.type;
           }
 
           if (type == LEXER_LEFT_SQUARE || type == LEXER_LEFT_BRACE)
           {
+#if JERRY_LAZY_FUNCTIONS
+            if (is_rest)
+            {
+              scanner_parse_eagerly (&scanner_context);
+            }
+#endif /* JERRY_LAZY_FUNCTIONS */
             scanner_push_destructuring_pattern (context_p, &scanner_context, scanner_context.binding_type, true);
 
             if (type == LEXER_LEFT_SQUARE)
@@ -3320,10 +3655,34 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
           if (type != LEXER_LITERAL || context_p->token.lit_location.type != LEXER_IDENT_LITERAL)
           {
+#if JERRY_LAZY_FUNCTIONS
+            /* Only elisions and the end of the array pattern are valid here. */
+            if (is_rest || (type != LEXER_COMMA && type != LEXER_RIGHT_SQUARE))
+            {
+              scanner_parse_eagerly (&scanner_context);
+            }
+#endif /* JERRY_LAZY_FUNCTIONS */
             scanner_context.mode = SCAN_MODE_PRIMARY_EXPRESSION;
             continue;
           }
 
+#if JERRY_LAZY_FUNCTIONS
+          /* Lexical declarations cannot declare let. */
+          if ((scanner_context.binding_type == SCANNER_BINDING_LET
+               || scanner_context.binding_type == SCANNER_BINDING_CONST)
+              && lexer_token_is_let (context_p))
+          {
+            scanner_parse_eagerly (&scanner_context);
+          }
+
+          scanner_context.early_error_flags |= SCANNER_EARLY_ERROR_BINDING;
+
+          if (is_rest)
+          {
+            scanner_context.early_error_flags |= SCANNER_EARLY_ERROR_REST;
+          }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
           lexer_lit_location_t *literal_p = scanner_add_literal (context_p, &scanner_context);
 
           scanner_context.mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
@@ -3401,6 +3760,16 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             continue;
           }
 
+#if JERRY_LAZY_FUNCTIONS
+          /* Rest elements cannot have an initializer. */
+          if (is_rest)
+          {
+            scanner_parse_eagerly (&scanner_context);
+          }
+
+          scanner_context.early_error_flags &= (uint16_t) ~(SCANNER_EARLY_ERROR_BINDING | SCANNER_EARLY_ERROR_REST);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
           scanner_binding_literal_t binding_literal;
           binding_literal.literal_p = literal_p;
 
@@ -3448,6 +3817,10 @@ scan_completed:
       /* Ignore the errors thrown by the lexer. */
       context_p->error = PARSER_ERR_NO_ERROR;
 
+#if JERRY_LAZY_FUNCTIONS
+      scanner_context.status_flags |= SCANNER_CONTEXT_SCAN_FAILED;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       /* The following code may allocate memory, so it is enclosed in a try/catch. */
       PARSER_TRY (context_p->try_buffer)
       {
@@ -3527,7 +3900,7 @@ scan_completed:
 
           if (info_p->type == SCANNER_TYPE_FUNCTION)
           {
-            data_p = (const uint8_t *) (info_p + 1);
+            data_p = ((const uint8_t *) info_p) + SCANNER_FUNCTION_INFO_SIZE;
 
             JERRY_DEBUG_MSG ("  FUNCTION: flags: 0x%x declarations: %d",
                              (int) info_p->u8_arg,
@@ -96,6 +96,39 @@ typedef struct
   scanner_location_t location; /**< location */
 } scanner_location_info_t;
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Scanner info for functions.
+ */
+typedef struct
+{
+  scanner_info_t info; /**< header */
+  scanner_location_t end_location; /**< location after the closing brace of the function body
+                                    *   (source_p is NULL if the end of the body is unknown) */
+} scanner_function_info_t;
+
+/**
+ * Size of the fixed part of scanner info blocks of functions.
+ */
+#define SCANNER_FUNCTION_INFO_SIZE sizeof (scanner_function_info_t)
+
+#else /* !JERRY_LAZY_FUNCTIONS */
+
+/**
+ * Size of the fixed part of scanner info blocks of functions.
+ */
+#define SCANNER_FUNCTION_INFO_SIZE sizeof (scanner_info_t)
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+/**
+ * Get the start of the compressed stream of a function or block scanner info.
+ */
+#define SCANNER_INFO_GET_STREAM(info_p) \
+  (((const uint8_t *) (info_p)) \
+   + ((info_p)->type == SCANNER_TYPE_FUNCTION ? SCANNER_FUNCTION_INFO_SIZE : sizeof (scanner_info_t)))
+
 /**
  * Scanner info for "for" statements.
  */
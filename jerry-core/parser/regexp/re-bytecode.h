@@ -34,7 +34,7 @@
 /**
   * Size of the RegExp bytecode cache
   */
-#define RE_CACHE_SIZE 8u
+#define RE_CACHE_SIZE ((uint32_t) JERRY_REGEXP_CACHE_SIZE)
 
 /**
  * Maximum value that can be encoded in the RegExp bytecode as a single byte.
@@ -100,6 +100,21 @@ typedef struct
   ecma_value_t source;               /**< original RegExp pattern */
 } re_compiled_code_t;
 
+/**
+ * RegExp cache entry.
+ *
+ * Note:
+ *      the links store the entry index + 1, zero represents the end of the lists
+ */
+typedef struct
+{
+  re_compiled_code_t *bytecode_p;    /**< cached byte code */
+  uint32_t hash;                     /**< hash of the pattern and flags */
+  uint16_t hash_next;                /**< next entry in the same hash bucket */
+  uint16_t lru_prev;                 /**< previous (more recently used) entry */
+  uint16_t lru_next;                 /**< next (less recently used) entry */
+} re_cache_entry_t;
+
 void re_initialize_regexp_bytecode (re_compiler_ctx_t *re_ctx_p);
 uint32_t re_bytecode_size (re_compiler_ctx_t *re_ctx_p);
 
@@ -37,6 +37,79 @@
  * @{
  */
 
+/**
+ * Get a RegExp cache entry by its link value.
+ */
+#define RE_CACHE_GET_ENTRY(index) (JERRY_CONTEXT (re_cache) + (index) - 1)
+
+/**
+ * Get the hash bucket of a RegExp cache entry hash.
+ */
+#define RE_CACHE_GET_BUCKET(hash) (JERRY_CONTEXT (re_cache_buckets) + ((hash) & (RE_CACHE_SIZE - 1)))
+
+/**
+ * Compute the RegExp cache hash of a pattern and its flags.
+ *
+ * @return hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+re_cache_hash (ecma_string_t *pattern_str_p, /**< pattern string */
+               uint16_t flags) /**< flags */
+{
+  return (uint32_t) ecma_string_hash (pattern_str_p) ^ ((uint32_t) flags * 0x9e3779b1u);
+} /* re_cache_hash */
+
+/**
+ * Remove an entry from the least recently used list of the RegExp cache.
+ */
+static void
+re_cache_lru_remove (uint16_t index) /**< entry index + 1 */
+{
+  re_cache_entry_t *entry_p = RE_CACHE_GET_ENTRY (index);
+
+  if (entry_p->lru_prev != 0)
+  {
+    RE_CACHE_GET_ENTRY (entry_p->lru_prev)->lru_next = entry_p->lru_next;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_first) = entry_p->lru_next;
+  }
+
+  if (entry_p->lru_next != 0)
+  {
+    RE_CACHE_GET_ENTRY (entry_p->lru_next)->lru_prev = entry_p->lru_prev;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_last) = entry_p->lru_prev;
+  }
+} /* re_cache_lru_remove */
+
+/**
+ * Insert an entry at the front (most recently used end) of the least recently used list of the RegExp cache.
+ */
+static void
+re_cache_lru_insert_first (uint16_t index) /**< entry index + 1 */
+{
+  re_cache_entry_t *entry_p = RE_CACHE_GET_ENTRY (index);
+  uint16_t first_index = JERRY_CONTEXT (re_cache_lru_first);
+
+  entry_p->lru_prev = 0;
+  entry_p->lru_next = first_index;
+
+  if (first_index != 0)
+  {
+    RE_CACHE_GET_ENTRY (first_index)->lru_prev = index;
+  }
+  else
+  {
+    JERRY_CONTEXT (re_cache_lru_last) = index;
+  }
+
+  JERRY_CONTEXT (re_cache_lru_first) = index;
+} /* re_cache_lru_insert_first */
+
 /**
  * Search for the given pattern in the RegExp cache.
  *
@@ -45,53 +118,103 @@
  */
 static re_compiled_code_t *
 re_cache_lookup (ecma_string_t *pattern_str_p, /**< pattern string */
-                 uint16_t flags) /**< flags */
+                 uint16_t flags, /**< flags */
+                 uint32_t hash) /**< hash of the pattern and flags */
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  uint16_t index = *RE_CACHE_GET_BUCKET (hash);
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  while (index != 0)
   {
-    re_compiled_code_t *cached_bytecode_p = cache_p[idx];
-
-    if (cached_bytecode_p == NULL)
-    {
-      break;
-    }
-
-    ecma_string_t *cached_pattern_str_p = ecma_get_string_from_value (cached_bytecode_p->source);
+    re_cache_entry_t *entry_p = RE_CACHE_GET_ENTRY (index);
+    re_compiled_code_t *cached_bytecode_p = entry_p->bytecode_p;
 
-    if (cached_bytecode_p->header.status_flags == flags
-        && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+    if (entry_p->hash == hash
+        && cached_bytecode_p->header.status_flags == flags
+        && ecma_compare_ecma_strings (ecma_get_string_from_value (cached_bytecode_p->source), pattern_str_p))
     {
+      if (JERRY_CONTEXT (re_cache_lru_first) != index)
+      {
+        re_cache_lru_remove (index);
+        re_cache_lru_insert_first (index);
+      }
+
+#if JERRY_MEM_STATS
+      JERRY_CONTEXT (re_cache_hits)++;
+#endif /* JERRY_MEM_STATS */
       return cached_bytecode_p;
     }
+
+    index = entry_p->hash_next;
   }
 
+#if JERRY_MEM_STATS
+  JERRY_CONTEXT (re_cache_misses)++;
+#endif /* JERRY_MEM_STATS */
   return NULL;
 } /* re_cache_lookup */
 
 /**
- * Run garbage collection in RegExp cache.
+ * Insert a compiled bytecode into the RegExp cache. When the cache
+ * is full, the least recently used bytecode is evicted.
  */
-void
-re_cache_gc (void)
+static void
+re_cache_insert (re_compiled_code_t *bytecode_p, /**< compiled bytecode */
+                 uint32_t hash) /**< hash of the pattern and flags */
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  uint16_t index;
+  re_cache_entry_t *entry_p;
 
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  if (JERRY_CONTEXT (re_cache_count) < RE_CACHE_SIZE)
+  {
+    index = ++JERRY_CONTEXT (re_cache_count);
+    entry_p = RE_CACHE_GET_ENTRY (index);
+  }
+  else
   {
-    const re_compiled_code_t *cached_bytecode_p = cache_p[i];
+    index = JERRY_CONTEXT (re_cache_lru_last);
+    entry_p = RE_CACHE_GET_ENTRY (index);
+
+    re_cache_lru_remove (index);
 
-    if (cached_bytecode_p == NULL)
+    uint16_t *link_p = RE_CACHE_GET_BUCKET (entry_p->hash);
+
+    while (*link_p != index)
     {
-      break;
+      JERRY_ASSERT (*link_p != 0);
+      link_p = &RE_CACHE_GET_ENTRY (*link_p)->hash_next;
     }
 
-    ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-    cache_p[i] = NULL;
+    *link_p = entry_p->hash_next;
+    ecma_bytecode_deref ((ecma_compiled_code_t *) entry_p->bytecode_p);
   }
 
-  JERRY_CONTEXT (re_cache_idx) = 0;
+  uint16_t *bucket_p = RE_CACHE_GET_BUCKET (hash);
+
+  entry_p->bytecode_p = bytecode_p;
+  entry_p->hash = hash;
+  entry_p->hash_next = *bucket_p;
+  *bucket_p = index;
+
+  re_cache_lru_insert_first (index);
+} /* re_cache_insert */
+
+/**
+ * Free the RegExp bytecodes stored in the cache.
+ */
+void
+re_cache_gc (void)
+{
+  uint32_t count = JERRY_CONTEXT (re_cache_count);
+
+  for (uint32_t i = 0u; i < count; i++)
+  {
+    ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[i].bytecode_p);
+  }
+
+  memset (JERRY_CONTEXT (re_cache_buckets), 0, sizeof (JERRY_CONTEXT (re_cache_buckets)));
+  JERRY_CONTEXT (re_cache_count) = 0;
+  JERRY_CONTEXT (re_cache_lru_first) = 0;
+  JERRY_CONTEXT (re_cache_lru_last) = 0;
 } /* re_cache_gc */
 
 /**
@@ -104,7 +227,8 @@ re_compiled_code_t *
 re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
                      uint16_t flags) /**< flags */
 {
-  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (pattern_str_p, flags);
+  const uint32_t hash = re_cache_hash (pattern_str_p, flags);
+  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (pattern_str_p, flags, hash);
 
   if (cached_bytecode_p != NULL)
   {
@@ -161,15 +285,7 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
   }
 #endif /* JERRY_REGEXP_DUMP_BYTE_CODE */
 
-  uint8_t cache_idx = JERRY_CONTEXT (re_cache_idx);
-
-  if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-  {
-    ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-  }
-
-  JERRY_CONTEXT (re_cache)[cache_idx] = re_compiled_code_p;
-  JERRY_CONTEXT (re_cache_idx) = (uint8_t) (cache_idx + 1) % RE_CACHE_SIZE;
+  re_cache_insert (re_compiled_code_p, hash);
 
   return re_compiled_code_p;
 } /* re_compile_bytecode */
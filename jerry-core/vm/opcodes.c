@@ -24,6 +24,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-iterator-object.h"
+#include "ecma-jobqueue.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
@@ -882,12 +883,17 @@ opfunc_async_create_and_await (vm_frame_ctx_t *frame_ctx_p, /**< frame context *
                     == CBC_FUNCTION_ASYNC_ARROW));
 
   ecma_object_t *promise_p = ecma_builtin_get (ECMA_BUILTIN_ID_PROMISE);
-  ecma_value_t result = ecma_promise_reject_or_resolve (ecma_make_object_value (promise_p), value, true);
-  ecma_free_value (value);
+  ecma_value_t result = ECMA_VALUE_EMPTY;
 
-  if (ECMA_IS_VALUE_ERROR (result))
+  if (!ecma_promise_async_can_resume_directly (value))
   {
-    return result;
+    result = ecma_promise_reject_or_resolve (ecma_make_object_value (promise_p), value, true);
+    ecma_free_value (value);
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      return result;
+    }
   }
 
   vm_executable_object_t *executable_object_p;
@@ -895,9 +901,21 @@ opfunc_async_create_and_await (vm_frame_ctx_t *frame_ctx_p, /**< frame context *
 
   executable_object_p->extended_object.u.cls.u2.executable_obj_flags |= extra_flags;
 
-  ecma_promise_async_then (result, ecma_make_object_value ((ecma_object_t *) executable_object_p));
+  if (result == ECMA_VALUE_EMPTY)
+  {
+    /* The value is passed to the async function without creating a promise. */
+    ecma_enqueue_promise_async_reaction_job (ecma_make_object_value ((ecma_object_t *) executable_object_p),
+                                             value,
+                                             false);
+    ecma_free_value (value);
+  }
+  else
+  {
+    ecma_promise_async_then (result, ecma_make_object_value ((ecma_object_t *) executable_object_p));
+    ecma_free_value (result);
+  }
+
   ecma_deref_object ((ecma_object_t *) executable_object_p);
-  ecma_free_value (result);
 
   result = ecma_op_create_promise_object (ECMA_VALUE_EMPTY, ECMA_VALUE_UNDEFINED, promise_p);
 
@@ -157,6 +157,69 @@ struct jerry_backtrace_frame_internal_t
   ecma_value_t this_binding; /**< this binding passed to the function */
 };
 
+#if JERRY_VM_HEAP_FRAMES
+
+/**
+ * Default size of the chunks of the vm frame stack.
+ */
+#define VM_HEAP_FRAMES_CHUNK_SIZE 4096
+
+/**
+ * Chunk of the vm frame stack allocated on the engine heap.
+ *
+ * The frames are bump-allocated after the chunk header.
+ */
+typedef struct vm_heap_frames_chunk_t
+{
+  struct vm_heap_frames_chunk_t *prev_p; /**< previous chunk */
+  uint32_t size; /**< size of the chunk including the chunk header */
+  uint32_t top; /**< offset of the first unused byte of the chunk */
+} vm_heap_frames_chunk_t;
+
+/**
+ * Size of the chunk header, padded so the frames after it are aligned to JMEM_ALIGNMENT.
+ */
+#define VM_HEAP_FRAMES_CHUNK_HEADER_SIZE \
+  ((uint32_t) JERRY_ALIGNUP (sizeof (vm_heap_frames_chunk_t), JMEM_ALIGNMENT))
+
+#endif /* JERRY_VM_HEAP_FRAMES */
+
+#if JERRY_VM_INLINE_CACHE
+
+/**
+ * Number of inline cache entries (must be a power of 2).
+ */
+#define VM_INLINE_CACHE_SIZE 256
+
+/**
+ * Maximum number of property pairs before an own property cached by the inline cache.
+ */
+#define VM_INLINE_CACHE_MAX_DEPTH 8
+
+/**
+ * Inline cache entry of a property access in the byte code.
+ *
+ * Own properties are cached by their position in the property list of the object.
+ * Inherited properties are cached for a single object, and the entry is valid while
+ * vm_inline_cache_epoch is unchanged, since the epoch is increased whenever
+ * a property is freed.
+ */
+typedef struct
+{
+  const uint8_t *byte_code_p; /**< byte code of the property access */
+  ecma_property_t *property_p; /**< inherited property */
+  ecma_value_t name; /**< name of the inherited property */
+  uint32_t epoch; /**< value of vm_inline_cache_epoch when the entry is filled */
+  jmem_cpointer_t object_cp; /**< object which inherits the property */
+  jmem_cpointer_t prototype_cp; /**< prototype which has the inherited property,
+                                 *   JMEM_CP_NULL for own properties */
+  jmem_cpointer_t property_list_cp; /**< property list of the object which inherits the property */
+  uint8_t depth; /**< position of the property pair of an own property in the property list */
+  uint8_t index; /**< index of an own property in its property pair */
+} vm_inline_cache_entry_t;
+
+#endif /* JERRY_VM_INLINE_CACHE */
+
 /**
  * @}
  * @}
@@ -33,8 +33,10 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-promise-object.h"
+#include "ecma-property-shape.h"
 #include "ecma-regexp-object.h"
 #include "jcontext.h"
+#include "jerry-snapshot.h"
 #include "opcodes.h"
 #include "vm.h"
 #include "vm-stack.h"
@@ -46,15 +48,336 @@
  * @{
  */
 
+#if JERRY_VM_INLINE_CACHE
+
+/**
+ * Get the inline cache entry of a property access.
+ *
+ * @return pointer to the entry
+ */
+static inline vm_inline_cache_entry_t * JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_get_entry (const uint8_t *byte_code_p) /**< byte code of the property access */
+{
+  uintptr_t index = (uintptr_t) byte_code_p;
+  index ^= index >> 8;
+
+  return JERRY_CONTEXT (vm_inline_cache) + (index & (VM_INLINE_CACHE_SIZE - 1));
+} /* vm_inline_cache_get_entry */
+
+/**
+ * Get the compressed pointer part of a property name value.
+ *
+ * @return the compressed pointer part of the property name
+ */
+static inline jmem_cpointer_t JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_get_name_cp (ecma_value_t name, /**< property name (string or symbol) */
+                             ecma_property_t *name_type_p) /**< [out] property name type */
+{
+  ecma_string_t *name_p = ecma_get_prop_name_from_value (name);
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    *name_type_p = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    return (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  }
+
+  jmem_cpointer_t name_cp;
+  ECMA_SET_NON_NULL_POINTER (name_cp, name_p);
+
+  *name_type_p = ECMA_DIRECT_STRING_PTR;
+  return name_cp;
+} /* vm_inline_cache_get_name_cp */
+
+/**
+ * Find the property cached by the inline cache of a property access.
+ *
+ * Own properties are identified by their position in the property list,
+ * so objects which properties are created in the same order share the
+ * cached position. The position is valid if the property stored there
+ * has the same name. Inherited properties are cached for a single object.
+ *
+ * @return pointer to the property if the cached property belongs to the
+ *         object / property name pair, NULL otherwise
+ */
+static inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_lookup (const uint8_t *byte_code_p, /**< byte code of the property access */
+                        ecma_object_t *object_p, /**< object */
+                        ecma_value_t name, /**< property name (string or symbol) */
+                        bool is_own) /**< only own properties are accepted */
+{
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_get_entry (byte_code_p);
+
+  if (entry_p->byte_code_p != byte_code_p)
+  {
+    return NULL;
+  }
+
+  if (entry_p->prototype_cp != JMEM_CP_NULL)
+  {
+    jmem_cpointer_t object_cp;
+    ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+    /* The property of the prototype is still visible if the prototype and the
+     * property list of the object are unchanged, because new properties are
+     * always inserted into a new first property pair of the object. */
+    if (is_own
+        || entry_p->object_cp != object_cp
+        || entry_p->name != name
+        || entry_p->epoch != JERRY_CONTEXT (vm_inline_cache_epoch)
+        || entry_p->prototype_cp != object_p->u2.prototype_cp
+        || entry_p->property_list_cp != object_p->u1.property_list_cp)
+    {
+      return NULL;
+    }
+
+    return entry_p->property_p;
+  }
+
+  ecma_object_type_t type = ecma_get_object_type (object_p);
+
+  if ((type != ECMA_OBJECT_TYPE_GENERAL && type != ECMA_OBJECT_TYPE_FUNCTION)
+      || object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                   object_p->u1.property_list_cp);
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+#if JERRY_PROPERTY_SHAPES
+  uint16_t shape_id = (prop_iter_p != NULL) ? prop_iter_p->shape_id : 0;
+#endif /* JERRY_PROPERTY_SHAPES */
+
+  for (uint32_t depth = entry_p->depth; depth > 0 && prop_iter_p != NULL; depth--)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  if (prop_iter_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_t name_type;
+  jmem_cpointer_t name_cp = vm_inline_cache_get_name_cp (name, &name_type);
+  uint32_t index = entry_p->index;
+
+#if JERRY_PROPERTY_SHAPES
+  /* Shaped objects store their property names in their shape. */
+  jmem_cpointer_t property_name_cp = ((shape_id != 0) ? ecma_property_shape_get_name (shape_id, entry_p->depth, index)
+                                                      : ((ecma_property_pair_t *) prop_iter_p)->names_cp[index]);
+#else /* !JERRY_PROPERTY_SHAPES */
+  jmem_cpointer_t property_name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[index];
+#endif /* JERRY_PROPERTY_SHAPES */
+
+  /* Deleted and internal properties never match, since their name type is special. */
+  if (property_name_cp != name_cp
+      || ECMA_PROPERTY_GET_NAME_TYPE (prop_iter_p->types[index]) != name_type)
+  {
+    return NULL;
+  }
+
+  return prop_iter_p->types + index;
+} /* vm_inline_cache_lookup */
+
+/**
+ * Get the property pair of a property.
+ *
+ * @return pointer to the property pair
+ */
+static ecma_property_pair_t *
+vm_inline_cache_get_property_pair (ecma_property_t *property_p, /**< property */
+                                   uint32_t *index_p) /**< [out] index of the property in the pair */
+{
+  /* The property is either the first or the second item of a property pair. */
+  ecma_property_value_t *value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+  ecma_property_pair_t *prop_pair_p;
+
+  prop_pair_p = (ecma_property_pair_t *) ((uint8_t *) value_p - offsetof (ecma_property_pair_t, values));
+  *index_p = 0;
+
+  if (prop_pair_p->header.types != property_p)
+  {
+    prop_pair_p = (ecma_property_pair_t *) ((uint8_t *) (value_p - 1) - offsetof (ecma_property_pair_t, values));
+    *index_p = 1;
+  }
+
+  JERRY_ASSERT (prop_pair_p->header.types + *index_p == property_p);
+  return prop_pair_p;
+} /* vm_inline_cache_get_property_pair */
+
+/**
+ * Find a data property and store it in the inline cache of a property access.
+ *
+ * The property is searched in the own properties of the object first,
+ * and in the properties of its prototype next. Only real data properties
+ * of ordinary objects, which name is the same string instance as the
+ * searched name, are cached.
+ *
+ * @return pointer to the property if it is stored in the cache, NULL otherwise
+ */
+static ecma_property_t *
+vm_inline_cache_insert (const uint8_t *byte_code_p, /**< byte code of the property access */
+                        ecma_object_t *object_p, /**< object */
+                        ecma_value_t name, /**< property name (string or symbol) */
+                        bool is_own) /**< only own properties are accepted */
+{
+  JERRY_ASSERT (ecma_is_value_prop_name (name));
+
+  ecma_object_type_t type = ecma_get_object_type (object_p);
+
+  if (type != ECMA_OBJECT_TYPE_GENERAL && type != ECMA_OBJECT_TYPE_FUNCTION)
+  {
+    return NULL;
+  }
+
+  ecma_string_t *name_p = ecma_get_prop_name_from_value (name);
+  ecma_property_t *property_p = ecma_find_named_property (object_p, name_p);
+  jmem_cpointer_t prototype_cp = JMEM_CP_NULL;
+
+  if (property_p == NULL)
+  {
+    /* Only the direct prototype of plain objects is searched, since
+     * other objects might have lazy instantiated (virtual) properties. */
+    if (is_own
+        || type != ECMA_OBJECT_TYPE_GENERAL
+        || ecma_get_object_is_builtin (object_p)
+        || object_p->u2.prototype_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+    {
+      ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                       object_p->u1.property_list_cp);
+
+      /* A new property is stored in the first property pair if its first
+       * item is deleted, and after the hashmap if the object has a hashmap. */
+      if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
+          || prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+      {
+        return NULL;
+      }
+    }
+
+    prototype_cp = object_p->u2.prototype_cp;
+    ecma_object_t *prototype_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, prototype_cp);
+
+    type = ecma_get_object_type (prototype_p);
+
+    if (type != ECMA_OBJECT_TYPE_GENERAL && type != ECMA_OBJECT_TYPE_FUNCTION)
+    {
+      return NULL;
+    }
+
+    property_p = ecma_find_named_property (prototype_p, name_p);
+
+    if (property_p == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  if (!ECMA_PROPERTY_IS_RAW_DATA (*property_p)
+      || (is_own && !ecma_is_property_writable (*property_p)))
+  {
+    return NULL;
+  }
+
+  uint32_t index;
+  ecma_property_pair_t *prop_pair_p = vm_inline_cache_get_property_pair (property_p, &index);
+  ecma_property_t name_type;
+  jmem_cpointer_t name_cp = vm_inline_cache_get_name_cp (name, &name_type);
+
+#if JERRY_PROPERTY_SHAPES
+  ecma_object_t *owner_p = object_p;
+
+  if (prototype_cp != JMEM_CP_NULL)
+  {
+    owner_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, prototype_cp);
+  }
+
+  /* Shaped property pairs have no name slots, their names are checked by the lookup. */
+  if (ecma_property_shape_get_id (owner_p) == 0
+      && (prop_pair_p->names_cp[index] != name_cp
+          || ECMA_PROPERTY_GET_NAME_TYPE (*property_p) != name_type))
+  {
+    return NULL;
+  }
+#else /* !JERRY_PROPERTY_SHAPES */
+  if (prop_pair_p->names_cp[index] != name_cp
+      || ECMA_PROPERTY_GET_NAME_TYPE (*property_p) != name_type)
+  {
+    return NULL;
+  }
+#endif /* JERRY_PROPERTY_SHAPES */
+
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_get_entry (byte_code_p);
+
+  if (prototype_cp == JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                     object_p->u1.property_list_cp);
+    uint32_t depth = 0;
+
+#if JERRY_PROPERTY_HASHMAP
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+    while (prop_iter_p != &prop_pair_p->header)
+    {
+      if (++depth > VM_INLINE_CACHE_MAX_DEPTH)
+      {
+        return property_p;
+      }
+
+      prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    }
+
+    entry_p->byte_code_p = byte_code_p;
+    entry_p->prototype_cp = JMEM_CP_NULL;
+    entry_p->depth = (uint8_t) depth;
+    entry_p->index = (uint8_t) index;
+    return property_p;
+  }
+
+  entry_p->byte_code_p = byte_code_p;
+  entry_p->property_p = property_p;
+  entry_p->name = name;
+  entry_p->epoch = JERRY_CONTEXT (vm_inline_cache_epoch);
+  ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+  entry_p->prototype_cp = prototype_cp;
+  entry_p->property_list_cp = object_p->u1.property_list_cp;
+  return property_p;
+} /* vm_inline_cache_insert */
+
+#endif /* JERRY_VM_INLINE_CACHE */
+
 /**
  * Get the value of object[property].
  *
  * @return ecma value
  */
 static ecma_value_t
-vm_op_get_value (ecma_value_t object, /**< base object */
+vm_op_get_value (const uint8_t *byte_code_p, /**< byte code of the property access */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property) /**< property name */
 {
+#if !JERRY_VM_INLINE_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_INLINE_CACHE */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -100,6 +423,23 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if JERRY_VM_INLINE_CACHE
+      if (ecma_is_value_prop_name (property))
+      {
+        ecma_property_t *cached_property_p = vm_inline_cache_lookup (byte_code_p, object_p, property, false);
+
+        if (cached_property_p == NULL || !(*cached_property_p & ECMA_PROPERTY_FLAG_DATA))
+        {
+          cached_property_p = vm_inline_cache_insert (byte_code_p, object_p, property, false);
+        }
+
+        if (cached_property_p != NULL)
+        {
+          return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (cached_property_p)->value);
+        }
+      }
+#endif /* JERRY_VM_INLINE_CACHE */
+
 #if JERRY_LCACHE
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -151,11 +491,16 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  *         if the property setting is unsuccessful
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t base, /**< base object */
+vm_op_set_value (const uint8_t *byte_code_p, /**< byte code of the property access */
+                 ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+#if !JERRY_VM_INLINE_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_INLINE_CACHE */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -210,6 +555,27 @@ vm_op_set_value (ecma_value_t base, /**< base object */
   {
     object_p = ecma_get_object_from_value (base);
 
+#if JERRY_VM_INLINE_CACHE
+    if (ecma_is_value_prop_name (property) && !ecma_is_lexical_environment (object_p))
+    {
+      ecma_property_t *cached_property_p = vm_inline_cache_lookup (byte_code_p, object_p, property, true);
+
+      if (cached_property_p == NULL || !ECMA_PROPERTY_IS_RAW_DATA (*cached_property_p)
+          || !ecma_is_property_writable (*cached_property_p))
+      {
+        cached_property_p = vm_inline_cache_insert (byte_code_p, object_p, property, true);
+      }
+
+      if (cached_property_p != NULL)
+      {
+        ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (cached_property_p), value);
+        ecma_deref_object (object_p);
+        ecma_deref_ecma_string (ecma_get_prop_name_from_value (property));
+        return ECMA_VALUE_TRUE;
+      }
+    }
+#endif /* JERRY_VM_INLINE_CACHE */
+
     if (JERRY_UNLIKELY (!ecma_is_value_prop_name (property)))
     {
       property_p = ecma_op_to_string (property);
@@ -455,6 +821,16 @@ vm_construct_literal_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     bytecode_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
                                                   lit_value);
 #if JERRY_SNAPSHOT_EXEC
+
+    if (JERRY_UNLIKELY (CBC_IS_SNAPSHOT_FUNCTION (bytecode_p)))
+    {
+      bytecode_p = snapshot_load_lazy_function (frame_ctx_p->shared_p->bytecode_header_p, lit_value);
+
+      if (JERRY_UNLIKELY (bytecode_p == NULL))
+      {
+        return ECMA_VALUE_ERROR;
+      }
+    }
   }
   else
   {
@@ -2570,7 +2946,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p--;
           }
 
-          result = vm_op_get_value (base, left_value);
+          result = vm_op_get_value (byte_code_start_p, base, left_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2893,7 +3269,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_PROP_GET:
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (byte_code_start_p, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2932,7 +3308,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PROP_POST_INCR:
         case VM_OC_PROP_POST_DECR:
         {
-          result = vm_op_get_value (left_value,
+          result = vm_op_get_value (byte_code_start_p,
+                                    left_value,
                                     right_value);
 
           if (opcode < CBC_PRE_INCR)
@@ -2994,7 +3371,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 POST_INCREASE_DECREASE_PUT_RESULT (result);
               }
 
-              result = (ecma_value_t) (int_value + int_increase);
+              result = (ecma_value_t) (uint32_t) (int_value + int_increase);
               break;
             }
             result_number = (ecma_number_t) ecma_get_integer_from_value (result);
@@ -4104,7 +4481,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-          uint32_t index = context_top_p[-3];
+          uint32_t index = (uint32_t) context_top_p[-3];
           ecma_value_t *buffer_p = collection_p->buffer_p;
 
           *stack_top_p++ = buffer_p[index];
@@ -4122,7 +4499,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_value_t *buffer_p = collection_p->buffer_p;
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-4]);
-          uint32_t index = stack_top_p[-3];
+          uint32_t index = (uint32_t) stack_top_p[-3];
 
           while (index < collection_p->item_count)
           {
@@ -4467,7 +4844,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (context_type == VM_CONTEXT_FINALLY_JUMP);
 
-          uint32_t jump_target = *stack_top_p;
+          uint32_t jump_target = (uint32_t) *stack_top_p;
 
           vm_stack_found_type type = vm_stack_find_finally (frame_ctx_p,
                                                             stack_top_p,
@@ -4697,7 +5074,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base,
+          ecma_value_t set_value_result = vm_op_set_value (byte_code_start_p,
+                                                           base,
                                                            property,
                                                            result,
                                                            is_strict);
@@ -5022,6 +5400,16 @@ vm_init_module_scope (ecma_module_t *module_p) /**< module without scope */
           function_bytecode_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
                                                                  literal_start_p[literal_index]);
 #if JERRY_SNAPSHOT_EXEC
+
+          if (JERRY_UNLIKELY (CBC_IS_SNAPSHOT_FUNCTION (function_bytecode_p)))
+          {
+            function_bytecode_p = snapshot_load_lazy_function (compiled_code_p, literal_start_p[literal_index]);
+
+            if (JERRY_UNLIKELY (function_bytecode_p == NULL))
+            {
+              return ECMA_VALUE_ERROR;
+            }
+          }
         }
         else
         {
@@ -5246,6 +5634,141 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 } /* vm_execute */
 
+#if JERRY_VM_HEAP_FRAMES
+
+/**
+ * Allocate a new chunk for the vm frame stack.
+ *
+ * @return pointer to the allocated frame - if success
+ *         NULL - otherwise
+ */
+static void * JERRY_ATTR_NOINLINE
+vm_heap_frames_alloc_chunk (uint32_t frame_size) /**< size of the frame */
+{
+  vm_heap_frames_chunk_t *chunk_p = JERRY_CONTEXT (vm_heap_frames_spare_chunk_p);
+  uint32_t chunk_size = VM_HEAP_FRAMES_CHUNK_HEADER_SIZE + frame_size;
+
+  if (chunk_p != NULL)
+  {
+    JERRY_CONTEXT (vm_heap_frames_spare_chunk_p) = NULL;
+
+    if (chunk_p->size < chunk_size)
+    {
+      jmem_heap_free_block (chunk_p, chunk_p->size);
+      chunk_p = NULL;
+    }
+  }
+
+  if (chunk_p == NULL)
+  {
+    chunk_size = JERRY_MAX (chunk_size, VM_HEAP_FRAMES_CHUNK_SIZE);
+    chunk_p = (vm_heap_frames_chunk_t *) jmem_heap_alloc_block_null_on_error (chunk_size);
+
+    if (JERRY_UNLIKELY (chunk_p == NULL))
+    {
+      return NULL;
+    }
+
+    chunk_p->size = chunk_size;
+  }
+
+  chunk_p->prev_p = JERRY_CONTEXT (vm_heap_frames_chunk_p);
+  chunk_p->top = VM_HEAP_FRAMES_CHUNK_HEADER_SIZE + frame_size;
+  JERRY_CONTEXT (vm_heap_frames_chunk_p) = chunk_p;
+
+  return (uint8_t *) chunk_p + VM_HEAP_FRAMES_CHUNK_HEADER_SIZE;
+} /* vm_heap_frames_alloc_chunk */
+
+/**
+ * Allocate a frame on the vm frame stack.
+ *
+ * @return pointer to the allocated frame - if success
+ *         NULL - if the stack limit is reached or the heap is full
+ */
+static inline void * JERRY_ATTR_ALWAYS_INLINE
+vm_heap_frames_alloc (uint32_t frame_size) /**< size of the frame */
+{
+#if (JERRY_VM_HEAP_FRAMES_LIMIT != 0)
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (vm_heap_frames_usage) + frame_size > CONFIG_VM_HEAP_FRAMES_LIMIT))
+  {
+    return NULL;
+  }
+
+  JERRY_CONTEXT (vm_heap_frames_usage) += frame_size;
+#endif /* (JERRY_VM_HEAP_FRAMES_LIMIT != 0) */
+
+  vm_heap_frames_chunk_t *chunk_p = JERRY_CONTEXT (vm_heap_frames_chunk_p);
+
+  if (JERRY_LIKELY (chunk_p != NULL && chunk_p->size - chunk_p->top >= frame_size))
+  {
+    void *frame_p = (uint8_t *) chunk_p + chunk_p->top;
+    chunk_p->top += frame_size;
+    return frame_p;
+  }
+
+  void *frame_p = vm_heap_frames_alloc_chunk (frame_size);
+
+#if (JERRY_VM_HEAP_FRAMES_LIMIT != 0)
+  if (JERRY_UNLIKELY (frame_p == NULL))
+  {
+    JERRY_CONTEXT (vm_heap_frames_usage) -= frame_size;
+  }
+#endif /* (JERRY_VM_HEAP_FRAMES_LIMIT != 0) */
+
+  return frame_p;
+} /* vm_heap_frames_alloc */
+
+/**
+ * Free the topmost frame of the vm frame stack.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+vm_heap_frames_free (void *frame_p, /**< frame */
+                     uint32_t frame_size) /**< size of the frame */
+{
+  vm_heap_frames_chunk_t *chunk_p = JERRY_CONTEXT (vm_heap_frames_chunk_p);
+
+#if (JERRY_VM_HEAP_FRAMES_LIMIT != 0)
+  JERRY_CONTEXT (vm_heap_frames_usage) -= frame_size;
+#endif /* (JERRY_VM_HEAP_FRAMES_LIMIT != 0) */
+
+  chunk_p->top -= frame_size;
+  JERRY_ASSERT ((uint8_t *) chunk_p + chunk_p->top == frame_p);
+  JERRY_UNUSED (frame_p);
+
+  if (chunk_p->top == VM_HEAP_FRAMES_CHUNK_HEADER_SIZE)
+  {
+    /* The chunk is kept as a spare chunk, so repeated calls at a chunk boundary do not allocate. */
+    JERRY_CONTEXT (vm_heap_frames_chunk_p) = chunk_p->prev_p;
+
+    if (JERRY_CONTEXT (vm_heap_frames_spare_chunk_p) != NULL)
+    {
+      vm_heap_frames_chunk_t *spare_chunk_p = JERRY_CONTEXT (vm_heap_frames_spare_chunk_p);
+      jmem_heap_free_block (spare_chunk_p, spare_chunk_p->size);
+    }
+
+    JERRY_CONTEXT (vm_heap_frames_spare_chunk_p) = chunk_p;
+  }
+} /* vm_heap_frames_free */
+
+/**
+ * Free the unused chunks of the vm frame stack.
+ */
+void
+vm_heap_frames_finalize (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (vm_heap_frames_chunk_p) == NULL);
+
+  vm_heap_frames_chunk_t *spare_chunk_p = JERRY_CONTEXT (vm_heap_frames_spare_chunk_p);
+
+  if (spare_chunk_p != NULL)
+  {
+    jmem_heap_free_block (spare_chunk_p, spare_chunk_p->size);
+    JERRY_CONTEXT (vm_heap_frames_spare_chunk_p) = NULL;
+  }
+} /* vm_heap_frames_finalize */
+
+#endif /* JERRY_VM_HEAP_FRAMES */
+
 /**
  * Run the code.
  *
@@ -5272,19 +5795,37 @@ vm_run (vm_frame_ctx_shared_t *shared_p, /**< shared data */
   }
 
   frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
+
+#if JERRY_VM_HEAP_FRAMES
+  frame_size = JERRY_ALIGNUP (frame_size, JMEM_ALIGNMENT);
+  frame_ctx_p = (vm_frame_ctx_t *) vm_heap_frames_alloc ((uint32_t) frame_size);
+
+  if (JERRY_UNLIKELY (frame_ctx_p == NULL))
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Maximum call stack size exceeded"));
+  }
+#else /* !JERRY_VM_HEAP_FRAMES */
   frame_size = (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
 
   /* Use JERRY_MAX() to avoid array declaration with size 0. */
   JERRY_VLA (uintptr_t, stack, frame_size);
 
   frame_ctx_p = (vm_frame_ctx_t *) stack;
+#endif /* JERRY_VM_HEAP_FRAMES */
 
   frame_ctx_p->shared_p = shared_p;
   frame_ctx_p->lex_env_p = lex_env_p;
   frame_ctx_p->this_binding = this_binding_value;
 
   vm_init_exec (frame_ctx_p);
+
+#if JERRY_VM_HEAP_FRAMES
+  ecma_value_t completion_value = vm_execute (frame_ctx_p);
+  vm_heap_frames_free (frame_ctx_p, (uint32_t) frame_size);
+  return completion_value;
+#else /* !JERRY_VM_HEAP_FRAMES */
   return vm_execute (frame_ctx_p);
+#endif /* JERRY_VM_HEAP_FRAMES */
 } /* vm_run */
 
 /**
@@ -486,6 +486,10 @@ bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#if JERRY_VM_HEAP_FRAMES
+void vm_heap_frames_finalize (void);
+#endif /* JERRY_VM_HEAP_FRAMES */
+
 /**
  * @}
  * @}
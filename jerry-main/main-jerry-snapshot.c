@@ -17,6 +17,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined (__unix__) || defined (__APPLE__)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define SNAPSHOT_HAS_FORK 1
+#endif /* __unix__ || __APPLE__ */
+
 #include "jerryscript.h"
 #include "jerryscript-port.h"
 #include "jerryscript-port-default.h"
@@ -199,6 +206,7 @@ typedef enum
   OPT_GENERATE_STATIC,
   OPT_GENERATE_SHOW_OP,
   OPT_GENERATE_FUNCTION,
+  OPT_GENERATE_JOBS,
   OPT_GENERATE_OUT,
   OPT_IMPORT_LITERAL_LIST
 } generate_opt_id_t;
@@ -220,12 +228,418 @@ static const cli_opt_t generate_opts[] =
                .help = "import literals from list format (for static snapshots)"),
   CLI_OPT_DEF (.id = OPT_GENERATE_SHOW_OP, .longopt = "show-opcodes",
                .help = "print generated opcodes"),
+  CLI_OPT_DEF (.id = OPT_GENERATE_JOBS, .opt = "j", .longopt = "jobs",
+               .meta = "NUM",
+               .help = "number of worker processes compiling the input files (default: 1)"),
   CLI_OPT_DEF (.id = OPT_GENERATE_OUT, .opt = "o",  .meta="FILE",
                .help = "specify output file name (default: js.snapshot)"),
-  CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE",
-               .help = "input source file")
+  CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE(S)",
+               .help = "input source files, the snapshots of multiple files are merged")
 };
 
+/**
+ * Settings of snapshot generation
+ */
+typedef struct
+{
+  jerry_init_flag_t init_flags; /**< engine init flags */
+  uint32_t snapshot_flags; /**< snapshot generation flags */
+  const char *function_args_p; /**< function arguments (NULL - if script snapshots are generated) */
+  uint32_t num_of_literals; /**< number of imported magic strings */
+} generate_settings_t;
+
+/**
+ * Import the magic strings from a literal list file.
+ *
+ * @return number of imported magic strings
+ */
+static uint32_t
+import_literal_list (const char *literals_file_name_p) /**< literal list file name */
+{
+  /* The literal buffer is only used by the 'litdump' command. */
+  uint8_t *sp_buffer_start_p = (uint8_t *) literal_buffer;
+  FILE *file_p = fopen (literals_file_name_p, "rb");
+
+  if (file_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", literals_file_name_p);
+    return 0;
+  }
+
+  size_t sp_buffer_size = fread (sp_buffer_start_p, 1u, JERRY_BUFFER_SIZE - 1, file_p);
+  fclose (file_p);
+
+  if (sp_buffer_size == 0)
+  {
+    return 0;
+  }
+
+  sp_buffer_start_p[sp_buffer_size] = '\0';
+
+  const char *sp_buffer_p = (const char *) sp_buffer_start_p;
+  uint32_t num_of_lit = 0;
+
+  do
+  {
+    char *sp_buffer_end_p = NULL;
+    jerry_length_t mstr_size = (jerry_length_t) strtol (sp_buffer_p, &sp_buffer_end_p, 10);
+    if (mstr_size > 0 && num_of_lit < JERRY_LITERAL_LENGTH)
+    {
+      magic_string_items[num_of_lit] = (jerry_char_t *) (sp_buffer_end_p + 1);
+      magic_string_lengths[num_of_lit] = mstr_size;
+      num_of_lit++;
+    }
+    sp_buffer_p = sp_buffer_end_p + mstr_size + 1;
+  }
+  while ((size_t) (sp_buffer_p - (char *) sp_buffer_start_p) < sp_buffer_size);
+
+  return num_of_lit;
+} /* import_literal_list */
+
+/**
+ * Generate the snapshot of a source file into the output buffer.
+ *
+ * @return size of the snapshot - if generation is successful
+ *         0 - otherwise
+ */
+static size_t
+generate_snapshot (const generate_settings_t *settings_p, /**< generation settings */
+                   const char *file_name_p) /**< source file name */
+{
+  uint8_t *source_p = input_buffer;
+  size_t source_length = read_file (source_p, file_name_p);
+
+  if (source_length == 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Input file is empty\n");
+    return 0;
+  }
+
+  jerry_init (settings_p->init_flags);
+
+  if (!jerry_is_valid_utf8_string (source_p, (jerry_size_t) source_length))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Input must be a valid UTF-8 string.\n");
+    jerry_cleanup ();
+    return 0;
+  }
+
+  if (settings_p->num_of_literals > 0)
+  {
+    jerry_register_magic_strings (magic_string_items, settings_p->num_of_literals,
+                                  magic_string_lengths);
+  }
+
+  jerry_value_t snapshot_result;
+
+  jerry_parse_options_t parse_options;
+  parse_options.options = JERRY_PARSE_HAS_RESOURCE;
+  parse_options.resource_name_p = (jerry_char_t *) file_name_p;
+  parse_options.resource_name_length = (size_t) strlen (file_name_p);
+
+  if (settings_p->function_args_p != NULL)
+  {
+    snapshot_result = jerry_generate_function_snapshot ((jerry_char_t *) source_p,
+                                                        source_length,
+                                                        (const jerry_char_t *) settings_p->function_args_p,
+                                                        strlen (settings_p->function_args_p),
+                                                        &parse_options,
+                                                        settings_p->snapshot_flags,
+                                                        output_buffer,
+                                                        sizeof (output_buffer) / sizeof (uint32_t));
+  }
+  else
+  {
+    snapshot_result = jerry_generate_snapshot ((jerry_char_t *) source_p,
+                                               source_length,
+                                               &parse_options,
+                                               settings_p->snapshot_flags,
+                                               output_buffer,
+                                               sizeof (output_buffer) / sizeof (uint32_t));
+  }
+
+  if (jerry_value_is_error (snapshot_result))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Generating snapshot failed!\n");
+
+    snapshot_result = jerry_get_value_from_error (snapshot_result, true);
+
+    print_unhandled_exception (snapshot_result);
+
+    jerry_release_value (snapshot_result);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  size_t snapshot_size = (size_t) jerry_get_number_value (snapshot_result);
+  jerry_release_value (snapshot_result);
+
+  jerry_cleanup ();
+  return snapshot_size;
+} /* generate_snapshot */
+
+/**
+ * Generate the snapshots of a range of source files and append them to a
+ * temporary file. Each snapshot is preceded by its size, and padded to 4 bytes.
+ *
+ * @return true - if all snapshots are generated successfully
+ *         false - otherwise
+ */
+static bool
+generate_snapshot_list (const generate_settings_t *settings_p, /**< generation settings */
+                        const char **file_names_p, /**< source file names */
+                        uint32_t number_of_files, /**< number of source files */
+                        FILE *result_file_p) /**< temporary file of the results */
+{
+  for (uint32_t i = 0; i < number_of_files; i++)
+  {
+    size_t snapshot_size = generate_snapshot (settings_p, file_names_p[i]);
+
+    if (snapshot_size == 0)
+    {
+      return false;
+    }
+
+    uint32_t record_size = (uint32_t) snapshot_size;
+    size_t padded_size = (snapshot_size + sizeof (uint32_t) - 1) & ~(sizeof (uint32_t) - 1);
+
+    if (fwrite (&record_size, sizeof (uint32_t), 1, result_file_p) != 1
+        || fwrite (output_buffer, 1u, padded_size, result_file_p) != padded_size)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot write temporary snapshot file\n");
+      return false;
+    }
+  }
+
+  return fflush (result_file_p) == 0;
+} /* generate_snapshot_list */
+
+/**
+ * Generate the snapshots of multiple source files in worker processes,
+ * and merge them into a single snapshot.
+ *
+ * Note:
+ *   each worker compiles a contiguous range of the files with its own engine instance,
+ *   so the functions of the merged snapshot follow the order of the source files
+ *
+ * @return error code (0 - no error)
+ */
+static int
+generate_merged_snapshot (const generate_settings_t *settings_p, /**< generation settings */
+                          const char **file_names_p, /**< source file names */
+                          uint32_t number_of_files, /**< number of source files */
+                          uint32_t number_of_jobs) /**< number of worker processes */
+{
+  if (number_of_jobs > number_of_files)
+  {
+    number_of_jobs = number_of_files;
+  }
+
+#ifndef SNAPSHOT_HAS_FORK
+  /* Without processes the files are compiled one after the other. */
+  number_of_jobs = 1;
+#endif /* !SNAPSHOT_HAS_FORK */
+
+  JERRY_VLA (FILE *, result_files_p, number_of_jobs);
+  int result = JERRY_STANDALONE_EXIT_CODE_OK;
+  uint32_t number_of_results = 0;
+
+  for (uint32_t i = 0; i < number_of_jobs; i++)
+  {
+    result_files_p[i] = tmpfile ();
+
+    if (result_files_p[i] == NULL)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot create temporary snapshot file\n");
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    number_of_results++;
+  }
+
+#ifdef SNAPSHOT_HAS_FORK
+  JERRY_VLA (pid_t, workers, number_of_jobs);
+
+  for (uint32_t i = 0; i < number_of_jobs; i++)
+  {
+    workers[i] = -1;
+  }
+#endif /* SNAPSHOT_HAS_FORK */
+
+  for (uint32_t i = 0; i < number_of_jobs && result == JERRY_STANDALONE_EXIT_CODE_OK; i++)
+  {
+    uint32_t first_file = (uint32_t) (((uint64_t) number_of_files * i) / number_of_jobs);
+    uint32_t end_file = (uint32_t) (((uint64_t) number_of_files * (i + 1)) / number_of_jobs);
+
+#ifdef SNAPSHOT_HAS_FORK
+    if (number_of_jobs > 1)
+    {
+      /* Buffered output must not be duplicated by the worker. */
+      fflush (stdout);
+      fflush (stderr);
+
+      workers[i] = fork ();
+
+      if (workers[i] == 0)
+      {
+        bool is_success = generate_snapshot_list (settings_p,
+                                                  file_names_p + first_file,
+                                                  end_file - first_file,
+                                                  result_files_p[i]);
+        fflush (stdout);
+        _exit (is_success ? JERRY_STANDALONE_EXIT_CODE_OK : JERRY_STANDALONE_EXIT_CODE_FAIL);
+      }
+    }
+
+    if (workers[i] > 0)
+    {
+      continue;
+    }
+#endif /* SNAPSHOT_HAS_FORK */
+
+    /* Compile the files in this process if no worker is started. */
+    if (!generate_snapshot_list (settings_p, file_names_p + first_file, end_file - first_file, result_files_p[i]))
+    {
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+  }
+
+#ifdef SNAPSHOT_HAS_FORK
+  for (uint32_t i = 0; i < number_of_jobs; i++)
+  {
+    int status;
+
+    if (workers[i] > 0
+        && (waitpid (workers[i], &status, 0) != workers[i]
+            || !WIFEXITED (status)
+            || WEXITSTATUS (status) != JERRY_STANDALONE_EXIT_CODE_OK))
+    {
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+  }
+#endif /* SNAPSHOT_HAS_FORK */
+
+  size_t total_size = 0;
+
+  for (uint32_t i = 0; i < number_of_results && result == JERRY_STANDALONE_EXIT_CODE_OK; i++)
+  {
+    long size = (fseek (result_files_p[i], 0, SEEK_END) == 0) ? ftell (result_files_p[i]) : -1;
+
+    if (size < 0)
+    {
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    total_size += (size_t) size;
+  }
+
+  uint32_t *snapshots_p = NULL;
+  uint32_t *merged_snapshot_p = NULL;
+  size_t merged_buffer_size = total_size + sizeof (uint32_t) * 16;
+
+  if (result == JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    snapshots_p = (uint32_t *) malloc (total_size);
+    merged_snapshot_p = (uint32_t *) malloc (merged_buffer_size);
+
+    if (snapshots_p == NULL || merged_snapshot_p == NULL)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: out of memory\n");
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+  }
+
+  JERRY_VLA (const uint32_t *, snapshot_buffers, number_of_files);
+  JERRY_VLA (size_t, snapshot_buffer_sizes, number_of_files);
+  uint32_t number_of_snapshots = 0;
+  size_t read_size = 0;
+
+  for (uint32_t i = 0; i < number_of_results && result == JERRY_STANDALONE_EXIT_CODE_OK; i++)
+  {
+    long size = ftell (result_files_p[i]);
+    uint8_t *data_p = ((uint8_t *) snapshots_p) + read_size;
+
+    rewind (result_files_p[i]);
+
+    if (fread (data_p, 1u, (size_t) size, result_files_p[i]) != (size_t) size)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot read temporary snapshot file\n");
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    read_size += (size_t) size;
+
+    while (data_p < ((uint8_t *) snapshots_p) + read_size)
+    {
+      uint32_t record_size = *(uint32_t *) data_p;
+      data_p += sizeof (uint32_t);
+
+      snapshot_buffers[number_of_snapshots] = (const uint32_t *) data_p;
+      snapshot_buffer_sizes[number_of_snapshots] = record_size;
+      number_of_snapshots++;
+
+      data_p += (record_size + sizeof (uint32_t) - 1) & ~(sizeof (uint32_t) - 1);
+    }
+  }
+
+  for (uint32_t i = 0; i < number_of_results; i++)
+  {
+    fclose (result_files_p[i]);
+  }
+
+  size_t merged_snapshot_size = 0;
+
+  if (result == JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    assert (number_of_snapshots == number_of_files);
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    const char *error_p = NULL;
+    merged_snapshot_size = jerry_merge_snapshots (snapshot_buffers,
+                                                  snapshot_buffer_sizes,
+                                                  number_of_snapshots,
+                                                  merged_snapshot_p,
+                                                  merged_buffer_size,
+                                                  &error_p);
+    jerry_cleanup ();
+
+    if (merged_snapshot_size == 0)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: %s\n", error_p);
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+  }
+
+  if (result == JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    FILE *snapshot_file_p = fopen (output_file_name_p, "wb");
+
+    if (snapshot_file_p == NULL)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Unable to write snapshot file: '%s'\n", output_file_name_p);
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+    else
+    {
+      fwrite (merged_snapshot_p, sizeof (uint8_t), merged_snapshot_size, snapshot_file_p);
+      fclose (snapshot_file_p);
+
+      printf ("Created snapshot file: '%s' (%zu bytes) from %u input files\n",
+              output_file_name_p,
+              merged_snapshot_size,
+              (unsigned int) number_of_files);
+    }
+  }
+
+  free (snapshots_p);
+  free (merged_snapshot_p);
+  return result;
+} /* generate_merged_snapshot */
+
 /**
  * Process 'generate' command.
  *
@@ -236,16 +650,16 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
                   int argc, /**< number of arguments */
                   char *prog_name_p) /**< program name */
 {
-  (void) argc;
-
-  uint32_t snapshot_flags = 0;
-  jerry_init_flag_t flags = JERRY_INIT_EMPTY;
+  generate_settings_t settings;
+  settings.init_flags = JERRY_INIT_EMPTY;
+  settings.snapshot_flags = 0;
+  settings.function_args_p = NULL;
+  settings.num_of_literals = 0;
 
-  const char *file_name_p = NULL;
-  uint8_t *source_p = input_buffer;
-  size_t source_length = 0;
+  JERRY_VLA (const char *, file_names_p, argc);
+  uint32_t number_of_files = 0;
+  uint32_t number_of_jobs = 1;
   const char *literals_file_name_p = NULL;
-  const char *function_args_p = NULL;
 
   cli_change_opts (cli_state_p, generate_opts);
 
@@ -260,12 +674,12 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
       }
       case OPT_GENERATE_STATIC:
       {
-        snapshot_flags |= JERRY_SNAPSHOT_SAVE_STATIC;
+        settings.snapshot_flags |= JERRY_SNAPSHOT_SAVE_STATIC;
         break;
       }
       case OPT_GENERATE_FUNCTION:
       {
-        function_args_p = cli_consume_string (cli_state_p);
+        settings.function_args_p = cli_consume_string (cli_state_p);
         break;
       }
       case OPT_IMPORT_LITERAL_LIST:
@@ -278,10 +692,23 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
         if (check_feature (JERRY_FEATURE_PARSER_DUMP, cli_state_p->arg))
         {
           jerry_port_default_set_log_level (JERRY_LOG_LEVEL_DEBUG);
-          flags |= JERRY_INIT_SHOW_OPCODES;
+          settings.init_flags |= JERRY_INIT_SHOW_OPCODES;
         }
         break;
       }
+      case OPT_GENERATE_JOBS:
+      {
+        int jobs = cli_consume_int (cli_state_p);
+
+        if (cli_state_p->error == NULL && jobs < 1)
+        {
+          cli_state_p->error = "Number of jobs must be positive";
+          cli_state_p->arg = NULL;
+        }
+
+        number_of_jobs = (uint32_t) jobs;
+        break;
+      }
       case OPT_GENERATE_OUT:
       {
         output_file_name_p = cli_consume_string (cli_state_p);
@@ -289,24 +716,7 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
       }
       case CLI_OPT_DEFAULT:
       {
-        if (file_name_p != NULL)
-        {
-          jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Exactly one input file must be specified\n");
-          return JERRY_STANDALONE_EXIT_CODE_FAIL;
-        }
-
-        file_name_p = cli_consume_string (cli_state_p);
-
-        if (cli_state_p->error == NULL)
-        {
-          source_length = read_file (source_p, file_name_p);
-
-          if (source_length == 0)
-          {
-            jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Input file is empty\n");
-            return JERRY_STANDALONE_EXIT_CODE_FAIL;
-          }
-        }
+        file_names_p[number_of_files++] = cli_consume_string (cli_state_p);
         break;
       }
       default:
@@ -322,107 +732,38 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
-  if (file_name_p == NULL)
+  if (number_of_files == 0)
   {
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Exactly one input file must be specified\n");
-    return JERRY_STANDALONE_EXIT_CODE_FAIL;
-  }
-
-#if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
-  context_init ();
-#endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
-
-  jerry_init (flags);
-
-  if (!jerry_is_valid_utf8_string (source_p, (jerry_size_t) source_length))
-  {
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Input must be a valid UTF-8 string.\n");
-    jerry_cleanup ();
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: At least one input file must be specified\n");
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
   if (literals_file_name_p != NULL)
   {
-    /* Import literal list */
-    uint8_t *sp_buffer_start_p = source_p + source_length + 1;
-    size_t sp_buffer_size = read_file (sp_buffer_start_p, literals_file_name_p);
-
-    if (sp_buffer_size > 0)
-    {
-      const char *sp_buffer_p = (const char *) sp_buffer_start_p;
-      uint32_t num_of_lit = 0;
-
-      do
-      {
-        char *sp_buffer_end_p = NULL;
-        jerry_length_t mstr_size = (jerry_length_t) strtol (sp_buffer_p, &sp_buffer_end_p, 10);
-        if (mstr_size > 0)
-        {
-          magic_string_items[num_of_lit] = (jerry_char_t *) (sp_buffer_end_p + 1);
-          magic_string_lengths[num_of_lit] = mstr_size;
-          num_of_lit++;
-        }
-        sp_buffer_p = sp_buffer_end_p + mstr_size + 1;
-      }
-      while ((size_t) (sp_buffer_p - (char *) sp_buffer_start_p) < sp_buffer_size);
-
-      if (num_of_lit > 0)
-      {
-        jerry_register_magic_strings (magic_string_items, num_of_lit,
-                                      magic_string_lengths);
-      }
-    }
+    settings.num_of_literals = import_literal_list (literals_file_name_p);
   }
 
-  jerry_value_t snapshot_result;
-
-  jerry_parse_options_t parse_options;
-  parse_options.options = JERRY_PARSE_HAS_RESOURCE;
-  parse_options.resource_name_p = (jerry_char_t *) file_name_p;
-  parse_options.resource_name_length = (size_t) strlen (file_name_p);
+#if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
+  /* The context is inherited by the worker processes. */
+  context_init ();
+#endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
 
-  if (function_args_p != NULL)
-  {
-    snapshot_result = jerry_generate_function_snapshot ((jerry_char_t *) source_p,
-                                                        source_length,
-                                                        (const jerry_char_t *) function_args_p,
-                                                        strlen (function_args_p),
-                                                        &parse_options,
-                                                        snapshot_flags,
-                                                        output_buffer,
-                                                        sizeof (output_buffer) / sizeof (uint32_t));
-  }
-  else
+  if (number_of_files > 1)
   {
-    snapshot_result = jerry_generate_snapshot ((jerry_char_t *) source_p,
-                                               source_length,
-                                               &parse_options,
-                                               snapshot_flags,
-                                               output_buffer,
-                                               sizeof (output_buffer) / sizeof (uint32_t));
+    return generate_merged_snapshot (&settings, file_names_p, number_of_files, number_of_jobs);
   }
 
-  if (jerry_value_is_error (snapshot_result))
-  {
-    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Generating snapshot failed!\n");
-
-    snapshot_result = jerry_get_value_from_error (snapshot_result, true);
-
-    print_unhandled_exception (snapshot_result);
+  size_t snapshot_size = generate_snapshot (&settings, file_names_p[0]);
 
-    jerry_release_value (snapshot_result);
-    jerry_cleanup ();
+  if (snapshot_size == 0)
+  {
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
-  size_t snapshot_size = (size_t) jerry_get_number_value (snapshot_result);
-  jerry_release_value (snapshot_result);
-
   FILE *snapshot_file_p = fopen (output_file_name_p, "wb");
   if (snapshot_file_p == NULL)
   {
     jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Unable to write snapshot file: '%s'\n", output_file_name_p);
-    jerry_cleanup ();
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
@@ -430,8 +771,6 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
   fclose (snapshot_file_p);
 
   printf ("Created snapshot file: '%s' (%zu bytes)\n", output_file_name_p, snapshot_size);
-
-  jerry_cleanup ();
   return JERRY_STANDALONE_EXIT_CODE_OK;
 } /* process_generate */
 
@@ -123,7 +123,16 @@ restart:
     }
 
     size_t source_size;
-    uint8_t *source_p = jerry_port_read_source (file_path_p, &source_size);
+    uint8_t *source_p;
+
+    if (source_file_p->type == SOURCE_SNAPSHOT_MMAP)
+    {
+      source_p = main_map_snapshot (file_path_p, &source_size);
+    }
+    else
+    {
+      source_p = jerry_port_read_source (file_path_p, &source_size);
+    }
 
     if (source_p == NULL)
     {
@@ -142,6 +151,15 @@ restart:
         jerry_port_release_source (source_p);
         break;
       }
+      case SOURCE_SNAPSHOT_MMAP:
+      {
+        /* The mapping is released by main_unmap_snapshots after the engine is cleaned up. */
+        ret_value = jerry_exec_snapshot ((uint32_t *) source_p,
+                                         source_size,
+                                         source_file_p->snapshot_index,
+                                         JERRY_SNAPSHOT_EXEC_ALLOW_STATIC | JERRY_SNAPSHOT_EXEC_LAZY_LOAD);
+        break;
+      }
       default:
       {
         assert (source_file_p->type == SOURCE_SCRIPT
@@ -181,6 +199,7 @@ restart:
       if (main_is_value_reset (ret_value))
       {
         jerry_cleanup ();
+        main_unmap_snapshots ();
 
         goto restart;
       }
@@ -220,6 +239,7 @@ restart:
           || main_is_value_reset (ret_value))
       {
         jerry_cleanup ();
+        main_unmap_snapshots ();
         goto restart;
       }
 
@@ -367,6 +387,7 @@ restart:
 
 exit:
   jerry_cleanup ();
+  main_unmap_snapshots ();
 
 #if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
   free (context_p);
@@ -44,6 +44,7 @@ typedef enum
   OPT_DEBUGGER_WAIT_SOURCE,
   OPT_EXEC_SNAP,
   OPT_EXEC_SNAP_FUNC,
+  OPT_EXEC_SNAP_MMAP,
   OPT_MODULE,
   OPT_LOG_LEVEL,
   OPT_NO_PROMPT,
@@ -86,6 +87,8 @@ static const cli_opt_t main_opts[] =
                .help = "execute input snapshot file(s)"),
   CLI_OPT_DEF (.id = OPT_EXEC_SNAP_FUNC, .longopt = "exec-snapshot-func", .meta = "FILE NUM",
                .help = "execute specific function from input snapshot file(s)"),
+  CLI_OPT_DEF (.id = OPT_EXEC_SNAP_MMAP, .longopt = "exec-snapshot-mmap", .meta = "FILE",
+               .help = "execute input snapshot file(s) mapped into the memory, loading functions on first use"),
   CLI_OPT_DEF (.id = OPT_MODULE, .opt = "m", .longopt = "module", .meta = "FILE",
                .help = "execute module file"),
   CLI_OPT_DEF (.id = OPT_LOG_LEVEL, .longopt = "log-level", .meta = "NUM",
@@ -310,6 +313,23 @@ main_parse_args (int argc, /**< argc */
 
         break;
       }
+      case OPT_EXEC_SNAP_MMAP:
+      {
+        const bool is_enabled = check_feature (JERRY_FEATURE_SNAPSHOT_EXEC, cli_state.arg);
+        const uint32_t path_index = cli_consume_path (&cli_state);
+
+        if (is_enabled)
+        {
+          main_source_t *source_p = arguments_p->sources_p + arguments_p->source_count;
+          arguments_p->source_count++;
+
+          source_p->type = SOURCE_SNAPSHOT_MMAP;
+          source_p->path_index = path_index;
+          source_p->snapshot_index = 0;
+        }
+
+        break;
+      }
       case OPT_MODULE:
       {
         const uint32_t path_index = cli_consume_path (&cli_state);
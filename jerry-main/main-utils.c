@@ -18,6 +18,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined (__unix__) || defined (__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAIN_HAS_MMAP 1
+#endif /* __unix__ || __APPLE__ */
+
 #include "jerryscript.h"
 #include "jerryscript-ext/debugger.h"
 #include "jerryscript-ext/handler.h"
@@ -539,3 +547,114 @@ main_is_value_reset (jerry_value_t value) /**< jerry value */
   jerry_release_value (abort_value);
   return is_reset;
 } /* main_is_value_reset */
+
+/**
+ * Snapshot file which must be kept in the memory until the engine is cleaned up.
+ */
+typedef struct main_snapshot_mapping_t
+{
+  struct main_snapshot_mapping_t *next_p; /**< next mapping */
+  uint8_t *buffer_p; /**< snapshot data */
+  size_t size; /**< size of the snapshot data */
+} main_snapshot_mapping_t;
+
+/**
+ * List of mapped snapshot files.
+ */
+static main_snapshot_mapping_t *main_snapshot_mappings_p = NULL;
+
+/**
+ * Map a snapshot file into the memory read-only. The pages of the file are
+ * loaded by the operating system when they are first accessed, so only the
+ * used parts of large snapshots are read. When memory mapping is not
+ * available, the file is read into the memory instead.
+ *
+ * Note: the mapping is kept until main_unmap_snapshots is called
+ *
+ * @return pointer to the snapshot data - if successful
+ *         NULL - otherwise
+ */
+uint8_t *
+main_map_snapshot (const char *file_path_p, /**< file path */
+                   size_t *out_size_p) /**< [out] size of the snapshot */
+{
+  main_snapshot_mapping_t *mapping_p = (main_snapshot_mapping_t *) malloc (sizeof (main_snapshot_mapping_t));
+
+  if (mapping_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to allocate memory for file: %s\n", file_path_p);
+    return NULL;
+  }
+
+#ifdef MAIN_HAS_MMAP
+  int fd = open (file_path_p, O_RDONLY);
+  struct stat stat_buffer;
+
+  if (fd == -1 || fstat (fd, &stat_buffer) == -1 || !S_ISREG (stat_buffer.st_mode) || stat_buffer.st_size == 0)
+  {
+    if (fd != -1)
+    {
+      close (fd);
+    }
+
+    free (mapping_p);
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to open file: %s\n", file_path_p);
+    return NULL;
+  }
+
+  size_t size = (size_t) stat_buffer.st_size;
+  void *buffer_p = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+
+  if (buffer_p == MAP_FAILED)
+  {
+    free (mapping_p);
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: Failed to map file: %s\n", file_path_p);
+    return NULL;
+  }
+
+  mapping_p->buffer_p = (uint8_t *) buffer_p;
+  mapping_p->size = size;
+#else /* !MAIN_HAS_MMAP */
+  mapping_p->buffer_p = jerry_port_read_source (file_path_p, &mapping_p->size);
+
+  if (mapping_p->buffer_p == NULL)
+  {
+    free (mapping_p);
+    return NULL;
+  }
+#endif /* MAIN_HAS_MMAP */
+
+  mapping_p->next_p = main_snapshot_mappings_p;
+  main_snapshot_mappings_p = mapping_p;
+
+  *out_size_p = mapping_p->size;
+  return mapping_p->buffer_p;
+} /* main_map_snapshot */
+
+/**
+ * Release all snapshot files mapped by main_map_snapshot.
+ *
+ * Note: must be called after the engine is cleaned up
+ */
+void
+main_unmap_snapshots (void)
+{
+  main_snapshot_mapping_t *mapping_p = main_snapshot_mappings_p;
+
+  while (mapping_p != NULL)
+  {
+    main_snapshot_mapping_t *next_p = mapping_p->next_p;
+
+#ifdef MAIN_HAS_MMAP
+    munmap (mapping_p->buffer_p, mapping_p->size);
+#else /* !MAIN_HAS_MMAP */
+    jerry_port_release_source (mapping_p->buffer_p);
+#endif /* MAIN_HAS_MMAP */
+
+    free (mapping_p);
+    mapping_p = next_p;
+  }
+
+  main_snapshot_mappings_p = NULL;
+} /* main_unmap_snapshots */
@@ -39,4 +39,9 @@ main_wait_for_source_callback (const jerry_char_t *resource_name_p,
 bool
 main_is_value_reset (jerry_value_t value);
 
+uint8_t *
+main_map_snapshot (const char *file_path_p, size_t *out_size_p);
+void
+main_unmap_snapshots (void);
+
 #endif /* !MAIN_UTILS_H */
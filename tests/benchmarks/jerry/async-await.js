@@ -0,0 +1,39 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Awaits plain values and settled native promises one million times. */
+var settled = Promise.resolve (1);
+var sum = 0;
+
+async function add (count)
+{
+  for (var i = 0; i < count; i++)
+  {
+    sum += await i;
+    sum += await settled;
+  }
+}
+
+async function run ()
+{
+  for (var i = 0; i < 10; i++)
+  {
+    await add (50000);
+  }
+
+  assert (sum === 10 * (50000 * 49999 / 2 + 50000));
+}
+
+run ();
@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Formats a table of dates with the local time getters. */
+var time = Date.UTC (2020, 0, 1);
+var length = 0;
+var hours = 0;
+
+for (var i = 0; i < 100000; i++)
+{
+  var date = new Date (time);
+
+  hours += date.getHours ();
+  length += date.toString ().length;
+  length += (date.getFullYear () + "-" + (date.getMonth () + 1) + "-" + date.getDate ()).length;
+
+  time += 20 * 60 * 1000;
+}
+
+assert (hours > 0);
+assert (length > 100000 * 30);
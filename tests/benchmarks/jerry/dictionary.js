@@ -0,0 +1,50 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Objects used as dictionaries with mixed insert, lookup and delete
+ * operations at 10k to 100k keys. */
+
+function run (size) {
+  var dict = {};
+  var hits = 0;
+
+  for (var i = 0; i < size; i++) {
+    dict["key" + i] = i;
+  }
+
+  for (var round = 0; round < 4; round++) {
+    for (var i = round; i < size; i += 4) {
+      delete dict["key" + i];
+      dict["new" + round + "_" + i] = i;
+    }
+
+    for (var i = 0; i < size; i += 3) {
+      if (dict["key" + i] !== undefined) {
+        hits++;
+      }
+    }
+  }
+
+  for (var i = 0; i < size; i++) {
+    delete dict["new" + (i % 4) + "_" + i];
+  }
+
+  assert (Object.keys (dict).length === 0);
+  return hits;
+}
+
+assert (run (10000) > 0);
+assert (run (30000) > 0);
+assert (run (100000) > 0);
@@ -0,0 +1,89 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Floating point heavy loops: a low-pass filter over sensor samples,
+ * a compound interest table and a 2D particle integration. */
+
+function filter (count) {
+  var value = 0.5;
+  var smoothed = 0;
+
+  for (var i = 0; i < count; i++) {
+    value = value * 1.0001 + 0.03;
+    if (value > 10.5) {
+      value -= 10.25;
+    }
+    smoothed += (value - smoothed) * 0.125;
+  }
+
+  return smoothed;
+}
+
+function interest (years) {
+  var total = 0;
+
+  for (var rate = 0.5; rate < 10; rate += 0.25) {
+    var balance = 1000.75;
+
+    for (var month = 0; month < years * 12; month++) {
+      balance += balance * rate / 1200;
+    }
+
+    total += balance;
+  }
+
+  return total;
+}
+
+function particles (steps) {
+  var xs = [];
+  var ys = [];
+  var vxs = [];
+  var vys = [];
+
+  for (var i = 0; i < 16; i++) {
+    xs.push (i * 0.5);
+    ys.push (i * 0.25);
+    vxs.push (0.1 + i * 0.01);
+    vys.push (0.2 - i * 0.01);
+  }
+
+  for (var step = 0; step < steps; step++) {
+    for (var j = 0; j < 16; j++) {
+      vys[j] -= 0.0981;
+      xs[j] += vxs[j] * 0.01;
+      ys[j] += vys[j] * 0.01;
+
+      if (ys[j] < 0) {
+        ys[j] = -ys[j];
+        vys[j] = -vys[j] * 0.9;
+      }
+    }
+  }
+
+  var sum = 0;
+  for (var k = 0; k < 16; k++) {
+    sum += xs[k] + ys[k];
+  }
+  return sum;
+}
+
+var smoothed = filter (300000);
+assert (smoothed > 0 && smoothed < 11);
+
+var total = interest (20);
+assert (total > 38 * 1000);
+
+var sum = particles (20000);
+assert (sum === sum && sum > 0);
@@ -0,0 +1,42 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures the marking time of a deep object graph.
+ * Needs a big heap, e.g. --cpointer-32bit=on --mem-heap=131072 */
+var count = 1000000;
+var head = { next: null };
+var tail = head;
+
+/* Each node references a newer object, which is the worst case
+ * for rescanning the object list of the garbage collector. */
+for (var i = 1; i < count; i++)
+{
+  tail.next = { next: null };
+  tail = tail.next;
+}
+
+var start = Date.now();
+gc();
+print("first gc of " + count + " linked objects: " + (Date.now() - start) + " ms");
+
+var runs = 5;
+start = Date.now();
+
+for (var i = 0; i < runs; i++)
+{
+  gc();
+}
+
+print("average gc of " + count + " linked objects: " + ((Date.now() - start) / runs).toFixed(1) + " ms");
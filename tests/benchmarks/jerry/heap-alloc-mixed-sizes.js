@@ -0,0 +1,53 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Allocates and frees many small blocks of different sizes while a set of
+ * long living objects keeps the free list of the heap fragmented. */
+var survivors = [];
+var rounds = 200;
+var start = Date.now();
+
+for (var r = 0; r < rounds; r++)
+{
+  var temp = [];
+
+  for (var i = 0; i < 500; i++)
+  {
+    var len = (i * 13 + r) % 40;
+    var obj = { index: i, round: r };
+
+    for (var j = 0; j < len % 8; j++)
+    {
+      obj["p" + j] = j;
+    }
+
+    temp.push(obj);
+    temp.push("s" + i + "_".repeat(len) + r);
+    temp.push([i, len, r].concat(temp.length & 7 ? [] : [0, 1, 2, 3]));
+  }
+
+  /* Keep every 64th allocation alive to fragment the heap. */
+  for (var i = 0; i < temp.length; i += 64)
+  {
+    survivors.push(temp[i]);
+  }
+
+  if (survivors.length > 2000)
+  {
+    survivors.splice(0, 1000);
+  }
+}
+
+print("heap-alloc-mixed-sizes: " + (Date.now() - start) + " ms");
@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Serializes a large document of records, arrays and numbers. */
+var records = [];
+
+for (var i = 0; i < 25000; i++)
+{
+  records.push ({
+    id: i,
+    name: "record-" + i,
+    active: (i % 3) === 0,
+    score: i / 7,
+    tags: ["alpha", "beta", "gamma"],
+    position: { x: i * 0.5, y: -i, label: "point \"" + i + "\"" }
+  });
+}
+
+var start = Date.now();
+var size = 0;
+
+for (var i = 0; i < 5; i++)
+{
+  size = JSON.stringify (records).length;
+}
+
+print("stringify: " + (Date.now() - start) + " ms, " + size + " bytes");
+assert (size > 4000000);
@@ -0,0 +1,45 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Startup of a library bundle: many functions are defined,
+ * but only a few of them are called. */
+
+function createBundle (count) {
+  var source = "var exports = {};\n";
+
+  for (var i = 0; i < count; i++) {
+    source += "exports.f" + i + " = function (a, b, c) {\n"
+              + "  var result = [];\n"
+              + "  for (var i = 0; i < a; i++) {\n"
+              + "    if (i % 3 === 0) { result.push(b + i * " + i + "); }\n"
+              + "    else if (i % 3 === 1) { result.push(c.length + i); }\n"
+              + "    else { result.push(String(i) + '" + i + "'); }\n"
+              + "  }\n"
+              + "  return result.length > 0 ? result.join(',') : null;\n"
+              + "};\n";
+  }
+
+  return source + "return exports;\n";
+}
+
+var bundle = createBundle (400);
+var sum = 0;
+
+for (var i = 0; i < 40; i++) {
+  var exports = Function (bundle) ();
+  sum += exports.f0 (5, 1, "x").length;
+  sum += exports.f1 (5, 2, "y").length;
+}
+
+assert (sum === 800);
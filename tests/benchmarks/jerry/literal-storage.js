@@ -0,0 +1,41 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures the parse time of a source with many unique string and number literals.
+ * Needs a big heap, e.g. --cpointer-32bit=on --mem-heap=131072 */
+var count = 50000;
+var per_function = 5000;
+var source = "";
+
+for (var i = 0; i < count; i += per_function)
+{
+  var literals = [];
+
+  for (var j = i; j < i + per_function; j += 2)
+  {
+    literals.push ("'literal_" + j + "'");
+    literals.push ((j + 1) + ".5");
+  }
+
+  source += "function f" + i + " () { return [" + literals.join (",") + "]; }\n";
+}
+
+var start = Date.now();
+new Function (source);
+print("parse of " + count + " unique literals: " + (Date.now() - start) + " ms");
+
+start = Date.now();
+new Function (source);
+print("parse of " + count + " known literals: " + (Date.now() - start) + " ms");
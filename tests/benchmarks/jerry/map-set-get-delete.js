@@ -0,0 +1,42 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The largest map needs a bigger heap, e.g. --cpointer-32bit=on --mem-heap=8192 */
+var sizes = [10, 100, 1000, 10000, 100000];
+var ops = 100000;
+
+for (var s = 0; s < sizes.length; s++)
+{
+  var size = sizes[s];
+  var map = new Map();
+
+  for (var i = 0; i < size; i++)
+  {
+    map.set(i * 7, i);
+  }
+
+  var start = Date.now();
+
+  for (var i = 0; i < ops; i++)
+  {
+    var key = (i % size) * 7;
+    map.get(key);
+    map.has(key + 1);
+    map.delete(key);
+    map.set(key, i);
+  }
+
+  var elapsed = Date.now() - start;
+  print(size + " keys: " + (elapsed * 1000000 / (ops * 4)).toFixed(1) + " ns/op");
+}
@@ -0,0 +1,53 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures the parse time of a minified function body which
+ * refers to a large number of short identifiers and keys. */
+var letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+var count = 1200;
+var names = [];
+
+for (var i = 0; i < count; i++)
+{
+  var name = "";
+  var value = i;
+
+  do
+  {
+    name += letters[value % letters.length];
+    value = Math.floor (value / letters.length);
+  }
+  while (value > 0);
+
+  names.push (name + "$");
+}
+
+var source = "var " + names.join ("=0,") + "=0;";
+
+for (var i = 0; i < 2400; i++)
+{
+  var left = names[(i * 7) % count];
+  var right = names[(i * 13) % count];
+  source += left + "=" + right + "+" + left + "['k" + (i % 1000) + "'];";
+}
+
+var start = Date.now();
+
+for (var i = 0; i < 10; i++)
+{
+  new Function (source);
+}
+
+print("parse of " + count + " identifiers 10 times: " + (Date.now() - start) + " ms");
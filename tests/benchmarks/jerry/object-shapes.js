@@ -0,0 +1,64 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Many objects created with the same layout by literals and constructors. */
+
+function Particle (a, b, c, d, e, f, g, h)
+{
+  this.a = a;
+  this.b = b;
+  this.c = c;
+  this.d = d;
+  this.e = e;
+  this.f = f;
+  this.g = g;
+  this.h = h;
+}
+
+function run ()
+{
+  var records = [];
+  var particles = [];
+  var sum = 0;
+
+  for (var i = 0; i < 1500; i++)
+  {
+    records.push ({ x: i, y: i + 1, z: i + 2 });
+  }
+
+  for (var i = 0; i < 500; i++)
+  {
+    particles.push (new Particle (i, i, i, i, i, i, i, i));
+  }
+
+  for (var round = 0; round < 200; round++)
+  {
+    for (var i = 0; i < records.length; i++)
+    {
+      var r = records[i];
+      sum ^= r.x ^ r.y ^ r.z;
+    }
+
+    for (var i = 0; i < particles.length; i++)
+    {
+      var p = particles[i];
+      sum ^= p.h ^ p.e ^ p.a;
+    }
+  }
+
+  return sum;
+}
+
+assert (run () !== undefined);
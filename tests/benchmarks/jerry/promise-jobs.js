@@ -0,0 +1,57 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Runs long promise chains and bursts of reaction jobs through the job queue. */
+var rounds = 500;
+var length = 200;
+var count = 0;
+var result = 0;
+
+function step (value)
+{
+  count++;
+  return value + 1;
+}
+
+function run (round)
+{
+  if (round === 0)
+  {
+    assert (result === rounds * length);
+    assert (count === 2 * rounds * length);
+    return;
+  }
+
+  var promise = Promise.resolve (0);
+
+  for (var i = 0; i < length; i++)
+  {
+    promise = promise.then (step);
+  }
+
+  promise.then (function (value) {
+    result += value;
+    run (round - 1);
+  });
+
+  var resolved = Promise.resolve (round);
+
+  for (var i = 0; i < length; i++)
+  {
+    resolved.then (step);
+  }
+}
+
+run (rounds);
@@ -0,0 +1,51 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Monomorphic property gets and sets of own and inherited properties. */
+
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+Point.prototype.scale = 2;
+
+function run ()
+{
+  var points = [];
+
+  for (var i = 0; i < 64; i++)
+  {
+    points.push (new Point (i, i + 1));
+  }
+
+  var sum = 0;
+
+  for (var round = 0; round < 20000; round++)
+  {
+    for (var i = 0; i < 64; i++)
+    {
+      var p = points[i];
+      p.x = (p.y * p.scale) & 0xffff;
+      p.y = (p.x + p.y) & 0xffff;
+      sum += (p.x - p.y) & 0xff;
+    }
+  }
+
+  return sum;
+}
+
+assert (run () > 0);
@@ -0,0 +1,51 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function fib (n) {
+  return n < 2 ? n : fib (n - 1) + fib (n - 2);
+}
+
+assert (fib (30) === 832040);
+
+/* Build a deeply nested JSON document. */
+var json = "";
+for (var i = 0; i < 200; i++) {
+  json += '{"value":' + i + ',"items":[1,2,3],"child":';
+}
+json += "null";
+for (var i = 0; i < 200; i++) {
+  json += "}";
+}
+
+function walk (node) {
+  if (node === null) {
+    return 0;
+  }
+
+  var sum = node.value;
+  for (var i = 0; i < node.items.length; i++) {
+    sum += node.items[i];
+  }
+  return sum + walk (node.child);
+}
+
+var tree = JSON.parse (json);
+var total = 0;
+
+for (var i = 0; i < 500; i++) {
+  total += walk (tree);
+}
+
+assert (total === 500 * (199 * 200 / 2 + 200 * 6));
@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+var fields = [];
+var line = "";
+
+for (var i = 0; i < 24; i++) {
+  fields.push ("field" + i);
+  line += "field" + i + "=" + i * 3 + " ";
+}
+
+var sum = 0;
+
+for (var i = 0; i < 4000; i++) {
+  for (var j = 0; j < fields.length; j++) {
+    var match = new RegExp ("(?:^|\\s)" + fields[j] + "=(\\d+)(?:\\.(\\d+))?(ms|s)?(?=\\s|$)").exec (line);
+    sum += match[1] | 0;
+  }
+}
+
+assert (sum === 4000 * 3 * (23 * 24 / 2));
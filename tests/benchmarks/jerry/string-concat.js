@@ -0,0 +1,32 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Build a 1 MB string from 100k small pieces with repeated '+=',
+ * then read it back. */
+
+function build (count) {
+  var str = "";
+
+  for (var i = 0; i < count; i++) {
+    str += "piece" + (10000 + i % 90000);
+  }
+
+  return str;
+}
+
+var str = build (100000);
+
+assert (str.length === 1000000);
+assert (str.charAt (0) === "p");
+assert (str.slice (-10) === "piece19999");
@@ -0,0 +1,70 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures sequential and nearby index accesses of a non-ASCII string. */
+var parts = [];
+
+for (var i = 0; i < 2000; i++)
+{
+  parts.push ("árvíztűrő tükörfúrógép ");
+}
+
+var text = parts.join ("");
+var length = text.length;
+
+function measure (name, func)
+{
+  var start = Date.now();
+  func ();
+  print(name + ": " + (Date.now() - start) + " ms");
+}
+
+measure ("charCodeAt forward", function () {
+  var sum = 0;
+  for (var i = 0; i < length; i++)
+  {
+    sum += text.charCodeAt (i);
+  }
+  assert (sum > 0);
+});
+
+measure ("charAt backward", function () {
+  var count = 0;
+  for (var i = length - 1; i >= 0; i--)
+  {
+    if (text.charAt (i) === "ő")
+    {
+      count++;
+    }
+  }
+  assert (count === 2000);
+});
+
+measure ("slice tokens", function () {
+  var words = 0;
+  var start = 0;
+  for (var i = 0; i < length; i++)
+  {
+    if (text.charCodeAt (i) === 32)
+    {
+      if (text.slice (start, i).length > 0)
+      {
+        words++;
+      }
+      start = i + 1;
+    }
+  }
+  assert (words === 4000);
+});
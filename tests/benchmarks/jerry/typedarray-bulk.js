@@ -0,0 +1,52 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures bulk TypedArray operations on 16 MB buffers.
+ * Needs a big heap, e.g. --cpointer-32bit=on --mem-heap=131072 */
+var size = 16 * 1024 * 1024;
+
+function measure (name, iterations, func)
+{
+  var start = Date.now();
+
+  for (var i = 0; i < iterations; i++)
+  {
+    func ();
+  }
+
+  print(name + ": " + (Date.now() - start) + " ms");
+}
+
+var bytes = new Uint8Array (size);
+var signed_bytes = new Int8Array (size);
+var words = new Int32Array (size / 4);
+var doubles = new Float64Array (size / 8);
+
+measure ("Uint8Array fill", 10, function () { bytes.fill (7); });
+measure ("Int32Array fill", 10, function () { words.fill (-5); });
+measure ("Float64Array fill", 10, function () { doubles.fill (0.25); });
+
+measure ("Int8Array set from Uint8Array", 10, function () { signed_bytes.set (bytes); });
+assert (signed_bytes[size - 1] === 7);
+
+bytes[size - 1] = 8;
+words[words.length - 1] = 9;
+doubles[doubles.length - 1] = 0.5;
+
+measure ("Uint8Array indexOf", 10, function () { assert (bytes.indexOf (8) === size - 1); });
+measure ("Int32Array indexOf", 10, function () { assert (words.indexOf (9) === words.length - 1); });
+measure ("Float64Array includes", 10, function () { assert (doubles.includes (0.5)); });
+measure ("Float64Array includes NaN", 10, function () { assert (!doubles.includes (NaN)); });
+measure ("Uint8Array copyWithin", 10, function () { bytes.copyWithin (1, 0, size - 1); });
@@ -0,0 +1,48 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Measures the default (comparator-less) sort of large typed arrays.
+ * Needs a big heap, e.g. --cpointer-32bit=on --mem-heap=131072 */
+var length = 1000000;
+var seed = 12345;
+
+function random ()
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed;
+}
+
+function measure (name, array)
+{
+  for (var i = 0; i < array.length; i++)
+  {
+    array[i] = (random () - 1073741824) / 1024;
+  }
+
+  var start = Date.now();
+  array.sort ();
+  print(name + " sort of " + array.length + " elements: " + (Date.now() - start) + " ms");
+
+  for (var i = 1; i < array.length; i++)
+  {
+    assert (array[i - 1] <= array[i]);
+  }
+}
+
+measure ("Float64Array", new Float64Array (length));
+measure ("Float32Array", new Float32Array (length));
+measure ("Int32Array", new Int32Array (length));
+measure ("Uint16Array", new Uint16Array (length));
+measure ("Int8Array", new Int8Array (length));
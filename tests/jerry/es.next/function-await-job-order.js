@@ -0,0 +1,152 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Awaiting a value which is not an object, or a native promise, resumes the
+ * async function after one job. The order of these jobs must match the order
+ * of the promise reaction jobs. */
+var log = [];
+
+function then_chain (name, length)
+{
+  var promise = Promise.resolve ();
+
+  for (var i = 1; i <= length; i++)
+  {
+    promise = promise.then ((function (step) {
+      return function () { log.push (name + step); };
+    }) (i));
+  }
+}
+
+async function primitives ()
+{
+  log.push ("p0");
+  await 1;
+  log.push ("p1");
+  await undefined;
+  log.push ("p2");
+  await "str";
+  log.push ("p3");
+  await null;
+  log.push ("p4");
+  await Symbol ("sym");
+  log.push ("p5");
+}
+
+async function promises ()
+{
+  log.push ("q0");
+  await Promise.resolve (1);
+  log.push ("q1");
+
+  var pending = new Promise (function (resolve) {
+    Promise.resolve ().then (function () {
+      log.push ("resolve");
+      resolve (2);
+    });
+  });
+
+  assert ((await pending) === 2);
+  log.push ("q2");
+
+  try
+  {
+    await Promise.reject (3);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e === 3);
+    log.push ("q3");
+  }
+}
+
+async function mixed ()
+{
+  log.push ("m0");
+  assert ((await 5) === 5);
+  log.push ("m1");
+  assert ((await Promise.resolve (6)) === 6);
+  log.push ("m2");
+  assert ((await 7) === 7);
+  log.push ("m3");
+  return 8;
+}
+
+/* Objects which are not native promises take extra jobs. */
+class SubPromise extends Promise {}
+
+async function others ()
+{
+  log.push ("o0");
+  await SubPromise.resolve (9);
+  log.push ("o1");
+  await { then: function (resolve) { log.push ("then"); resolve (10); } };
+  log.push ("o2");
+}
+
+async function * generator ()
+{
+  log.push ("g0");
+  await 11;
+  log.push ("g1");
+  await Promise.resolve (12);
+  log.push ("g2");
+  await "str";
+  log.push ("g3");
+}
+
+then_chain ("a", 12);
+primitives ();
+promises ();
+mixed ().then (function (value) {
+  assert (value === 8);
+  log.push ("mixed");
+});
+others ();
+
+generator ().next ().then (function (result) {
+  assert (result.done);
+  log.push ("next");
+});
+
+then_chain ("b", 12);
+log.push ("sync");
+
+var expected = [
+  "p0", "q0", "m0", "o0", "g0", "sync",
+  "a1", "p1", "q1", "m1", "g1", "b1",
+  "a2", "p2", "resolve", "m2", "g2", "b2",
+  "a3", "p3", "q2", "m3", "o1", "g3", "b3",
+  "a4", "p4", "q3", "mixed", "then", "next", "b4",
+  "a5", "p5", "o2", "b5",
+  "a6", "b6",
+  "a7", "b7",
+  "a8", "b8",
+  "a9", "b9",
+  "a10", "b10",
+  "a11", "b11",
+  "a12", "b12"
+];
+
+function __checkAsync ()
+{
+  assert (log.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++)
+  {
+    assert (log[i] === expected[i]);
+  }
+}
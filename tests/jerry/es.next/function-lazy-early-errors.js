@@ -0,0 +1,156 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The early errors of nested functions must be reported when the enclosing
+ * code is parsed, even if the functions are never called. */
+
+function must_throw (str)
+{
+  try
+  {
+    Function ("function outer () { " + str + "\n}");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+
+  try
+  {
+    Function ("function outer () { function inner () { " + str + "\n} }");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+function must_not_throw (str)
+{
+  Function ("function outer () { " + str + "\n}");
+  Function ("function outer () { function inner () { " + str + "\n} }");
+}
+
+/* Invalid assignment targets. */
+must_throw ("x + (a) = 1;");
+must_throw ("(a.b) + 1 = 2;");
+must_throw ("new f = 1;");
+must_throw ("new a.b = 1;");
+must_throw ("new a[b] = 1;");
+must_throw ("new f(x) = 1;");
+must_throw ("a() = 1;");
+must_throw ("a`x` = 1;");
+must_throw ("`${a}` = 1;");
+must_throw ("a.b = 1 = 2;");
+must_throw ("(a ? b : c) = 1;");
+must_throw ("void a = 1;");
+must_throw ("f(a = 1 = 2);");
+must_throw ("a[b = 1 = 2];");
+must_throw ("`${a = 1 = 2}`;");
+must_throw ("for (a() in x);");
+must_throw ("for (a + b of x);");
+
+/* Invalid update and unary expressions. */
+must_throw ("++a++;");
+must_throw ("++(a + 1);");
+must_throw ("++-a;");
+must_throw ("--new a;");
+must_throw ("this++;");
+must_throw ("f()++;");
+must_throw ("-a.b ** 2;");
+must_throw ("typeof a[0] ** 2;");
+must_throw ("a ?? b && c;");
+must_throw ("a && b ?? c;");
+must_throw ("'use strict'; delete (x);");
+
+/* Invalid bindings and declarations. */
+must_throw ("[a, ...b,] = c;");
+must_throw ("var [...a, b] = c;");
+must_throw ("var {a, ...b, c} = d;");
+must_throw ("function g (...a, b) {}");
+must_throw ("(...a, b) => 1;");
+must_throw ("let [a.b] = c;");
+must_throw ("var {a: b.c} = d;");
+must_throw ("const a = 1, b;");
+must_throw ("for (const a;;);");
+must_throw ("let [a];");
+must_throw ("({a = 1});");
+must_throw ("x = {a = 1};");
+must_throw ("({ set a () {} });");
+must_throw ("({ get a (b) {} });");
+must_throw ("while (1) let a = 1;");
+must_throw ("if (1) class A {}");
+must_throw ("while (1) function g () {}");
+
+/* Invalid strict mode code. */
+must_throw ("'use strict'; let eval = 1;");
+must_throw ("'use strict'; (function eval () {});");
+must_throw ("'use strict'; (function (arguments) {});");
+must_throw ("'use strict'; eval++;");
+must_throw ("'use strict'; [eval] = a;");
+must_throw ("function g () { 'use strict'; with (a) {} }");
+must_throw ("(function (a = 1) { 'use strict'; });");
+
+/* Invalid control flow and other constructs. */
+must_throw ("if (1) break;");
+must_throw ("a => { break; }");
+must_throw ("(a) => { continue; }");
+must_throw ("switch (1) { case 1: function g () { break; } }");
+must_throw ("while (1) { continue l; }");
+must_throw ("label: label: while (1) ;");
+must_throw ("a = /[/;");
+must_throw ("class A { constructor () { super(); } }");
+must_throw ("switch (a) { case 1: let b; case 2: let b; }");
+
+/* Valid code must still be accepted. */
+must_not_throw ("(a) = 1;");
+must_not_throw ("(a.b) = 1;");
+must_not_throw ("new f().x = 1;");
+must_not_throw ("new f(x).y = 1;");
+must_not_throw ("new (f)().x = 1;");
+must_not_throw ("a`x`.b = 1;");
+must_not_throw ("(-a) ** 2;");
+must_not_throw ("(a ?? b) || c;");
+must_not_throw ("++(a.b);");
+must_not_throw ("'use strict'; delete a[0];");
+must_not_throw ("[a, ...b] = c;");
+must_not_throw ("var {a, ...b} = d;");
+must_not_throw ("function g (a, ...b) {}");
+must_not_throw ("for (const a of x);");
+must_not_throw ("if (1) function g () {}");
+must_not_throw ("a: while (1) { break a; }");
+must_not_throw ("do { continue; } while (0);");
+must_not_throw ("x = { get a () { return 1; }, set a (v) {} };");
+must_not_throw ("({a = 1} = x);");
+must_not_throw ("x = (a, b) => a + b;");
+must_not_throw ("x = function eval () {};");
+must_not_throw ("eval = 1;");
+must_not_throw ("arguments++;");
+must_not_throw ("x = a\n++b");
+
+/* Functions which pass the checks of the scanner are still called correctly. */
+function lazy (a, ...b)
+{
+  function inner (c)
+  {
+    return c + b.length;
+  }
+
+  return inner (a);
+}
+
+assert (lazy (1, 2, 3) === 3);
@@ -0,0 +1,66 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Objects created during an incremental marking may receive references to
+ * unmarked objects without taking a reference (e.g. the fast path of
+ * Array.prototype.slice). These objects must be visited before the marking
+ * ends, otherwise their elements are freed while they are still reachable. */
+function run (round)
+{
+  var head = { next: null };
+  var node = head;
+
+  /* The elements are marked after a long chain of objects. */
+  for (var i = 0; i < 1500; i++)
+  {
+    node.next = { next: null };
+    node = node.next;
+  }
+
+  var elements = [];
+
+  for (var i = 0; i < 64; i++)
+  {
+    elements.push ({ value: round * 64 + i });
+  }
+
+  node.next = elements;
+
+  /* Vary the progress of the marking when the elements are copied. */
+  var churn = [];
+
+  for (var i = 0; i < 200 + round * 37; i++)
+  {
+    churn.push ({ index: i });
+  }
+
+  var copy = elements.slice ();
+  elements.length = 0;
+
+  for (var i = 0; i < 3000; i++)
+  {
+    churn[i % 200] = { index: i, name: "x" + i };
+  }
+
+  for (var i = 0; i < copy.length; i++)
+  {
+    assert (copy[i].value === round * 64 + i);
+  }
+}
+
+for (var round = 0; round < 40; round++)
+{
+  run (round);
+}
@@ -0,0 +1,148 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+var m = new Map();
+var s = new Set();
+var objects = [];
+
+for (var i = 0; i < 1000; i++) {
+  var o = {};
+  objects.push(o);
+  m.set(i, "n" + i);
+  m.set("s" + i, i);
+  m.set(o, i);
+  s.add(i * 0.5);
+}
+
+assert(m.size === 3000);
+assert(s.size === 1000);
+
+for (var i = 0; i < 1000; i++) {
+  assert(m.get(i) === "n" + i);
+  assert(m.get("s" + i) === i);
+  assert(m.get(objects[i]) === i);
+  assert(s.has(i * 0.5));
+  assert(!s.has(i * 0.5 + 0.25));
+}
+
+/* Integer and float representations of the same number. */
+assert(m.get(2.5 * 2) === "n5");
+assert(s.has(1e2 / 100));
+assert(!m.has({}));
+assert(!m.has("s1000"));
+
+/* Zeros and NaN values. */
+m.set(-0, "zero");
+assert(m.get(0) === "zero");
+assert(m.get(-0) === "zero");
+m.set(NaN, "nan");
+assert(m.get(0 / 0) === "nan");
+assert(m.size === 3001);
+
+var b1 = BigInt(12345678901234);
+m.set(b1, "bigint");
+assert(m.get(BigInt("12345678901234")) === "bigint");
+assert(!m.has(BigInt("12345678901235")));
+m.set(BigInt(0), "bigint zero");
+assert(m.get(BigInt(0)) === "bigint zero");
+
+var sym = Symbol("key");
+m.set(sym, "symbol");
+assert(m.get(sym) === "symbol");
+assert(!m.has(Symbol("key")));
+
+/* Delete half of the entries, then re-add some of them. */
+for (var i = 0; i < 1000; i += 2) {
+  assert(m.delete(i));
+  assert(m.delete("s" + i));
+  assert(m.delete(objects[i]));
+  assert(s.delete(i * 0.5));
+  assert(!m.has(i));
+  assert(!s.has(i * 0.5));
+}
+
+assert(m.size === 1504);
+assert(s.size === 500);
+
+for (var i = 1; i < 1000; i += 2) {
+  assert(m.get(i) === "n" + i);
+  assert(m.get(objects[i]) === i);
+  assert(s.has(i * 0.5));
+}
+
+for (var i = 0; i < 100; i += 2) {
+  m.set(i, "again" + i);
+}
+
+/* Iteration order is insertion order, deleted entries are skipped. */
+var expected = 1;
+var count = 0;
+s.forEach(function (value) {
+  assert(value === expected * 0.5);
+  expected += 2;
+  count++;
+});
+assert(count === 500);
+
+var last = null;
+for (var entry of m) {
+  last = entry;
+}
+assert(last[0] === 98 && last[1] === "again98");
+
+m.clear();
+assert(m.size === 0);
+assert(!m.has(1));
+
+for (var i = 0; i < 100; i++) {
+  m.set("k" + i, i);
+}
+
+for (var i = 0; i < 100; i++) {
+  assert(m.get("k" + i) === i);
+}
+
+/* Weak containers use the same index. */
+var wm = new WeakMap();
+var ws = new WeakSet();
+
+for (var i = 0; i < 1000; i++) {
+  wm.set(objects[i], i);
+  ws.add(objects[i]);
+}
+
+for (var i = 0; i < 1000; i++) {
+  assert(wm.get(objects[i]) === i);
+  assert(ws.has(objects[i]));
+}
+
+for (var i = 0; i < 1000; i += 3) {
+  assert(wm.delete(objects[i]));
+  assert(ws.delete(objects[i]));
+}
+
+for (var i = 0; i < 1000; i++) {
+  assert(wm.has(objects[i]) === (i % 3 !== 0));
+  assert(ws.has(objects[i]) === (i % 3 !== 0));
+}
+
+for (var i = 0; i < 500; i++) {
+  wm.set({}, i);
+}
+
+gc();
+
+for (var i = 0; i < 1000; i++) {
+  assert(wm.has(objects[i]) === (i % 3 !== 0));
+}
@@ -0,0 +1,250 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Objects which get the same properties in the same order may share a property
+ * shape. These tests check that the observable behavior stays the same when
+ * objects are converted between shaped and ordinary property lists. */
+
+function makeObject (count, prefix) {
+  var obj = {};
+  for (var i = 0; i < count; i++) {
+    obj[prefix + i] = i;
+  }
+  return obj;
+}
+
+function checkObject (obj, count, prefix) {
+  var keys = Object.keys (obj);
+  assert (keys.length === count);
+  for (var i = 0; i < count; i++) {
+    assert (keys[i] === prefix + i);
+    assert (obj[prefix + i] === i);
+    assert (obj.hasOwnProperty (prefix + i));
+  }
+  assert (obj[prefix + count] === undefined);
+}
+
+/* Property count limit of shaped objects. */
+[0, 1, 2, 31, 32, 33, 34, 40, 64].forEach (function (count) {
+  var a = makeObject (count, "p");
+  var b = makeObject (count, "p");
+  checkObject (a, count, "p");
+  checkObject (b, count, "p");
+
+  a["extra"] = "a";
+  checkObject (b, count, "p");
+  assert (b.extra === undefined);
+  assert (a.extra === "a");
+  assert (Object.keys (a)[count] === "extra");
+});
+
+/* Objects sharing a prefix of their layout. */
+var shared1 = { x: 1, y: 2 };
+var shared2 = { x: 3, y: 4, z: 5 };
+var shared3 = { x: 6, z: 7 };
+assert (JSON.stringify (shared1) === '{"x":1,"y":2}');
+assert (JSON.stringify (shared2) === '{"x":3,"y":4,"z":5}');
+assert (JSON.stringify (shared3) === '{"x":6,"z":7}');
+shared1.z = 8;
+assert (JSON.stringify (shared1) === '{"x":1,"y":2,"z":8}');
+assert (JSON.stringify (shared2) === '{"x":3,"y":4,"z":5}');
+
+/* Deleting a property converts the object, other objects keep the shape. */
+function Point (x, y, z) {
+  this.x = x;
+  this.y = y;
+  this.z = z;
+}
+
+var p1 = new Point (1, 2, 3);
+var p2 = new Point (4, 5, 6);
+assert (delete p1.y);
+assert (p1.y === undefined);
+assert (!p1.hasOwnProperty ("y"));
+assert (JSON.stringify (p1) === '{"x":1,"z":3}');
+assert (JSON.stringify (p2) === '{"x":4,"y":5,"z":6}');
+
+p1.y = 7;
+p1.w = 8;
+assert (Object.keys (p1).join () === "x,z,y,w");
+assert (p1.x + p1.y + p1.z + p1.w === 19);
+
+var p3 = new Point (7, 8, 9);
+assert (JSON.stringify (p3) === '{"x":7,"y":8,"z":9}');
+
+/* Deleting every property, then adding them again. */
+var p4 = new Point (1, 2, 3);
+delete p4.x;
+delete p4.y;
+delete p4.z;
+assert (Object.keys (p4).length === 0);
+p4.z = 1;
+p4.x = 2;
+assert (Object.keys (p4).join () === "z,x");
+
+/* Deleting from a large object. */
+var big = makeObject (32, "q");
+assert (delete big.q0);
+assert (delete big.q31);
+var bigKeys = Object.keys (big);
+assert (bigKeys.length === 30);
+assert (bigKeys[0] === "q1");
+assert (bigKeys[29] === "q30");
+
+/* Integer keys are enumerated first in ascending order, then string keys in creation order. */
+var mixed1 = { b: 1, 2: 2, a: 3, 1: 4 };
+var mixed2 = { b: 5, 2: 6, a: 7, 1: 8 };
+assert (Object.keys (mixed1).join () === "1,2,b,a");
+assert (Object.keys (mixed2).join () === "1,2,b,a");
+assert (JSON.stringify (mixed1) === '{"1":4,"2":2,"b":1,"a":3}');
+assert (Object.getOwnPropertyNames (mixed2).join () === "1,2,b,a");
+
+var symbol = Symbol ("s");
+var withSymbol = { a: 1 };
+withSymbol[symbol] = 2;
+withSymbol.b = 3;
+assert (Object.keys (withSymbol).join () === "a,b");
+assert (Object.getOwnPropertySymbols (withSymbol)[0] === symbol);
+assert (Reflect.ownKeys (withSymbol).length === 3);
+assert (withSymbol[symbol] === 2);
+
+var forIn = [];
+for (var key in new Point (1, 2, 3)) {
+  forIn.push (key);
+}
+assert (forIn.join () === "x,y,z");
+
+/* Internal properties convert the object. */
+var weakKey1 = new Point (1, 2, 3);
+var weakKey2 = new Point (4, 5, 6);
+var weakMap = new WeakMap ();
+weakMap.set (weakKey1, "v");
+assert (weakMap.get (weakKey1) === "v");
+assert (!weakMap.has (weakKey2));
+assert (JSON.stringify (weakKey1) === '{"x":1,"y":2,"z":3}');
+weakKey1.w = 4;
+assert (Object.keys (weakKey1).join () === "x,y,z,w");
+assert (JSON.stringify (weakKey2) === '{"x":4,"y":5,"z":6}');
+
+var weakSet = new WeakSet ();
+var weakSetKey = { a: 1, b: 2 };
+weakSet.add (weakSetKey);
+assert (weakSet.has (weakSetKey));
+assert (weakSetKey.a === 1 && weakSetKey.b === 2);
+weakSet.delete (weakSetKey);
+assert (!weakSet.has (weakSetKey));
+assert (JSON.stringify (weakSetKey) === '{"a":1,"b":2}');
+
+/* Attributes and accessors of shaped properties. */
+var attrs = new Point (1, 2, 3);
+Object.defineProperty (attrs, "y", { enumerable: false });
+assert (Object.keys (attrs).join () === "x,z");
+assert (attrs.y === 2);
+Object.defineProperty (attrs, "x", { writable: false });
+attrs.x = 10;
+assert (attrs.x === 1);
+Object.defineProperty (attrs, "z", { get: function () { return 42; }, configurable: true });
+assert (attrs.z === 42);
+Object.freeze (attrs);
+assert (Object.isFrozen (attrs));
+assert (new Point (1, 2, 3).x === 1);
+
+var frozen = Object.freeze (new Point (1, 2, 3));
+frozen.x = 5;
+assert (frozen.x === 1);
+var sealed = Object.seal (new Point (1, 2, 3));
+assert (!delete sealed.x);
+sealed.x = 5;
+assert (sealed.x === 5);
+
+/* Cached lookups must follow layout changes. */
+function getX (obj) {
+  return obj.x;
+}
+
+function setX (obj, value) {
+  obj.x = value;
+}
+
+var layouts = [
+  { x: 1 },
+  { a: 0, x: 2 },
+  { a: 0, b: 0, x: 3 },
+  new Point (4, 0, 0),
+  Object.create ({ x: 5 }),
+  { y: 0 },
+];
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < layouts.length - 1; i++) {
+    assert (getX (layouts[i]) === i + 1);
+  }
+  assert (getX (layouts[layouts.length - 1]) === undefined);
+}
+
+var cached = new Point (1, 2, 3);
+for (var i = 0; i < 10; i++) {
+  assert (getX (cached) === 1);
+}
+delete cached.x;
+assert (getX (cached) === undefined);
+cached.x = 11;
+assert (getX (cached) === 11);
+
+var cachedProto = { x: "proto" };
+var cachedChild = Object.create (cachedProto);
+cachedChild.y = 1;
+for (var i = 0; i < 10; i++) {
+  assert (getX (cachedChild) === "proto");
+}
+cachedChild.x = "own";
+assert (getX (cachedChild) === "own");
+delete cachedChild.x;
+assert (getX (cachedChild) === "proto");
+
+var setTargets = [new Point (1, 2, 3), new Point (1, 2, 3), { y: 1, x: 2 }];
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < setTargets.length; i++) {
+    setX (setTargets[i], round * 10 + i);
+  }
+}
+assert (setTargets[0].x === 20 && setTargets[1].x === 21 && setTargets[2].x === 22);
+assert (setTargets[0].y === 2 && setTargets[2].y === 1);
+
+var cachedAccessor = new Point (1, 2, 3);
+assert (getX (cachedAccessor) === 1);
+Object.defineProperty (cachedAccessor, "x", { get: function () { return "getter"; } });
+assert (getX (cachedAccessor) === "getter");
+
+var cachedWeak = new Point (1, 2, 3);
+assert (getX (cachedWeak) === 1);
+new WeakMap ().set (cachedWeak, 0);
+assert (getX (cachedWeak) === 1);
+setX (cachedWeak, 2);
+assert (getX (cachedWeak) === 2);
+
+/* Many distinct layouts. */
+var distinct = [];
+for (var i = 0; i < 200; i++) {
+  var obj = {};
+  obj["k" + i] = i;
+  obj.x = i;
+  distinct.push (obj);
+}
+for (var i = 0; i < 200; i++) {
+  assert (distinct[i]["k" + i] === i);
+  assert (getX (distinct[i]) === i);
+  assert (Object.keys (distinct[i]).join () === "k" + i + ",x");
+}
@@ -0,0 +1,172 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function assertArray(array, expected) {
+  assert(array.length === expected.length);
+  for (var i = 0; i < expected.length; i++) {
+    assert(Object.is(array[i], expected[i]));
+  }
+}
+
+/* fill: every element type, subarrays with a non-zero byte offset */
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+             Int32Array, Uint32Array, Float32Array, Float64Array];
+
+types.forEach(function(type) {
+  var buffer = new ArrayBuffer(type.BYTES_PER_ELEMENT * 40);
+  var whole = new type(buffer);
+  var sub = new type(buffer, type.BYTES_PER_ELEMENT * 3, 30);
+
+  sub.fill(7);
+  assert(whole[2] === 0);
+  assert(whole[3] === 7);
+  assert(whole[32] === 7);
+  assert(whole[33] === 0);
+
+  sub.fill(5, 10, 27);
+  assert(whole[12] === 7);
+  assert(whole[13] === 5);
+  assert(whole[29] === 5);
+  assert(whole[30] === 7);
+
+  sub.fill(9, -3);
+  assert(whole[29] === 5);
+  assert(whole[30] === 9);
+  assert(whole[33] === 0);
+});
+
+assertArray(new Int8Array(5).fill(300), [44, 44, 44, 44, 44]);
+assertArray(new Uint8ClampedArray(3).fill(300), [255, 255, 255]);
+assertArray(new Uint8ClampedArray(3).fill(-5.5), [0, 0, 0]);
+assertArray(new Float32Array(3).fill(-0), [-0, -0, -0]);
+assertArray(new Float64Array(17).fill(NaN).subarray(14), [NaN, NaN, NaN]);
+assertArray(new BigInt64Array(4).fill(-3n, 1, 3), [0n, -3n, -3n, 0n]);
+
+/* set: overlapping source and target on the same buffer */
+var buffer = new ArrayBuffer(16);
+var bytes = new Uint8Array(buffer);
+for (var i = 0; i < 16; i++) {
+  bytes[i] = i;
+}
+
+bytes.set(new Uint8Array(buffer, 0, 8), 4);
+assertArray(bytes, [0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15]);
+
+bytes.set(new Int8Array(buffer, 6, 8), 2);
+assertArray(bytes, [0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 6, 7, 12, 13, 14, 15]);
+
+/* set: overlapping with different element types */
+var words = new Uint16Array(buffer);
+for (var i = 0; i < 8; i++) {
+  words[i] = 0x101 * (i + 1);
+}
+
+var halves = new Uint8Array(buffer, 4, 4);
+words.set(halves, 1);
+assertArray(words, [0x101, 3, 3, 4, 4, 0x606, 0x707, 0x808]);
+
+var shorts = new Int16Array(buffer);
+shorts.set(new Uint16Array([0xffff, 0x8000, 0x7fff]), 5);
+assertArray(shorts, [0x101, 3, 3, 4, 4, -1, -32768, 32767]);
+
+/* set: mixed element types keep the conversion semantics */
+var target = new Uint8Array(6);
+target.set(new Int8Array([-1, -128, 127]));
+target.set(new Float64Array([1.9, -0.5, 256]), 3);
+assertArray(target, [255, 128, 127, 1, 0, 0]);
+
+var clamped = new Uint8ClampedArray(4);
+clamped.set(new Int8Array([-1, 100, -128, 127]));
+assertArray(clamped, [0, 100, 0, 127]);
+
+var ints = new Int32Array(3);
+ints.set(new Uint32Array([0xffffffff, 0x80000000, 1]));
+assertArray(ints, [-1, -2147483648, 1]);
+
+var floats = new Float32Array(2);
+floats.set(new Float64Array([0.1, -0]));
+assert(floats[0] === Math.fround(0.1));
+assert(Object.is(floats[1], -0));
+
+var bigints = new BigUint64Array(2);
+bigints.set(new BigInt64Array([-1n, 5n]));
+assertArray(bigints, [18446744073709551615n, 5n]);
+
+/* set: non-zero subarray offsets for both source and target */
+var src = new Int16Array([1, 2, 3, 4, 5, 6]).subarray(2);
+var dst = new Uint16Array(8).subarray(3);
+dst.set(src, 1);
+assertArray(dst, [0, 3, 4, 5, 6]);
+
+/* indexOf / includes: NaN and -0 */
+[Float32Array, Float64Array].forEach(function(type) {
+  var array = new type([1, -0, NaN, 0, 2.5]);
+  assert(array.indexOf(NaN) === -1);
+  assert(array.includes(NaN) === true);
+  assert(array.indexOf(0) === 1);
+  assert(array.indexOf(-0) === 1);
+  assert(array.includes(-0) === true);
+  assert(array.indexOf(0, 2) === 3);
+  assert(array.indexOf(2.5) === 4);
+  assert(array.lastIndexOf(0) === 3);
+  assert(new type([1, 2]).includes(NaN) === false);
+});
+
+types.forEach(function(type) {
+  var array = new type([0, 1, 2, 3, 0]);
+  assert(array.indexOf(-0) === 0);
+  assert(array.includes(-0) === true);
+  assert(array.indexOf(0.5) === -1);
+  assert(array.includes(0.5) === false);
+  assert(array.indexOf(NaN) === -1);
+  assert(array.indexOf("1") === -1);
+  assert(array.indexOf(0, 1) === 4);
+  assert(array.indexOf(3, -2) === 3);
+  assert(array.indexOf(3, -1) === -1);
+});
+
+/* values out of the range of the element type */
+assert(new Int8Array([-1, 127]).indexOf(255) === -1);
+assert(new Uint8Array([255]).indexOf(-1) === -1);
+assert(new Uint8Array([255]).indexOf(255) === 0);
+assert(new Int16Array([-32768]).includes(-32768) === true);
+assert(new Int16Array([-32768]).includes(32768) === false);
+assert(new Uint32Array([0xffffffff]).indexOf(0xffffffff) === 0);
+assert(new Uint32Array([0xffffffff]).indexOf(-1) === -1);
+assert(new Int32Array([-1]).indexOf(0xffffffff) === -1);
+assert(new Float32Array([0.1]).indexOf(0.1) === -1);
+assert(new Float32Array([0.1]).indexOf(Math.fround(0.1)) === 0);
+assert(new Float32Array([Infinity]).includes(Infinity) === true);
+assert(new BigInt64Array([-1n, 2n]).indexOf(-1n) === 0);
+assert(new BigInt64Array([-1n, 2n]).includes(2) === false);
+
+/* indexOf / includes in subarrays with a non-zero byte offset */
+types.forEach(function(type) {
+  var whole = new type([9, 8, 7, 6, 5, 4, 3, 2]);
+  var sub = whole.subarray(3, 7);
+  assert(sub.indexOf(9) === -1);
+  assert(sub.indexOf(6) === 0);
+  assert(sub.indexOf(3) === 3);
+  assert(sub.indexOf(2) === -1);
+  assert(sub.includes(4) === true);
+  assert(sub.includes(8) === false);
+});
+
+var bytes = new Uint8Array(64).subarray(13, 50);
+bytes[30] = 42;
+assert(bytes.indexOf(42) === 30);
+assert(bytes.indexOf(42, 31) === -1);
+assert(bytes.includes(42, -7) === true);
+assert(bytes.includes(42, -6) === false);
@@ -0,0 +1,123 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function assertSorted(array, expected) {
+  array.sort();
+  assert(array.length === expected.length);
+  for (var i = 0; i < expected.length; i++) {
+    assert(Object.is(array[i], expected[i]));
+  }
+}
+
+/* Every element type, with enough elements to use the counting and radix sorts. */
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+             Int32Array, Uint32Array, Float32Array, Float64Array];
+
+var seed = 7;
+
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed;
+}
+
+types.forEach(function(type) {
+  var values = [];
+  for (var i = 0; i < 300; i++) {
+    values.push((random() % 100000) - 50000);
+  }
+
+  var array = new type(values);
+  var expected = Array.prototype.slice.call(array).sort(function(a, b) { return a - b; });
+  assertSorted(array, expected);
+
+  assertSorted(new type([]), []);
+  assertSorted(new type([3]), [3]);
+});
+
+/* Boundary values of the integer types */
+assertSorted(new Int8Array([127, -128, 0, -1, 1]), [-128, -1, 0, 1, 127]);
+assertSorted(new Uint8Array([255, 0, 128, 127]), [0, 127, 128, 255]);
+assertSorted(new Int16Array([32767, -32768, -1, 0]), [-32768, -1, 0, 32767]);
+assertSorted(new Uint16Array([65535, 0, 32768, 32767]), [0, 32767, 32768, 65535]);
+assertSorted(new Int32Array([2147483647, -2147483648, -1, 0]), [-2147483648, -1, 0, 2147483647]);
+assertSorted(new Uint32Array([4294967295, 0, 2147483648, 2147483647]), [0, 2147483647, 2147483648, 4294967295]);
+
+/* NaN goes last, -0 goes before +0 */
+[Float32Array, Float64Array].forEach(function(type) {
+  assertSorted(new type([NaN, 1, -0, Infinity, 0, -Infinity, NaN, -1.5, 0, -0]),
+               [-Infinity, -1.5, -0, -0, 0, 0, 1, Infinity, NaN, NaN]);
+
+  var values = [];
+  for (var i = 0; i < 200; i++) {
+    values.push(i % 3 === 0 ? NaN : (i % 5 === 0 ? -0 : (random() % 2000) / 8 - 125));
+  }
+
+  var array = new type(values);
+  array.sort();
+
+  for (var i = 1; i < array.length; i++) {
+    var prev = array[i - 1];
+    var cur = array[i];
+    assert(isNaN(cur) || (!isNaN(prev) && (prev < cur || (prev === cur && !(Object.is(prev, 0) && Object.is(cur, -0))))));
+  }
+
+  assert(isNaN(array[array.length - 1]));
+  assert(array.indexOf(-0) < array.lastIndexOf(0) || array.indexOf(0) === -1);
+});
+
+/* BigInt negatives */
+assertSorted(new BigInt64Array([5n, -1n, -9223372036854775808n, 9223372036854775807n, 0n, -2n]),
+             [-9223372036854775808n, -2n, -1n, 0n, 5n, 9223372036854775807n]);
+assertSorted(new BigUint64Array([18446744073709551615n, 0n, 9223372036854775808n, 1n]),
+             [0n, 1n, 9223372036854775808n, 18446744073709551615n]);
+
+var bigValues = [];
+for (var i = 0; i < 100; i++) {
+  bigValues.push(BigInt(random() % 1000 - 500) * 1000000000000n);
+}
+
+var bigArray = new BigInt64Array(bigValues);
+bigArray.sort();
+for (var i = 1; i < bigArray.length; i++) {
+  assert(bigArray[i - 1] <= bigArray[i]);
+}
+
+/* Subarrays with a non-zero byte offset only sort their own range */
+types.concat([BigInt64Array]).forEach(function(type) {
+  var big = type === BigInt64Array;
+  var init = [9, 8, 7, 6, 5, 4, 3, 2, 1, 0];
+  var whole = new type(init.map(function(v) { return big ? BigInt(v) : v; }));
+  var sub = whole.subarray(2, 8);
+
+  sub.sort();
+
+  var expected = [9, 8, 2, 3, 4, 5, 6, 7, 1, 0];
+  for (var i = 0; i < expected.length; i++) {
+    assert(whole[i] == expected[i]);
+  }
+});
+
+var buffer = new ArrayBuffer(8 * 40);
+var floats = new Float64Array(buffer, 8 * 5, 30);
+for (var i = 0; i < 30; i++) {
+  floats[i] = (i % 4 === 0) ? NaN : 15 - i;
+}
+new Float64Array(buffer)[4] = -100;
+new Float64Array(buffer)[35] = -200;
+floats.sort();
+assert(floats[0] === -14);
+assert(isNaN(floats[29]));
+assert(new Float64Array(buffer)[4] === -100);
+assert(new Float64Array(buffer)[35] === -200);
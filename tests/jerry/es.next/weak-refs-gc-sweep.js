@@ -0,0 +1,51 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Unreachable keys and targets must not be accessible through weak
+ * references after an automatic GC run, even if freeing them is deferred. */
+var live = [];
+var refs = [];
+var map = new WeakMap();
+var set = new WeakSet();
+
+for (var i = 0; i < 4000; i++) {
+  var key = { index: i };
+
+  map.set(key, { value: i });
+  set.add(key);
+  refs.push(new WeakRef(key));
+
+  if (i % 50 === 0) {
+    live.push(key);
+  }
+
+  if (refs.length > 500) {
+    for (var j = 0; j < refs.length; j++) {
+      var target = refs[j].deref();
+
+      if (target !== undefined) {
+        assert(typeof target.index === "number");
+        assert(map.get(target).value === target.index);
+        assert(set.has(target));
+      }
+    }
+    refs = [];
+  }
+}
+
+for (var i = 0; i < live.length; i++) {
+  assert(map.get(live[i]).value === live[i].index);
+  assert(set.has(live[i]));
+}
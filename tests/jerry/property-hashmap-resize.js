@@ -0,0 +1,103 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Grow, churn and shrink objects used as dictionaries, so their
+ * property hashmaps are resized, compacted and freed in place. */
+
+function check (dict, from, to, present) {
+  for (var i = from; i < to; i++) {
+    assert ((("k" + i) in dict) === present);
+    if (present) {
+      assert (dict["k" + i] === i);
+    }
+  }
+}
+
+var dict = {};
+
+for (var i = 0; i < 3000; i++) {
+  dict["k" + i] = i;
+}
+check (dict, 0, 3000, true);
+
+/* Delete most keys: the hashmap is shrunk several times. */
+for (var i = 0; i < 2990; i++) {
+  assert (delete dict["k" + i]);
+}
+check (dict, 0, 2990, false);
+check (dict, 2990, 3000, true);
+assert (Object.keys (dict).length === 10);
+
+/* Grow again after the hashmap is freed. */
+for (var i = 0; i < 500; i++) {
+  dict["k" + i] = i;
+}
+check (dict, 0, 500, true);
+check (dict, 2990, 3000, true);
+
+/* Insert and delete in a sliding window: deleted entries must be compacted. */
+var churn = {};
+
+for (var i = 0; i < 20000; i++) {
+  churn["c" + i] = i;
+  if (i >= 100) {
+    assert (delete churn["c" + (i - 100)]);
+  }
+  if ((i % 997) === 0) {
+    assert (churn["c" + i] === i);
+    assert (!(("c" + (i - 150)) in churn));
+  }
+}
+
+var keys = Object.keys (churn);
+assert (keys.length === 100);
+for (var i = 0; i < keys.length; i++) {
+  assert (keys[i] === "c" + (19900 + i));
+}
+
+/* Index and symbol keys share the hashmap with string keys. */
+var mixed = {};
+var symbols = [];
+
+for (var i = 0; i < 200; i++) {
+  symbols.push (Symbol ("s" + i));
+  mixed[i] = i;
+  mixed["n" + i] = i;
+  mixed[symbols[i]] = i;
+}
+
+for (var i = 0; i < 200; i += 2) {
+  delete mixed[i];
+  delete mixed[symbols[i]];
+}
+
+for (var i = 0; i < 200; i++) {
+  var odd = (i % 2) === 1;
+  assert ((i in mixed) === odd);
+  assert ((symbols[i] in mixed) === odd);
+  assert (mixed["n" + i] === i);
+}
+
+/* Shrinking an array length deletes many index properties at once. */
+var arr = [];
+arr.x = 1;
+for (var i = 0; i < 1000; i++) {
+  Object.defineProperty (arr, i, { value: i, configurable: true, writable: true });
+}
+arr.length = 10;
+assert (arr.length === 10);
+assert (arr[9] === 9);
+assert (arr[10] === undefined);
+assert (arr.x === 1);
@@ -0,0 +1,68 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Create more distinct patterns than the RegExp cache can hold. */
+var fields = [];
+for (var i = 0; i < 100; i++) {
+  fields.push ("field" + i);
+}
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < fields.length; i++) {
+    var re = new RegExp (fields[i] + "=(\\d+)");
+    var match = re.exec ("x " + fields[i] + "=" + (i * 7 + round) + " y");
+    assert (match !== null);
+    assert (match[1] === String (i * 7 + round));
+    assert (re.source === fields[i] + "=(\\d+)");
+  }
+
+  if (typeof gc === "function") {
+    gc ();
+  }
+}
+
+/* The same pattern with different flags must not share byte code. */
+for (var i = 0; i < 10; i++) {
+  var re_plain = new RegExp ("ab+c");
+  var re_ignore_case = new RegExp ("ab+c", "i");
+  var re_global = new RegExp ("ab+c", "g");
+
+  assert (re_plain.test ("ABBC") === false);
+  assert (re_ignore_case.test ("ABBC") === true);
+  assert (re_plain.flags === "");
+  assert (re_ignore_case.flags === "i");
+  assert (re_global.flags === "g");
+}
+
+/* Patterns which are equal except for a few characters. */
+var prefixes = ["a", "b", "ab", "ba", "aa", "bb"];
+for (var round = 0; round < 2; round++) {
+  for (var i = 0; i < prefixes.length; i++) {
+    var re = new RegExp ("^" + prefixes[i] + "$");
+    for (var j = 0; j < prefixes.length; j++) {
+      assert (re.test (prefixes[j]) === (i === j));
+    }
+  }
+}
+
+/* Invalid patterns are not cached. */
+for (var i = 0; i < 3; i++) {
+  try {
+    new RegExp ("(");
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
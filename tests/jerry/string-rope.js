@@ -0,0 +1,115 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Long strings built by repeated concatenation are represented as
+ * rope strings until their characters are accessed. */
+
+function build (piece, count) {
+  var str = "";
+  for (var i = 0; i < count; i++) {
+    str += piece;
+  }
+  return str;
+}
+
+/* Length is available without flattening. */
+var str = build ("abcdefghij", 1000);
+assert (str.length === 10000);
+assert (str.charAt (0) === "a");
+assert (str.charAt (9999) === "j");
+assert (str.charCodeAt (5005) === 102);
+assert (str.indexOf ("ja") === 9);
+assert (str.slice (-3) === "hij");
+
+/* Equality and hashing of ropes and flat strings with the same characters. */
+var rope1 = build ("xy", 300);
+var rope2 = build ("xyxy", 150);
+var flat = Array (301).join ("xy");
+
+assert (rope1 === rope2);
+assert (rope1 === flat);
+assert (flat === rope2);
+assert (!(rope1 < rope2) && !(rope1 > rope2));
+assert (rope1 + "a" > rope2);
+assert (rope1 < rope2 + "a");
+
+var obj = {};
+obj[build ("key", 100)] = 1;
+obj[Array (101).join ("key")] += 1;
+assert (obj[build ("ke", 1) + build ("yke", 99) + "y"] === 2);
+assert (Object.keys (obj).length === 1);
+
+/* Shared left sides. */
+var base = build ("0123456789", 30);
+var left = base + "left";
+var right = base + "right";
+assert (left.length === 304 && right.length === 305);
+assert (left.slice (300) === "left");
+assert (right.slice (300) === "right");
+assert (base.length === 300 && base.slice (-2) === "89");
+
+/* Non-ASCII characters and surrogate pairs. */
+var unicode = build ("á€😀", 200);
+assert (unicode.length === 800);
+assert (unicode.charCodeAt (1) === 0x20ac);
+assert (unicode.charCodeAt (798) === 0xd83d);
+assert (unicode.charCodeAt (799) === 0xde00);
+assert (unicode.charAt (796) === "á");
+assert (encodeURIComponent (unicode).length === 200 * 27);
+
+var lone = build ("a", 300) + "\ud83d";
+var pair = lone + "\ude00";
+assert (pair.length === 302);
+assert (pair.charCodeAt (300) === 0xd83d);
+assert (pair.charCodeAt (301) === 0xde00);
+
+/* Concatenation with numbers, magic strings and other ropes. */
+var mixed = build ("-", 300) + 12345 + "length" + build ("=", 300);
+assert (mixed.length === 300 + 5 + 6 + 300);
+assert (mixed.substr (300, 11) === "12345length");
+
+var doubled = build ("ab", 200);
+doubled += doubled;
+assert (doubled.length === 800);
+assert (doubled === build ("ab", 400));
+
+/* Deep ropes are flattened and released without recursion. */
+var deep = build ("z", 100000);
+assert (deep.length === 100000);
+deep = build ("zz", 50000);
+assert (deep.charAt (99999) === "z");
+assert (deep === build ("z", 100000));
+deep = undefined;
+
+/* Ropes used as property names are compared without being flattened. */
+var prefix = build ("key", 100);
+var keyed = {};
+
+for (var i = 0; i < 64; i++) {
+  keyed[prefix + i] = i;
+}
+
+for (var i = 0; i < 64; i++) {
+  var key = build ("key", 50) + build ("key", 50) + i;
+  assert (keyed[key] === i);
+  assert (key in keyed);
+  assert (keyed.hasOwnProperty ("k" + build ("eyk", 99) + "ey" + i));
+}
+
+assert (keyed[prefix + "x"] === undefined);
+assert (keyed[build ("key", 99) + "kex0"] === undefined);
+
+var swapped = build ("yek", 100);
+assert (keyed[swapped + "0"] === undefined);
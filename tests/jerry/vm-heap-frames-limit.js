@@ -0,0 +1,80 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Deep recursion must throw a RangeError when the VM frames reach their
+ * size limit (or the native stack limit), and the frames of the unwound
+ * calls must be released, so the same depth is reached again. */
+var depth = 0;
+
+function small ()
+{
+  depth++;
+  small ();
+}
+
+function large (n)
+{
+  var a0 = n, a1 = n, a2 = n, a3 = n, a4 = n, a5 = n, a6 = n, a7 = n;
+  var b0 = n, b1 = n, b2 = n, b3 = n, b4 = n, b5 = n, b6 = n, b7 = n;
+
+  depth++;
+  return large (n + 1) + a0 + a7 + b0 + b7;
+}
+
+function measure (func)
+{
+  depth = 0;
+
+  try
+  {
+    func (0);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof RangeError);
+  }
+
+  return depth;
+}
+
+var small_depth = measure (small);
+var large_depth = measure (large);
+
+assert (small_depth > 0);
+assert (large_depth > 0);
+assert (large_depth <= small_depth);
+
+assert (measure (small) === small_depth);
+assert (measure (large) === large_depth);
+
+/* Catch the error halfway, then recurse again from there. */
+function nested (n)
+{
+  if (n < (small_depth >> 1))
+  {
+    return nested (n + 1);
+  }
+
+  var first = measure (small);
+  var second = measure (small);
+
+  assert (first === second);
+  assert (first < small_depth);
+  return first;
+}
+
+assert (nested (0) > 0);
+assert (measure (small) === small_depth);
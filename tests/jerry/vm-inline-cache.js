@@ -0,0 +1,180 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* The same property access sites are executed with objects
+ * whose properties change between the executions. */
+
+function get_x (obj)
+{
+  return obj.x;
+}
+
+function set_x (obj, value)
+{
+  obj.x = value;
+}
+
+function incr_x (obj)
+{
+  obj.x++;
+}
+
+/* Own data properties. */
+var a = { x: 1, y: 2 };
+var b = { y: 2, x: 3 };
+
+for (var i = 0; i < 4; i++)
+{
+  assert (get_x (a) === 1);
+  assert (get_x (b) === 3);
+}
+
+set_x (a, 5);
+assert (get_x (a) === 5);
+incr_x (a);
+assert (a.x === 6);
+
+/* Deleted and recreated property. */
+delete a.x;
+assert (get_x (a) === undefined);
+a.x = 7;
+assert (get_x (a) === 7);
+
+/* Property redefined as an accessor and back. */
+Object.defineProperty (a, "x", { get: function () { return 8; }, configurable: true });
+assert (get_x (a) === 8);
+set_x (a, 9);
+assert (get_x (a) === 8);
+Object.defineProperty (a, "x", { value: 10, writable: true, configurable: true });
+assert (get_x (a) === 10);
+
+/* Read-only property. */
+set_x (a, 11);
+assert (get_x (a) === 11);
+Object.defineProperty (a, "x", { writable: false });
+set_x (a, 12);
+assert (get_x (a) === 11);
+
+Object.freeze (b);
+set_x (b, 13);
+assert (get_x (b) === 3);
+
+function set_x_strict (obj, value)
+{
+  "use strict";
+  obj.x = value;
+}
+
+var c = { x: 1 };
+set_x_strict (c, 2);
+set_x_strict (c, 3);
+Object.defineProperty (c, "x", { writable: false });
+
+try
+{
+  set_x_strict (c, 4);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+assert (c.x === 3);
+
+/* Inherited properties. */
+var proto = { x: 20 };
+var d = Object.create (proto);
+
+assert (get_x (d) === 20);
+assert (get_x (d) === 20);
+
+proto.x = 21;
+assert (get_x (d) === 21);
+
+/* Shadowing by an own property. */
+d.y = 1;
+assert (get_x (d) === 21);
+d.x = 22;
+assert (get_x (d) === 22);
+assert (proto.x === 21);
+
+delete d.x;
+assert (get_x (d) === 21);
+
+/* Setting an inherited property creates an own property. */
+var e = Object.create (proto);
+assert (get_x (e) === 21);
+set_x (e, 23);
+assert (get_x (e) === 23);
+assert (proto.x === 21);
+
+/* Shadowing after a deleted first property. */
+var f = Object.create (proto);
+f.z = 1;
+delete f.z;
+assert (get_x (f) === 21);
+f.x = 24;
+assert (get_x (f) === 24);
+
+/* Changing the prototype. */
+var g = Object.create (proto);
+assert (get_x (g) === 21);
+Object.setPrototypeOf (g, { x: 25 });
+assert (get_x (g) === 25);
+Object.setPrototypeOf (g, null);
+assert (get_x (g) === undefined);
+
+/* Inherited property deleted from the prototype. */
+var h = Object.create (proto);
+assert (get_x (h) === 21);
+delete proto.x;
+assert (get_x (h) === undefined);
+Object.defineProperty (proto, "x", { get: function () { return this.y; }, configurable: true });
+h.y = 26;
+assert (get_x (h) === 26);
+
+/* Objects with many properties. */
+var many = {};
+for (var i = 0; i < 64; i++)
+{
+  many["p" + i] = i;
+}
+many.x = 27;
+assert (get_x (many) === 27);
+delete many.p3;
+many.x = 28;
+assert (get_x (many) === 28);
+delete many.x;
+assert (get_x (many) === undefined);
+
+/* Computed property names. */
+function get_prop (obj, name)
+{
+  return obj[name];
+}
+
+var k = { ab: 1, ac: 2 };
+assert (get_prop (k, "a" + "b") === 1);
+assert (get_prop (k, "a" + "c") === 2);
+assert (get_prop (k, "a" + "b") === 1);
+
+/* Garbage collected objects. */
+for (var i = 0; i < 100; i++)
+{
+  var tmp = { x: i };
+  assert (get_x (tmp) === i);
+  set_x (tmp, i + 1);
+  assert (get_x (tmp) === i + 1);
+}
@@ -0,0 +1,135 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+
+#include "test-common.h"
+
+#define MS_PER_HOUR ((double) 3600000)
+
+/**
+ * Local time zone adjustment returned by the port.
+ */
+static double time_zone_adjustment = 0;
+
+/**
+ * Number of times the port was asked for the local time zone adjustment.
+ */
+static int time_zone_query_count = 0;
+
+/**
+ * Custom port function, which time zone is changed by the test.
+ *
+ * @return value of time_zone_adjustment
+ */
+double
+jerry_port_get_local_time_zone_adjustment (double unix_ms, /**< ms since unix epoch */
+                                           bool is_utc) /**< is the time above in UTC? */
+{
+  (void) unix_ms;
+
+  /* The engine converts local times by itself. */
+  TEST_ASSERT (is_utc);
+
+  time_zone_query_count++;
+  return time_zone_adjustment;
+} /* jerry_port_get_local_time_zone_adjustment */
+
+/**
+ * Custom port function, which returns a fixed time.
+ *
+ * @return milliseconds since the unix epoch
+ */
+double
+jerry_port_get_current_time (void)
+{
+  return 0;
+} /* jerry_port_get_current_time */
+
+/**
+ * Evaluate a script which returns a number.
+ *
+ * @return the number returned by the script
+ */
+static double
+eval_number (const char *source_p) /**< script source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  double number = jerry_get_number_value (result);
+  jerry_release_value (result);
+  return number;
+} /* eval_number */
+
+/**
+ * Unit test's main function.
+ */
+int
+main (void)
+{
+  TEST_INIT ();
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_DATE))
+  {
+    return 0;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *local_time_p = "new Date (2020, 0, 1, 12).getTime ()";
+  const char *utc_time_p = "Date.UTC (2020, 0, 1, 12)";
+
+  time_zone_adjustment = MS_PER_HOUR;
+  double utc_time = eval_number (utc_time_p);
+
+  TEST_ASSERT (eval_number (local_time_p) == utc_time - MS_PER_HOUR);
+  TEST_ASSERT (eval_number ("globalThis.date = new Date (0); date.getHours ()") == 1);
+
+  /* The adjustment of the same time value is cached. */
+  int query_count = time_zone_query_count;
+  TEST_ASSERT (eval_number (local_time_p) == utc_time - MS_PER_HOUR);
+  TEST_ASSERT (eval_number ("date.getHours ()") == 1);
+  TEST_ASSERT (time_zone_query_count == query_count);
+
+  /* Without a reset, the previous time zone is still used. */
+  time_zone_adjustment = 2 * MS_PER_HOUR;
+  TEST_ASSERT (eval_number (local_time_p) == utc_time - MS_PER_HOUR);
+  TEST_ASSERT (eval_number ("date.getHours ()") == 1);
+
+  /* The reset affects new conversions and existing Date objects. */
+  jerry_reset_time_zone_cache ();
+
+  TEST_ASSERT (eval_number (local_time_p) == utc_time - 2 * MS_PER_HOUR);
+  TEST_ASSERT (eval_number ("date.getHours ()") == 2);
+  TEST_ASSERT (eval_number ("new Date (0).getHours ()") == 2);
+  TEST_ASSERT (time_zone_query_count > query_count);
+
+  time_zone_adjustment = -5 * MS_PER_HOUR;
+  jerry_reset_time_zone_cache ();
+
+  TEST_ASSERT (eval_number (local_time_p) == utc_time + 5 * MS_PER_HOUR);
+  TEST_ASSERT (eval_number ("date.getHours ()") == 19);
+  TEST_ASSERT (eval_number ("date.getTimezoneOffset ()") == 300);
+
+  /* Resetting is allowed when nothing is cached. */
+  jerry_reset_time_zone_cache ();
+  jerry_reset_time_zone_cache ();
+  TEST_ASSERT (eval_number ("new Date (1e9).getHours ()") == 8);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,243 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+
+#include "test-common.h"
+
+/**
+ * Current time of the custom port, which is advanced by every query.
+ */
+static double current_time = 0;
+
+/**
+ * Custom port function, which advances the time by 10 milliseconds on every call.
+ *
+ * @return milliseconds since the unix epoch
+ */
+double
+jerry_port_get_current_time (void)
+{
+  current_time += 10;
+  return current_time;
+} /* jerry_port_get_current_time */
+
+/**
+ * Custom port function, which always returns UTC.
+ *
+ * @return 0
+ */
+double
+jerry_port_get_local_time_zone_adjustment (double unix_ms, /**< ms since unix epoch */
+                                           bool is_utc) /**< is the time above in UTC? */
+{
+  (void) unix_ms;
+  (void) is_utc;
+  return 0;
+} /* jerry_port_get_local_time_zone_adjustment */
+
+/**
+ * Jobs are enqueued by the enqueue function, and every job appends its id to the log.
+ * The enqueued array contains the ids in enqueue order, so the log must be its prefix.
+ */
+static const char *prologue_p = TEST_STRING_LITERAL (
+  "var log = [];\n"
+  "var enqueued = [];\n"
+  "function enqueue (id, depth) {\n"
+  "  enqueued.push (id);\n"
+  "  Promise.resolve ().then (function () {\n"
+  "    log.push (id);\n"
+  "    if (depth > 0) {\n"
+  "      enqueue (id + 1000, depth - 1);\n"
+  "    }\n"
+  "  });\n"
+  "}\n"
+  "function isFifo () {\n"
+  "  for (var i = 0; i < log.length; i++) {\n"
+  "    if (log[i] !== enqueued[i]) {\n"
+  "      return false;\n"
+  "    }\n"
+  "  }\n"
+  "  return true;\n"
+  "}\n"
+);
+
+/**
+ * Evaluate a script.
+ *
+ * @return the result of the script
+ */
+static jerry_value_t
+eval_source (const char *source_p) /**< script source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval_source */
+
+/**
+ * Evaluate a script which returns a number.
+ *
+ * @return the number returned by the script
+ */
+static double
+eval_number (const char *source_p) /**< script source */
+{
+  jerry_value_t result = eval_source (source_p);
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  double number = jerry_get_number_value (result);
+  jerry_release_value (result);
+  return number;
+} /* eval_number */
+
+/**
+ * Evaluate a script and check that it returns true.
+ */
+static void
+eval_true (const char *source_p) /**< script source */
+{
+  jerry_value_t result = eval_source (source_p);
+  TEST_ASSERT (jerry_value_is_true (result));
+  jerry_release_value (result);
+} /* eval_true */
+
+/**
+ * Run enqueued jobs and check that no error is thrown.
+ */
+static void
+run_jobs (uint32_t max_jobs, /**< maximum number of executed jobs */
+          uint32_t max_time) /**< time limit in milliseconds */
+{
+  jerry_value_t result = jerry_run_enqueued_jobs_with_budget (max_jobs, max_time);
+  TEST_ASSERT (jerry_value_is_undefined (result));
+  jerry_release_value (result);
+} /* run_jobs */
+
+/**
+ * Unit test's main function.
+ */
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_PROMISE))
+  {
+    TEST_ASSERT (!jerry_has_enqueued_jobs ());
+    jerry_cleanup ();
+    return 0;
+  }
+
+  jerry_release_value (eval_source (prologue_p));
+
+  /* Running an empty queue. */
+  TEST_ASSERT (!jerry_has_enqueued_jobs ());
+  run_jobs (1, 0);
+  run_jobs (0, 0);
+  TEST_ASSERT (!jerry_has_enqueued_jobs ());
+
+  /* Job count limit. */
+  jerry_release_value (eval_source ("enqueue (1, 0); enqueue (2, 0); enqueue (3, 0); enqueue (4, 0)"));
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+  TEST_ASSERT (eval_number ("log.length") == 0);
+
+  run_jobs (1, 0);
+  TEST_ASSERT (eval_number ("log.length") == 1);
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+
+  run_jobs (2, 0);
+  TEST_ASSERT (eval_number ("log.length") == 3);
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+
+  run_jobs (10, 0);
+  TEST_ASSERT (eval_number ("log.length") == 4);
+  TEST_ASSERT (!jerry_has_enqueued_jobs ());
+  eval_true ("isFifo ()");
+
+  /* At least one job is executed when the time limit is already exceeded after the first job. */
+  jerry_release_value (eval_source ("enqueue (5, 0); enqueue (6, 0); enqueue (7, 0); enqueue (8, 0)"));
+
+  run_jobs (0, 1);
+  TEST_ASSERT (eval_number ("log.length") == 5);
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+
+  /* The clock advances 10 milliseconds per query, so two jobs fit into 15 milliseconds. */
+  run_jobs (0, 15);
+  TEST_ASSERT (eval_number ("log.length") == 7);
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+
+  run_jobs (0, 1000);
+  TEST_ASSERT (eval_number ("log.length") == 8);
+  TEST_ASSERT (!jerry_has_enqueued_jobs ());
+  eval_true ("isFifo ()");
+
+  /* Jobs enqueue further jobs while the ring buffer wraps around and grows. */
+  jerry_release_value (eval_source ("for (var i = 0; i < 12; i++) { enqueue (100 + i, 3); }"));
+
+  run_jobs (5, 0);
+  TEST_ASSERT (eval_number ("log.length") == 13);
+  eval_true ("isFifo ()");
+
+  jerry_release_value (eval_source ("for (var i = 0; i < 100; i++) { enqueue (10000 + i, 1); }"));
+
+  int batches = 0;
+
+  while (jerry_has_enqueued_jobs ())
+  {
+    run_jobs (7, 0);
+    eval_true ("isFifo ()");
+    batches++;
+  }
+
+  /* 12 * 4 + 100 * 2 jobs, 5 of them are executed before the loop. */
+  TEST_ASSERT (eval_number ("log.length") == 8 + 12 * 4 + 100 * 2);
+  TEST_ASSERT (eval_number ("enqueued.length") == 8 + 12 * 4 + 100 * 2);
+  TEST_ASSERT (batches == (12 * 4 + 100 * 2 - 5 + 6) / 7);
+
+  /* An error stops the processing, but the remaining jobs are kept. */
+  jerry_release_value (eval_source (TEST_STRING_LITERAL (
+    "enqueue (20, 0);\n"
+    "var failing = Promise.resolve ();\n"
+    "failing.constructor = {};\n"
+    "failing.constructor[Symbol.species] = function (executor) {\n"
+    "  executor (function () { throw new Error ('resolve failed'); }, function () {});\n"
+    "};\n"
+    "enqueued.push (21);\n"
+    "failing.then (function () { log.push (21); });\n"
+    "enqueue (22, 1);\n"
+    "enqueue (23, 0);\n"
+  )));
+
+  jerry_value_t result = jerry_run_enqueued_jobs_with_budget (0, 0);
+  TEST_ASSERT (jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  TEST_ASSERT (jerry_has_enqueued_jobs ());
+  eval_true ("log.length === enqueued.length - 2 && log[log.length - 1] === 21");
+
+  run_jobs (1, 0);
+  eval_true ("log[log.length - 1] === 22");
+
+  run_jobs (0, 0);
+  TEST_ASSERT (!jerry_has_enqueued_jobs ());
+  eval_true ("isFifo () && log.length === enqueued.length");
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,345 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * State of the chunked reader.
+ */
+typedef struct
+{
+  const jerry_char_t *text_p; /**< JSON text */
+  jerry_size_t text_size; /**< size of the JSON text */
+  jerry_size_t position; /**< number of bytes already read */
+  jerry_size_t chunk_size; /**< maximum size of a chunk */
+  jerry_size_t error_position; /**< the read fails when this position is reached */
+} chunk_reader_t;
+
+/**
+ * Read callback, which returns the JSON text in chunks.
+ *
+ * @return number of copied bytes
+ */
+static jerry_size_t
+read_chunk (jerry_char_t *buffer_p, /**< target buffer */
+            jerry_size_t buffer_size, /**< size of the target buffer */
+            void *user_p) /**< chunk reader */
+{
+  chunk_reader_t *reader_p = (chunk_reader_t *) user_p;
+
+  TEST_ASSERT (buffer_size > 0);
+
+  if (reader_p->position >= reader_p->error_position)
+  {
+    return JERRY_JSON_READ_ERROR;
+  }
+
+  jerry_size_t size = reader_p->text_size - reader_p->position;
+
+  if (size > reader_p->chunk_size)
+  {
+    size = reader_p->chunk_size;
+  }
+
+  if (size > buffer_size)
+  {
+    size = buffer_size;
+  }
+
+  if (size > reader_p->error_position - reader_p->position)
+  {
+    size = reader_p->error_position - reader_p->position;
+  }
+
+  memcpy (buffer_p, reader_p->text_p + reader_p->position, size);
+  reader_p->position += size;
+  return size;
+} /* read_chunk */
+
+/**
+ * Parse a JSON text with jerry_json_parse_stream.
+ *
+ * @return parsed value
+ */
+static jerry_value_t
+parse_chunked (const jerry_char_t *text_p, /**< JSON text */
+               jerry_size_t text_size, /**< size of the JSON text */
+               jerry_size_t chunk_size, /**< maximum size of a chunk */
+               jerry_size_t error_position) /**< position where the read fails */
+{
+  chunk_reader_t reader;
+  reader.text_p = text_p;
+  reader.text_size = text_size;
+  reader.position = 0;
+  reader.chunk_size = chunk_size;
+  reader.error_position = error_position;
+
+  return jerry_json_parse_stream (read_chunk, &reader);
+} /* parse_chunked */
+
+/**
+ * Check that two parsed values are equal.
+ */
+static void
+check_same_value (jerry_value_t value, /**< parsed value */
+                  jerry_value_t expected) /**< expected value */
+{
+  TEST_ASSERT (!jerry_value_is_error (value));
+  TEST_ASSERT (!jerry_value_is_error (expected));
+
+  jerry_value_t string = jerry_json_stringify (value);
+  jerry_value_t expected_string = jerry_json_stringify (expected);
+  jerry_value_t result = jerry_binary_operation (JERRY_BIN_OP_STRICT_EQUAL, string, expected_string);
+
+  TEST_ASSERT (jerry_value_is_true (result));
+
+  jerry_release_value (result);
+  jerry_release_value (expected_string);
+  jerry_release_value (string);
+} /* check_same_value */
+
+/**
+ * Check that a value is an error of the given type.
+ */
+static void
+check_error (jerry_value_t value, /**< parsed value */
+             jerry_error_t error_type) /**< expected error type */
+{
+  TEST_ASSERT (jerry_value_is_error (value));
+  TEST_ASSERT (jerry_get_error_type (value) == error_type);
+  jerry_release_value (value);
+} /* check_error */
+
+/**
+ * Valid JSON texts, which contain escape sequences, surrogate pairs and
+ * multi-byte CESU-8 characters at various positions.
+ */
+static const char *valid_texts[] =
+{
+  "0",
+  "-12.5e+3",
+  " true ",
+  "null",
+  "\"\"",
+  "\"abc\"",
+  "\"a\\\"b\"",
+  "\"a\\\\\"",
+  "\"\\\\\\\"\\\\\"",
+  "\"\\\"\"",
+  "\"\\n\\t\\r\\b\\f\\/\"",
+  "\"\\u0041\\u00e9\\u20AC\"",
+  "\"\\ud83d\\ude00\"",
+  "\"x\\uD83D\\uDE00y\\ud800\"",
+  "\"\xc3\xa9\xe2\x82\xac\xed\xa0\xbd\xed\xb8\x80\"",
+  "[1, \"two\", [3.5, -4], {\"five\": false}, null]",
+  "{\"a\\\"b\": \"c\\\\\", \"\\u0064\": [true, {}], \"e\": \"\\ud83d\\ude00\"}",
+  " { \"key\" : [ \"value\" , 1e2 , \"\xed\xa0\xbd\xed\xb8\x80\" ] } ",
+};
+
+/**
+ * Invalid JSON texts.
+ */
+static const char *invalid_texts[] =
+{
+  "",
+  " ",
+  "tru",
+  "nul",
+  "1 2",
+  "-",
+  "01",
+  "[1, 2",
+  "[1, 2,]",
+  "{\"a\": }",
+  "{\"a\" 1}",
+  "{\"a\": 1}x",
+  "\"abc",
+  "\"abc\\\"",
+  "\"\\x\"",
+  "\"\\u12\"",
+  "\"a\nb\"",
+};
+
+/**
+ * Unit test's main function.
+ */
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_JSON))
+  {
+    jerry_cleanup ();
+    return 0;
+  }
+
+  /* Every chunk size from 1 byte to the whole text. */
+  for (size_t i = 0; i < sizeof (valid_texts) / sizeof (valid_texts[0]); i++)
+  {
+    const jerry_char_t *text_p = (const jerry_char_t *) valid_texts[i];
+    jerry_size_t text_size = (jerry_size_t) strlen (valid_texts[i]);
+    jerry_value_t expected = jerry_json_parse (text_p, text_size);
+
+    for (jerry_size_t chunk_size = 1; chunk_size <= text_size; chunk_size++)
+    {
+      jerry_value_t value = parse_chunked (text_p, text_size, chunk_size, UINT32_MAX);
+      check_same_value (value, expected);
+      jerry_release_value (value);
+    }
+
+    jerry_release_value (expected);
+  }
+
+  /* Invalid texts are reported as syntax errors for every chunk size. */
+  for (size_t i = 0; i < sizeof (invalid_texts) / sizeof (invalid_texts[0]); i++)
+  {
+    const jerry_char_t *text_p = (const jerry_char_t *) invalid_texts[i];
+    jerry_size_t text_size = (jerry_size_t) strlen (invalid_texts[i]);
+
+    check_error (jerry_json_parse (text_p, text_size), JERRY_ERROR_SYNTAX);
+
+    for (jerry_size_t chunk_size = 1; chunk_size <= text_size + 1; chunk_size++)
+    {
+      check_error (parse_chunked (text_p, text_size, chunk_size, UINT32_MAX), JERRY_ERROR_SYNTAX);
+    }
+  }
+
+  /* Tokens which are longer than the initial buffer of the parser. */
+  {
+    static jerry_char_t long_text[10000];
+    jerry_size_t size = 0;
+
+    long_text[size++] = '[';
+    long_text[size++] = '"';
+
+    while (size < 5000)
+    {
+      long_text[size] = (jerry_char_t) ('a' + (size % 26));
+      size++;
+
+      if (size % 997 == 0)
+      {
+        memcpy (long_text + size, "\\\"\\ud83d\\ude00", 14);
+        size += 14;
+      }
+    }
+
+    memcpy (long_text + size, "\", 123456789.25, \"", 18);
+    size += 18;
+
+    while (size < 9000)
+    {
+      long_text[size] = (jerry_char_t) ('A' + (size % 26));
+      size++;
+    }
+
+    long_text[size++] = '"';
+    long_text[size++] = ']';
+
+    jerry_value_t expected = jerry_json_parse (long_text, size);
+    const jerry_size_t chunk_sizes[] = { 1, 3, 1000, 4095, 4096, 4097, 8192, size };
+
+    for (size_t i = 0; i < sizeof (chunk_sizes) / sizeof (chunk_sizes[0]); i++)
+    {
+      jerry_value_t value = parse_chunked (long_text, size, chunk_sizes[i], UINT32_MAX);
+      check_same_value (value, expected);
+      jerry_release_value (value);
+    }
+
+    jerry_release_value (expected);
+  }
+
+  /* A read error is reported even if the text read so far is valid JSON. */
+  {
+    const jerry_char_t number_text[] = "12345";
+    const jerry_char_t object_text[] = "{\"key\": \"value\", \"list\": [1, 2, 3]}";
+    jerry_size_t number_size = sizeof (number_text) - 1;
+    jerry_size_t object_size = sizeof (object_text) - 1;
+
+    for (jerry_size_t error_position = 0; error_position < number_size; error_position++)
+    {
+      check_error (parse_chunked (number_text, number_size, 1, error_position), JERRY_ERROR_COMMON);
+      check_error (parse_chunked (number_text, number_size, 4, error_position), JERRY_ERROR_COMMON);
+    }
+
+    /* The text ends exactly at the failing position, but the end was not reported by the callback. */
+    check_error (parse_chunked (number_text, number_size, 1, number_size), JERRY_ERROR_COMMON);
+
+    for (jerry_size_t error_position = 0; error_position <= object_size; error_position++)
+    {
+      check_error (parse_chunked (object_text, object_size, 2, error_position), JERRY_ERROR_COMMON);
+    }
+
+    jerry_value_t value = parse_chunked (number_text, number_size, 2, UINT32_MAX);
+    TEST_ASSERT (jerry_value_is_number (value) && jerry_get_number_value (value) == 12345);
+    jerry_release_value (value);
+  }
+
+  check_error (jerry_json_parse_stream (NULL, NULL), JERRY_ERROR_TYPE);
+
+  /* External strings produce the same values as copied strings. */
+  {
+    static const jerry_char_t external_text[] =
+      "{\"short\": \"ab\", \"long\": \"the quick brown fox jumps over the lazy dog\", "
+      "\"escaped\": \"a\\nb\\u0041\", \"utf8\": \"\xc3\xa9\xed\xa0\xbd\xed\xb8\x80\", "
+      "\"list\": [\"\", \"x\", \"the quick brown fox\", \"\\ud83d\\ude00\"], "
+      "\"the quick brown fox jumps over the lazy dog\": 1}";
+    jerry_size_t external_size = sizeof (external_text) - 1;
+
+    jerry_value_t expected = jerry_json_parse (external_text, external_size);
+    jerry_value_t value = jerry_json_parse_with_options (external_text,
+                                                         external_size,
+                                                         JERRY_JSON_PARSE_EXTERNAL_STRINGS);
+    check_same_value (value, expected);
+
+    jerry_value_t long_name = jerry_create_string ((const jerry_char_t *) "long");
+    jerry_value_t long_value = jerry_get_property (value, long_name);
+    jerry_value_t expected_long_value = jerry_get_property (expected, long_name);
+    jerry_value_t result = jerry_binary_operation (JERRY_BIN_OP_STRICT_EQUAL, long_value, expected_long_value);
+    TEST_ASSERT (jerry_value_is_true (result));
+    TEST_ASSERT (jerry_get_string_size (long_value) == 43);
+
+    jerry_release_value (result);
+    jerry_release_value (expected_long_value);
+    jerry_release_value (long_value);
+    jerry_release_value (long_name);
+
+    jerry_release_value (expected);
+    jerry_gc (JERRY_GC_PRESSURE_HIGH);
+
+    expected = jerry_json_parse (external_text, external_size);
+    check_same_value (value, expected);
+
+    jerry_release_value (expected);
+    jerry_release_value (value);
+
+    for (size_t i = 0; i < sizeof (invalid_texts) / sizeof (invalid_texts[0]); i++)
+    {
+      jerry_value_t error = jerry_json_parse_with_options ((const jerry_char_t *) invalid_texts[i],
+                                                           (jerry_size_t) strlen (invalid_texts[i]),
+                                                           JERRY_JSON_PARSE_EXTERNAL_STRINGS);
+      check_error (error, JERRY_ERROR_SYNTAX);
+    }
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
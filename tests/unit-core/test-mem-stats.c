@@ -41,11 +41,43 @@ int main (void)
   memset (&stats, 0, sizeof (stats));
   bool get_stats_ret = jerry_get_memory_stats (&stats);
   TEST_ASSERT (get_stats_ret);
-  TEST_ASSERT (stats.version == 1);
+  TEST_ASSERT (stats.version == 2);
   TEST_ASSERT (stats.size == 524280);
+  TEST_ASSERT (stats.regexp_cache_hits == 0);
+  TEST_ASSERT (stats.regexp_cache_misses == 0);
 
   TEST_ASSERT (!jerry_get_memory_stats (NULL));
 
+  if (jerry_is_feature_enabled (JERRY_FEATURE_REGEXP))
+  {
+    const jerry_char_t regexp_source[] = TEST_STRING_LITERAL (
+      "for (var i = 0; i < 10; i++) {"
+      "  new RegExp ('a' + (i % 2) + 'b');"
+      "}"
+    );
+
+    jerry_value_t regexp_code_val = jerry_parse (regexp_source, sizeof (regexp_source) - 1, NULL);
+    TEST_ASSERT (!jerry_value_is_error (regexp_code_val));
+
+    jerry_value_t regexp_res = jerry_run (regexp_code_val);
+    TEST_ASSERT (!jerry_value_is_error (regexp_res));
+    jerry_release_value (regexp_res);
+
+    /* The cached byte codes must survive the garbage collection. */
+    jerry_gc (JERRY_GC_PRESSURE_LOW);
+
+    regexp_res = jerry_run (regexp_code_val);
+    TEST_ASSERT (!jerry_value_is_error (regexp_res));
+
+    memset (&stats, 0, sizeof (stats));
+    TEST_ASSERT (jerry_get_memory_stats (&stats));
+    TEST_ASSERT (stats.regexp_cache_hits == 18);
+    TEST_ASSERT (stats.regexp_cache_misses == 2);
+
+    jerry_release_value (regexp_res);
+    jerry_release_value (regexp_code_val);
+  }
+
   jerry_release_value (res);
   jerry_release_value (parsed_code_val);
 
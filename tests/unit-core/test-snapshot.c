@@ -190,6 +190,189 @@ static void test_exec_snapshot (uint32_t *snapshot_p, size_t snapshot_size, uint
   jerry_cleanup ();
 } /* test_exec_snapshot */
 
+static void test_lazy_load_snapshot (void)
+{
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      || !jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    return;
+  }
+
+  static uint32_t snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  const jerry_char_t code_to_snapshot[] = TEST_STRING_LITERAL (
+    "function outer (n) {"
+    "  function inner (m) { return m * 2; }"
+    "  return inner (n) + 1;"
+    "}"
+    "function unused () { return 'unused'; }"
+    "var arrow = (x) => x + outer (x);"
+    "[outer (1), arrow (2), outer (3)].join ()"
+  );
+
+  jerry_init (JERRY_INIT_EMPTY);
+  jerry_value_t generate_result;
+  generate_result = jerry_generate_snapshot (code_to_snapshot,
+                                             sizeof (code_to_snapshot) - 1,
+                                             NULL,
+                                             0,
+                                             snapshot_buffer,
+                                             sizeof (snapshot_buffer));
+  TEST_ASSERT (!jerry_value_is_error (generate_result)
+               && jerry_value_is_number (generate_result));
+
+  size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
+  jerry_release_value (generate_result);
+  jerry_cleanup ();
+
+  const uint32_t exec_flags[] =
+  {
+    0,
+    JERRY_SNAPSHOT_EXEC_LAZY_LOAD,
+    JERRY_SNAPSHOT_EXEC_LAZY_LOAD | JERRY_SNAPSHOT_EXEC_ALLOW_STATIC,
+  };
+
+  for (size_t i = 0; i < sizeof (exec_flags) / sizeof (exec_flags[0]); i++)
+  {
+    char string_data[8];
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t res = jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, exec_flags[i]);
+    TEST_ASSERT (jerry_value_is_string (res));
+    jerry_size_t sz = jerry_string_to_char_buffer (res, (jerry_char_t *) string_data, sizeof (string_data));
+    TEST_ASSERT (sz == 5 && !strncmp (string_data, "3,7,7", sz));
+    jerry_release_value (res);
+
+    /* The functions are still callable after the snapshot is executed. */
+    const jerry_char_t call_again[] = "outer (10) + arrow (10) + unused ().length";
+    res = jerry_eval (call_again, sizeof (call_again) - 1, JERRY_PARSE_NO_OPTS);
+    TEST_ASSERT (jerry_value_is_number (res) && jerry_get_number_value (res) == 21 + 31 + 6);
+    jerry_release_value (res);
+
+    jerry_cleanup ();
+  }
+
+  /* Lazily loaded functions refer to the snapshot buffer, so it cannot be copied. */
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t res = jerry_exec_snapshot (snapshot_buffer,
+                                           snapshot_size,
+                                           0,
+                                           JERRY_SNAPSHOT_EXEC_COPY_DATA | JERRY_SNAPSHOT_EXEC_LAZY_LOAD);
+  TEST_ASSERT (jerry_value_is_error (res));
+  TEST_ASSERT (jerry_get_error_type (res) == JERRY_ERROR_RANGE);
+  jerry_release_value (res);
+
+  jerry_cleanup ();
+} /* test_lazy_load_snapshot */
+
+/**
+ * Build a script, which has more literals than the initial size of the snapshot literal index,
+ * and which checks that every literal is correct after the snapshot is loaded.
+ *
+ * @return size of the script
+ */
+static size_t
+build_literal_script (char *buffer_p, /**< [out] script buffer */
+                      size_t buffer_size, /**< size of the buffer */
+                      int first) /**< index of the first string and number literal */
+{
+  size_t size = (size_t) snprintf (buffer_p, buffer_size, "var first = %d, a = [", first);
+
+  for (int i = 0; i < 80; i++)
+  {
+    size += (size_t) snprintf (buffer_p + size, buffer_size - size, "'lit_%d', ", first + i);
+  }
+
+  size += (size_t) snprintf (buffer_p + size, buffer_size - size, "], n = [");
+
+  for (int i = 0; i < 10; i++)
+  {
+    size += (size_t) snprintf (buffer_p + size, buffer_size - size, "%d.5, ", first + i);
+  }
+
+  size += (size_t) snprintf (buffer_p + size, buffer_size - size, "%s",
+                             "], ok = true;"
+                             "for (var i = 0; i < a.length; i++) ok = ok && a[i] === 'lit_' + (first + i);"
+                             "for (i = 0; i < n.length; i++) ok = ok && n[i] === first + i + 0.5;");
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_BIGINT))
+  {
+    /* The BigInt zero is not stored in the literal table. */
+    size += (size_t) snprintf (buffer_p + size, buffer_size - size,
+                               "ok = ok && 0n === BigInt (0) && typeof 0n === 'bigint' && %dn === BigInt (first);",
+                               first);
+  }
+
+  size += (size_t) snprintf (buffer_p + size, buffer_size - size, "ok");
+  TEST_ASSERT (size < buffer_size);
+  return size;
+} /* build_literal_script */
+
+static void test_merge_many_literals (void)
+{
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      || !jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    return;
+  }
+
+  static uint32_t snapshot_buffers[2][2048];
+  static uint32_t merged_snapshot_buffer[4096];
+  static char script[2048];
+  size_t snapshot_sizes[2];
+
+  /* The two scripts share 40 string literals and 5 number literals. */
+  for (int i = 0; i < 2; i++)
+  {
+    size_t script_size = build_literal_script (script, sizeof (script), i * 40);
+
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_value_t generate_result = jerry_generate_snapshot ((const jerry_char_t *) script,
+                                                             script_size,
+                                                             NULL,
+                                                             0,
+                                                             snapshot_buffers[i],
+                                                             sizeof (snapshot_buffers[i]));
+    TEST_ASSERT (!jerry_value_is_error (generate_result)
+                 && jerry_value_is_number (generate_result));
+
+    snapshot_sizes[i] = (size_t) jerry_get_number_value (generate_result);
+    jerry_release_value (generate_result);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_value_t res = jerry_exec_snapshot (snapshot_buffers[i], snapshot_sizes[i], 0, 0);
+    TEST_ASSERT (jerry_value_is_true (res));
+    jerry_release_value (res);
+    jerry_cleanup ();
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *error_p;
+  const uint32_t *merge_buffers[2] = { snapshot_buffers[0], snapshot_buffers[1] };
+
+  size_t merged_size = jerry_merge_snapshots (merge_buffers,
+                                              snapshot_sizes,
+                                              2,
+                                              merged_snapshot_buffer,
+                                              sizeof (merged_snapshot_buffer),
+                                              &error_p);
+  TEST_ASSERT (merged_size > 0);
+
+  jerry_cleanup ();
+
+  for (size_t i = 0; i < 2; i++)
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_value_t res = jerry_exec_snapshot (merged_snapshot_buffer, merged_size, i, 0);
+    TEST_ASSERT (jerry_value_is_true (res));
+    jerry_release_value (res);
+    jerry_cleanup ();
+  }
+} /* test_merge_many_literals */
+
 int
 main (void)
 {
@@ -234,6 +417,9 @@ main (void)
     jerry_cleanup ();
 
     test_exec_snapshot (snapshot_buffer, snapshot_size, JERRY_SNAPSHOT_EXEC_ALLOW_STATIC);
+    test_exec_snapshot (snapshot_buffer,
+                        snapshot_size,
+                        JERRY_SNAPSHOT_EXEC_ALLOW_STATIC | JERRY_SNAPSHOT_EXEC_LAZY_LOAD);
   }
 
   /* Merge snapshot */
@@ -393,5 +579,9 @@ main (void)
 
   test_function_arguments_snapshot ();
 
+  test_lazy_load_snapshot ();
+
+  test_merge_many_literals ();
+
   return 0;
 } /* main */
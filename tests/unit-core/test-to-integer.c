@@ -39,7 +39,7 @@ main (void)
 
   ecma_value_t int_num = ecma_make_int32_value (123);
 
-  ecma_number_t result = ecma_op_to_integer (int_num, &num);
+  ecma_value_t result = ecma_op_to_integer (int_num, &num);
 
   ecma_free_value (int_num);
 
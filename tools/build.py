@@ -118,8 +118,12 @@ def get_arguments():
                          help='enable external context (%(choices)s)')
     coregrp.add_argument('--jerry-debugger', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable the jerry debugger (%(choices)s)')
+    coregrp.add_argument('--heap-size-classes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable size class free lists in the heap (%(choices)s)')
     coregrp.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable js-parser (%(choices)s)')
+    coregrp.add_argument('--lazy-functions', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='compile function bodies on their first call (%(choices)s)')
     coregrp.add_argument('--line-info', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='provide line info (%(choices)s)')
     coregrp.add_argument('--logging', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -130,16 +134,24 @@ def get_arguments():
                          help='memory usage limit to trigger garbage collection (in bytes)')
     coregrp.add_argument('--stack-limit', metavar='SIZE', type=int,
                          help='maximum stack usage (in kilobytes)')
+    coregrp.add_argument('--vm-heap-frames-limit', metavar='SIZE', type=int,
+                         help='maximum size of VM frames allocated on the heap (in kilobytes)')
     coregrp.add_argument('--gc-mark-limit', metavar='SIZE', type=int,
                          help='maximum depth of recursion during GC mark phase')
+    coregrp.add_argument('--gc-step-limit', metavar='SIZE', type=int,
+                         help='maximum number of objects marked or freed by a GC step')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable mem-stress test (%(choices)s)'))
+    coregrp.add_argument('--nan-boxing', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable NaN-boxed 64-bit values (%(choices)s)')
     coregrp.add_argument('--profile', metavar='FILE',
                          help='specify profile file')
     coregrp.add_argument('--promise-callback', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable promise callback (%(choices)s)')
+    coregrp.add_argument('--property-shapes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable property shapes (%(choices)s)')
     coregrp.add_argument('--regexp-strict-mode', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable regexp strict mode (%(choices)s)'))
     coregrp.add_argument('--show-opcodes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -156,6 +168,8 @@ def get_arguments():
                          help=devhelp('enable Valgrind support (%(choices)s)'))
     coregrp.add_argument('--vm-exec-stop', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM execution stopping (%(choices)s)')
+    coregrp.add_argument('--vm-heap-frames', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable allocating VM frames on the heap (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -205,16 +219,21 @@ def generate_build_options(arguments):
     build_options_append('JERRY_ERROR_MESSAGES', arguments.error_messages)
     build_options_append('JERRY_EXTERNAL_CONTEXT', arguments.external_context)
     build_options_append('JERRY_DEBUGGER', arguments.jerry_debugger)
+    build_options_append('JERRY_HEAP_SIZE_CLASSES', arguments.heap_size_classes)
     build_options_append('JERRY_PARSER', arguments.js_parser)
+    build_options_append('JERRY_LAZY_FUNCTIONS', arguments.lazy_functions)
     build_options_append('JERRY_LINE_INFO', arguments.line_info)
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
+    build_options_append('JERRY_VM_HEAP_FRAMES_LIMIT', arguments.vm_heap_frames_limit)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
+    build_options_append('JERRY_NAN_BOXING', arguments.nan_boxing)
     build_options_append('JERRY_PROFILE', arguments.profile)
     build_options_append('JERRY_PROMISE_CALLBACK', arguments.promise_callback)
+    build_options_append('JERRY_PROPERTY_SHAPES', arguments.property_shapes)
     build_options_append('JERRY_REGEXP_STRICT_MODE', arguments.regexp_strict_mode)
     build_options_append('JERRY_PARSER_DUMP_BYTE_CODE', arguments.show_opcodes)
     build_options_append('JERRY_REGEXP_DUMP_BYTE_CODE', arguments.show_regexp_opcodes)
@@ -223,10 +242,14 @@ def generate_build_options(arguments):
     build_options_append('JERRY_SYSTEM_ALLOCATOR', arguments.system_allocator)
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
     build_options_append('JERRY_VM_EXEC_STOP', arguments.vm_exec_stop)
+    build_options_append('JERRY_VM_HEAP_FRAMES', arguments.vm_heap_frames)
 
     if arguments.gc_mark_limit is not None:
         build_options.append('-D%s=%s' % ('JERRY_GC_MARK_LIMIT', arguments.gc_mark_limit))
 
+    if arguments.gc_step_limit is not None:
+        build_options.append('-D%s=%s' % ('JERRY_GC_STEP_LIMIT', arguments.gc_step_limit))
+
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
     build_options_append('ENABLE_COMPILE_COMMANDS', arguments.compile_commands)
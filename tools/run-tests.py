@@ -45,6 +45,7 @@ OPTIONS_PROFILE_ES51 = ['--profile=es5.1']
 OPTIONS_PROFILE_ESNEXT = ['--profile=es.next']
 OPTIONS_STACK_LIMIT = ['--stack-limit=96']
 OPTIONS_GC_MARK_LIMIT = ['--gc-mark-limit=16']
+OPTIONS_GC_STEP_LIMIT = ['--gc-step-limit=64']
 OPTIONS_MEM_STRESS = ['--mem-stress-test=on']
 OPTIONS_DEBUG = ['--debug']
 OPTIONS_SNAPSHOT = ['--snapshot-save=on', '--snapshot-exec=on', '--jerry-cmdline-snapshot=on']
@@ -82,6 +83,12 @@ JERRY_TESTS_OPTIONS = [
     Options('jerry_tests-es.next',
             OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
             + OPTIONS_MEM_STRESS),
+    Options('jerry_tests-es.next-gc_step_limit',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
+            + OPTIONS_GC_STEP_LIMIT),
+    Options('jerry_tests-es.next-vm_heap_frames',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
+            + ['--vm-heap-frames=on', '--vm-heap-frames-limit=16']),
     Options('jerry_tests-es5.1',
             OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT),
     Options('jerry_tests-es5.1-snapshot',
@@ -145,6 +152,14 @@ JERRY_BUILDOPTIONS = [
             ['--jerry-math=on']),
     Options('buildoption_test-no_lcache_prophashmap',
             ['--compile-flag=-DJERRY_LCACHE=0', '--compile-flag=-DJERRY_PROPERTY_HASHMAP=0']),
+    Options('buildoption_test-vm_inline_cache',
+            ['--compile-flag=-DJERRY_VM_INLINE_CACHE=1']),
+    Options('buildoption_test-vm_heap_frames',
+            ['--vm-heap-frames=on', '--vm-heap-frames-limit=64']),
+    Options('buildoption_test-nan_boxing',
+            ['--nan-boxing=on']),
+    Options('buildoption_test-lazy_functions',
+            ['--lazy-functions=on']),
     Options('buildoption_test-external_context',
             ['--external-context=on']),
     Options('buildoption_test-shared_libs',
@@ -159,6 +174,8 @@ JERRY_BUILDOPTIONS = [
             OPTIONS_STACK_LIMIT),
     Options('buildoption_test-gc-mark_limit',
             OPTIONS_GC_MARK_LIMIT),
+    Options('buildoption_test-gc-step_limit',
+            OPTIONS_GC_STEP_LIMIT),
     Options('buildoption_test-jerry-debugger',
             ['--jerry-debugger=on']),
     Options('buildoption_test-module-off',